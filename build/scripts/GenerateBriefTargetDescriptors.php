@@ -1,5 +1,6 @@
 <?php
 
+use Targets\TargetDescriptionFiles\Services\BinaryImageService;
 use Targets\TargetDescriptionFiles\Services\DiscoveryService;
 use Targets\TargetDescriptionFiles\Services\Xml\XmlService;
 use Targets\TargetDescriptionFiles\TargetFamily;
@@ -32,12 +33,14 @@ if (!file_exists(dirname(OUTPUT_PATH))) {
     mkdir(dirname(OUTPUT_PATH), 0700, true);
 }
 
+require_once __DIR__ . '/Targets/TargetDescriptionFiles/Services/BinaryImageService.php';
 require_once __DIR__ . '/Targets/TargetDescriptionFiles/Services/DiscoveryService.php';
 require_once __DIR__ . '/Targets/TargetDescriptionFiles/Services/Xml/XmlService.php';
 require_once __DIR__ . '/Targets/TargetDescriptionFiles/TargetFamily.php';
 
 require_once __DIR__ . '/Targets/TargetDescriptionFiles/Avr8/Avr8TargetDescriptionFile.php';
 
+$binaryImageService = new BinaryImageService();
 $discoveryService = new DiscoveryService();
 $xmlService = new XmlService();
 
@@ -94,6 +97,19 @@ foreach ($xmlFiles as $xmlFile) {
         print 'Aborting' . PHP_EOL;
         exit(1);
     }
+
+    /*
+     * The binary image must be written after the TDF has been copied, as Bloom will ignore any image that is older
+     * than its TDF.
+     */
+    $imageDestinationPath = $binaryImageService->imagePath($tdfDestinationPath);
+    $image = $binaryImageService->toBinaryImage($xmlDocument, filesize($xmlFilePath));
+
+    if (file_put_contents($imageDestinationPath, $image) === false) {
+        print 'FATAL ERROR: Failed to write binary TDF image to ' . $imageDestinationPath . PHP_EOL;
+        print 'Aborting' . PHP_EOL;
+        exit(1);
+    }
 }
 
 file_put_contents(OUTPUT_PATH, implode(',' . PHP_EOL, $entries));
@@ -101,4 +117,5 @@ file_put_contents(OUTPUT_PATH, implode(',' . PHP_EOL, $entries));
 print PHP_EOL;
 print 'Processed ' . count($xmlFiles) . ' TDFs.' . PHP_EOL;
 print 'Generated brief target descriptors at ' . OUTPUT_PATH . PHP_EOL;
+print 'Generated binary TDF images at ' . TDF_OUTPUT_PATH . PHP_EOL;
 print 'Done' . PHP_EOL;
@@ -0,0 +1,155 @@
+<?php
+namespace Targets\TargetDescriptionFiles\Services;
+
+use DOMDocument;
+use DOMElement;
+
+/**
+ * The BinaryImageService compiles TDF XML documents into binary TDF images, which Bloom can memory-map and read
+ * directly, without parsing any XML.
+ *
+ * A binary TDF image is a flattened copy of the TDF's element tree - element names, attributes and parent/child
+ * relationships. Text nodes and comments are omitted, as TDFs don't use them. See
+ * Targets::TargetDescription::TdfImage (src/Targets/TargetDescription/TdfImage.hpp) for the image format. The two
+ * must be kept in sync.
+ */
+class BinaryImageService
+{
+    public const MAGIC = 'BLTDFIMG';
+    public const FORMAT_VERSION = 1;
+    public const FILE_EXTENSION = 'tdfi';
+
+    private const NONE = 0xFFFFFFFF;
+
+    /** @var string[] */
+    private array $strings = [];
+
+    /** @var int[] */
+    private array $stringIndicesByValue = [];
+
+    /** @var int[][] */
+    private array $elements = [];
+
+    /** @var int[][] */
+    private array $attributes = [];
+
+    /**
+     * Compiles the given TDF XML document into a binary TDF image.
+     *
+     * @param DOMDocument $document
+     *
+     * @param int $sourceSize
+     *  The size of the TDF XML file, in bytes. This is recorded in the image, so that Bloom can detect modifications
+     *  to the XML file.
+     *
+     * @return string
+     *  The binary image.
+     */
+    public function toBinaryImage(DOMDocument $document, int $sourceSize): string
+    {
+        $this->strings = [];
+        $this->stringIndicesByValue = [];
+        $this->elements = [];
+        $this->attributes = [];
+
+        $this->addElement($document->documentElement);
+
+        $stringData = '';
+        $stringTable = '';
+        foreach ($this->strings as $string) {
+            $stringTable .= pack('VV', strlen($stringData), strlen($string));
+            $stringData .= $string;
+        }
+
+        $output = self::MAGIC . pack(
+            'VVVVVV',
+            self::FORMAT_VERSION,
+            $sourceSize,
+            count($this->strings),
+            count($this->elements),
+            count($this->attributes),
+            strlen($stringData)
+        );
+
+        $output .= $stringTable;
+
+        foreach ($this->elements as $element) {
+            $output .= pack('VVVVV', ...$element);
+        }
+
+        foreach ($this->attributes as $attribute) {
+            $output .= pack('VV', ...$attribute);
+        }
+
+        return $output . $stringData;
+    }
+
+    /**
+     * Returns the path of the binary TDF image for the given TDF XML file path.
+     *
+     * @param string $xmlFilePath
+     *
+     * @return string
+     */
+    public function imagePath(string $xmlFilePath): string
+    {
+        return preg_replace('/\.xml$/i', '', $xmlFilePath) . '.' . self::FILE_EXTENSION;
+    }
+
+    /**
+     * Appends the given element, along with all of its descendants, to the element table (in document order).
+     *
+     * @param DOMElement $element
+     *
+     * @return int
+     *  The index of the element.
+     */
+    private function addElement(DOMElement $element): int
+    {
+        $index = count($this->elements);
+        $this->elements[] = [
+            $this->stringIndex($element->nodeName),
+            count($this->attributes),
+            $element->attributes->length,
+            self::NONE,
+            self::NONE,
+        ];
+
+        foreach ($element->attributes as $attribute) {
+            $this->attributes[] = [
+                $this->stringIndex($attribute->nodeName),
+                $this->stringIndex($attribute->nodeValue),
+            ];
+        }
+
+        $previousChildIndex = null;
+        foreach ($element->childNodes as $childNode) {
+            if (!$childNode instanceof DOMElement) {
+                continue;
+            }
+
+            $childIndex = $this->addElement($childNode);
+
+            if ($previousChildIndex === null) {
+                $this->elements[$index][3] = $childIndex;
+
+            } else {
+                $this->elements[$previousChildIndex][4] = $childIndex;
+            }
+
+            $previousChildIndex = $childIndex;
+        }
+
+        return $index;
+    }
+
+    private function stringIndex(string $value): int
+    {
+        if (!isset($this->stringIndicesByValue[$value])) {
+            $this->stringIndicesByValue[$value] = count($this->strings);
+            $this->strings[] = $value;
+        }
+
+        return $this->stringIndicesByValue[$value];
+    }
+}
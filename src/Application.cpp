@@ -1,6 +1,7 @@
 #include "Application.hpp"
 
 #include <iostream>
+#include <algorithm>
 #include <QTimer>
 #include <QFile>
 #include <QJsonDocument>
@@ -44,6 +45,7 @@ int Application::run() {
             }
 
             this->selectedEnvironmentName = std::move(firstArg);
+            this->environmentNameProvided = true;
         }
 
         if (Services::ProcessService::isRunningAsRoot()) {
@@ -155,7 +157,10 @@ void Application::startup() {
 
     this->startSignalHandler();
 
-    Logger::info("Selected environment: \"" + this->selectedEnvironmentName + "\"");
+    for (const auto& environmentInstance : this->environmentInstances) {
+        Logger::info("Selected environment: \"" + environmentInstance.environmentConfig.name + "\"");
+    }
+
     Logger::debug(
         "Number of environments extracted from config: " + std::to_string(this->projectConfig->environments.size())
     );
@@ -181,8 +186,8 @@ void Application::startup() {
         std::bind(&Application::onInsightMainWindowClosed, this, std::placeholders::_1)
     );
 #endif
-    this->startTargetController();
-    this->startDebugServer();
+    this->startTargetControllers();
+    this->startDebugServers();
 
     Thread::threadState = ThreadState::READY;
 }
@@ -196,8 +201,8 @@ void Application::shutdown() {
     Thread::threadState = ThreadState::SHUTDOWN_INITIATED;
     Logger::info("Shutting down Bloom");
 
-    this->stopDebugServer();
-    this->stopTargetController();
+    this->stopDebugServers();
+    this->stopTargetControllers();
     this->stopSignalHandler();
 
     try {
@@ -300,29 +305,74 @@ void Application::loadProjectConfiguration() {
         throw InvalidConfig(exception.msg);
     }
 
-    // Validate the selected environment
-    const auto selectedEnvironmentIt = this->projectConfig->environments.find(this->selectedEnvironmentName);
-    if (selectedEnvironmentIt == this->projectConfig->environments.end()) {
-        throw InvalidConfig{
-            "Environment (\"" + this->selectedEnvironmentName + "\") not found in configuration."
-        };
+    auto environmentNames = std::vector<std::string>{this->selectedEnvironmentName};
+
+    if (!this->environmentNameProvided && !this->projectConfig->concurrentEnvironmentNames.empty()) {
+        environmentNames = this->projectConfig->concurrentEnvironmentNames;
     }
 
-    this->environmentConfig = selectedEnvironmentIt->second;
+    // Validate the selected environments
+    for (const auto& environmentName : environmentNames) {
+        const auto environmentIt = this->projectConfig->environments.find(environmentName);
+        if (environmentIt == this->projectConfig->environments.end()) {
+            throw InvalidConfig{"Environment (\"" + environmentName + "\") not found in configuration."};
+        }
 
-#ifndef EXCLUDE_INSIGHT
-    this->insightConfig = this->environmentConfig->insightConfig.value_or(this->projectConfig->insightConfig);
-#endif
+        const auto& environmentConfig = environmentIt->second;
 
-    if (this->environmentConfig->debugServerConfig.has_value()) {
-        this->debugServerConfig = this->environmentConfig->debugServerConfig.value();
+        if (environmentConfig.debugServerConfig.has_value()) {
+            this->environmentInstances.emplace_back(EnvironmentInstance{
+                .environmentConfig = environmentConfig,
+                .debugServerConfig = environmentConfig.debugServerConfig.value()
+            });
 
-    } else if (this->projectConfig->debugServerConfig.has_value()) {
-        this->debugServerConfig = this->projectConfig->debugServerConfig.value();
+            continue;
+        }
+
+        if (!this->projectConfig->debugServerConfig.has_value()) {
+            throw InvalidConfig{"Debug server configuration missing."};
+        }
 
-    } else {
-        throw InvalidConfig{"Debug server configuration missing."};
+        if (environmentNames.size() > 1) {
+            // The servers would all attempt to listen on the same port
+            throw InvalidConfig{
+                "Debug server configuration missing for environment (\"" + environmentName + "\"). Each "
+                    "concurrently served environment must have its own server configuration, with a distinct port."
+            };
+        }
+
+        this->environmentInstances.emplace_back(EnvironmentInstance{
+            .environmentConfig = environmentConfig,
+            .debugServerConfig = this->projectConfig->debugServerConfig.value()
+        });
     }
+
+    if (environmentNames.size() > 1 && this->projectConfig->insightEnvironmentName.has_value()) {
+        const auto& insightEnvironmentName = *(this->projectConfig->insightEnvironmentName);
+        const auto instanceIt = std::find_if(
+            this->environmentInstances.begin(),
+            this->environmentInstances.end(),
+            [&insightEnvironmentName] (const EnvironmentInstance& instance) {
+                return instance.environmentConfig.name == insightEnvironmentName;
+            }
+        );
+
+        if (instanceIt == this->environmentInstances.end()) {
+            throw InvalidConfig{
+                "Insight environment (\"" + insightEnvironmentName + "\") is not listed in concurrent_environments."
+            };
+        }
+
+        this->insightEnvironmentIndex = static_cast<std::size_t>(
+            std::distance(this->environmentInstances.begin(), instanceIt)
+        );
+    }
+
+    this->environmentConfig = this->environmentInstances[this->insightEnvironmentIndex].environmentConfig;
+
+#ifndef EXCLUDE_INSIGHT
+    this->insightConfig = this->environmentConfig->insightConfig.value_or(this->projectConfig->insightConfig);
+#endif
 }
 
 int Application::presentHelpText() {
@@ -476,79 +526,124 @@ void Application::stopSignalHandler() {
     }
 }
 
-void Application::startTargetController() {
-    this->targetController = std::make_unique<TargetController::TargetControllerComponent>(
-        this->projectConfig.value(),
-        this->environmentConfig.value()
-    );
+void Application::startTargetControllers() {
+    for (auto& environmentInstance : this->environmentInstances) {
+        environmentInstance.targetController = std::make_unique<TargetController::TargetControllerComponent>(
+            this->projectConfig.value(),
+            environmentInstance.environmentConfig
+        );
 
-    this->targetControllerThread = std::thread(
-        &TargetController::TargetControllerComponent::run,
-        this->targetController.get()
-    );
+        environmentInstance.targetControllerThread = std::thread(
+            &TargetController::TargetControllerComponent::run,
+            environmentInstance.targetController.get()
+        );
+    }
 
-    const auto tcStateChangeEvent = this->applicationEventListener->waitForEvent<
-        Events::TargetControllerThreadStateChanged
-    >();
+    for (auto i = std::size_t{0}; i < this->environmentInstances.size(); ++i) {
+        const auto tcStateChangeEvent = this->applicationEventListener->waitForEvent<
+            Events::TargetControllerThreadStateChanged
+        >();
 
-    if (!tcStateChangeEvent.has_value() || tcStateChangeEvent->get()->getState() != ThreadState::READY) {
-        throw Exception{"TargetController failed to start up"};
+        if (!tcStateChangeEvent.has_value() || tcStateChangeEvent->get()->getState() != ThreadState::READY) {
+            throw Exception{"TargetController failed to start up"};
+        }
     }
 }
 
-void Application::stopTargetController() {
-    if (this->targetController == nullptr) {
-        return;
+void Application::stopTargetControllers() {
+    auto activeTargetControllerCount = std::size_t{0};
+
+    for (const auto& environmentInstance : this->environmentInstances) {
+        if (environmentInstance.targetController == nullptr) {
+            continue;
+        }
+
+        const auto tcThreadState = environmentInstance.targetController->getThreadState();
+        if (tcThreadState == ThreadState::STARTING || tcThreadState == ThreadState::READY) {
+            ++activeTargetControllerCount;
+        }
     }
 
-    const auto tcThreadState = this->targetController->getThreadState();
-    if (tcThreadState == ThreadState::STARTING || tcThreadState == ThreadState::READY) {
+    if (activeTargetControllerCount > 0) {
+        // The ShutdownTargetController event isn't bound to an environment, so every TargetController will action it
         EventManager::triggerEvent(std::make_shared<Events::ShutdownTargetController>());
-        this->applicationEventListener->waitForEvent<Events::TargetControllerThreadStateChanged>(
-            std::chrono::milliseconds{10000}
-        );
+
+        for (auto i = std::size_t{0}; i < activeTargetControllerCount; ++i) {
+            this->applicationEventListener->waitForEvent<Events::TargetControllerThreadStateChanged>(
+                std::chrono::milliseconds{10000}
+            );
+        }
     }
 
-    if (this->targetControllerThread.joinable()) {
-        Logger::debug("Joining TargetController thread");
-        this->targetControllerThread.join();
-        Logger::debug("TargetController thread joined");
+    for (auto& environmentInstance : this->environmentInstances) {
+        if (environmentInstance.targetControllerThread.joinable()) {
+            Logger::debug(
+                "Joining TargetController thread (environment: \"" + environmentInstance.environmentConfig.name
+                    + "\")"
+            );
+            environmentInstance.targetControllerThread.join();
+            Logger::debug("TargetController thread joined");
+        }
     }
 }
 
-void Application::startDebugServer() {
-    this->debugServer = std::make_unique<DebugServer::DebugServerComponent>(
-        this->environmentConfig.value(),
-        this->debugServerConfig.value()
-    );
-    this->debugServerThread = std::thread{&DebugServer::DebugServerComponent::run, this->debugServer.get()};
+void Application::startDebugServers() {
+    for (auto& environmentInstance : this->environmentInstances) {
+        environmentInstance.debugServer = std::make_unique<DebugServer::DebugServerComponent>(
+            environmentInstance.environmentConfig,
+            environmentInstance.debugServerConfig,
+            *(environmentInstance.targetController)
+        );
+
+        environmentInstance.debugServerThread = std::thread{
+            &DebugServer::DebugServerComponent::run,
+            environmentInstance.debugServer.get()
+        };
+    }
 
-    const auto dsStateChangeEvent = this->applicationEventListener->waitForEvent<
-        Events::DebugServerThreadStateChanged
-    >();
+    for (auto i = std::size_t{0}; i < this->environmentInstances.size(); ++i) {
+        const auto dsStateChangeEvent = this->applicationEventListener->waitForEvent<
+            Events::DebugServerThreadStateChanged
+        >();
 
-    if (!dsStateChangeEvent.has_value() || dsStateChangeEvent->get()->getState() != ThreadState::READY) {
-        throw Exception{"DebugServer failed to start up"};
+        if (!dsStateChangeEvent.has_value() || dsStateChangeEvent->get()->getState() != ThreadState::READY) {
+            throw Exception{"DebugServer failed to start up"};
+        }
     }
 }
 
-void Application::stopDebugServer() {
-    if (this->debugServer == nullptr) {
-        return;
+void Application::stopDebugServers() {
+    auto activeDebugServerCount = std::size_t{0};
+
+    for (const auto& environmentInstance : this->environmentInstances) {
+        if (environmentInstance.debugServer == nullptr) {
+            continue;
+        }
+
+        const auto debugServerState = environmentInstance.debugServer->getThreadState();
+        if (debugServerState == ThreadState::STARTING || debugServerState == ThreadState::READY) {
+            ++activeDebugServerCount;
+        }
     }
 
-    const auto debugServerState = this->debugServer->getThreadState();
-    if (debugServerState == ThreadState::STARTING || debugServerState == ThreadState::READY) {
+    if (activeDebugServerCount > 0) {
         EventManager::triggerEvent(std::make_shared<Events::ShutdownDebugServer>());
-        this->applicationEventListener->waitForEvent<Events::DebugServerThreadStateChanged>(
-            std::chrono::milliseconds{5000}
-        );
+
+        for (auto i = std::size_t{0}; i < activeDebugServerCount; ++i) {
+            this->applicationEventListener->waitForEvent<Events::DebugServerThreadStateChanged>(
+                std::chrono::milliseconds{5000}
+            );
+        }
     }
 
-    if (this->debugServerThread.joinable()) {
-        Logger::debug("Joining DebugServer thread");
-        this->debugServerThread.join();
-        Logger::debug("DebugServer thread joined");
+    for (auto& environmentInstance : this->environmentInstances) {
+        if (environmentInstance.debugServerThread.joinable()) {
+            Logger::debug(
+                "Joining DebugServer thread (environment: \"" + environmentInstance.environmentConfig.name + "\")"
+            );
+            environmentInstance.debugServerThread.join();
+            Logger::debug("DebugServer thread joined");
+        }
     }
 }
 
@@ -603,6 +698,7 @@ void Application::activateInsight() {
 
     this->insight = std::make_unique<Insight>(
         *(this->applicationEventListener),
+        *(this->environmentInstances[this->insightEnvironmentIndex].targetController),
         this->projectConfig.value(),
         this->environmentConfig.value(),
         this->insightConfig.value(),
@@ -635,7 +731,7 @@ void Application::onShutdownApplicationRequest(const Events::ShutdownApplication
 
 void Application::onTargetControllerThreadStateChanged(const Events::TargetControllerThreadStateChanged& event) {
     if (event.getState() == ThreadState::STOPPED || event.getState() == ThreadState::SHUTDOWN_INITIATED) {
-        // TargetController has unexpectedly shutdown.
+        // A TargetController has unexpectedly shutdown.
         this->triggerShutdown();
     }
 }
@@ -648,7 +744,13 @@ void Application::onDebugServerThreadStateChanged(const Events::DebugServerThrea
 }
 
 void Application::onDebugSessionFinished(const Events::DebugSessionFinished& event) {
-    if (this->environmentConfig->shutdownPostDebugSession) {
-        this->triggerShutdown();
+    for (const auto& environmentInstance : this->environmentInstances) {
+        if (
+            event.relatesToEnvironment(environmentInstance.environmentConfig.name)
+            && environmentInstance.environmentConfig.shutdownPostDebugSession
+        ) {
+            this->triggerShutdown();
+            return;
+        }
     }
 }
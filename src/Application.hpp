@@ -3,6 +3,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 #include <optional>
 #include <functional>
 #include <QtCore/QtCore>
@@ -65,25 +66,40 @@ private:
     std::thread signalHandlerThread;
 
     /**
-     * The TargetController possesses full control of the connected debug tool and target. It runs on a
-     * dedicated thread.
-     *
-     * See the TargetController class for more on this.
-     *
-     * I could have used std::optional here, for the late initialisation, but given that we're using
-     * std::unique_ptr for the debug server (for polymorphism), I thought I'd keep it consistent.
+     * The components serving a single environment.
      */
-    std::unique_ptr<TargetController::TargetControllerComponent> targetController = nullptr;
-    std::thread targetControllerThread;
+    struct EnvironmentInstance
+    {
+        EnvironmentConfig environmentConfig;
+        DebugServerConfig debugServerConfig;
+
+        /**
+         * The TargetController possesses full control of the environment's debug tool and target. It runs on a
+         * dedicated thread.
+         *
+         * See the TargetController class for more on this.
+         *
+         * I could have used std::optional here, for the late initialisation, but given that we're using
+         * std::unique_ptr for the debug server (for polymorphism), I thought I'd keep it consistent.
+         */
+        std::unique_ptr<TargetController::TargetControllerComponent> targetController = nullptr;
+        std::thread targetControllerThread = {};
+
+        /**
+         * The DebugServer exposes an interface to the environment's target, to third-party software such as IDEs.
+         * It runs on a dedicated thread.
+         *
+         * See the DebugServer and GdbRspDebugServer class for more on this.
+         */
+        std::unique_ptr<DebugServer::DebugServerComponent> debugServer = nullptr;
+        std::thread debugServerThread = {};
+    };
 
     /**
-     * The DebugServer exposes an interface to the connected target, to third-party software such as IDEs. It runs
-     * on a dedicated thread.
-     *
-     * See the DebugServer and GdbRspDebugServer class for more on this.
+     * The environments being served. Usually just the selected environment, but multiple environments can be
+     * served concurrently - see ProjectConfig::concurrentEnvironmentNames.
      */
-    std::unique_ptr<DebugServer::DebugServerComponent> debugServer = nullptr;
-    std::thread debugServerThread;
+    std::vector<EnvironmentInstance> environmentInstances;
 
 #ifndef EXCLUDE_INSIGHT
     /**
@@ -116,10 +132,15 @@ private:
      * See ProjectConfig.hpp for more on this.
      */
     std::optional<ProjectConfig> projectConfig;
-    std::optional<EnvironmentConfig> environmentConfig;
-    std::optional<DebugServerConfig> debugServerConfig;
     std::optional<InsightConfig> insightConfig;
 
+    /**
+     * The config of the environment that Insight serves - the first environment being served, unless another is
+     * selected via ProjectConfig::insightEnvironmentName. Insight only serves this environment.
+     */
+    std::optional<EnvironmentConfig> environmentConfig;
+    std::size_t insightEnvironmentIndex = 0;
+
     /**
      * Settings extracted from the settings file in the user's project root.
      */
@@ -129,9 +150,10 @@ private:
      * The project environment selected by the user.
      *
      * If an environment name is not provided as an argument when running Bloom, Bloom will fallback to the
-     * environment named "default".
+     * environment named "default", or the environments listed in the project's concurrent_environments config.
      */
     std::string selectedEnvironmentName = "default";
+    bool environmentNameProvided = false;
 
     /**
      * Some CLI arguments are interpreted as commands and thus require specific handler methods to be called.
@@ -174,8 +196,8 @@ private:
     /**
      * Extracts the project config from the user's config file and populates the following members:
      *  - this->projectConfig
+     *  - this->environmentInstances
      *  - this->environmentConfig
-     *  - this->debugServerConfig
      *  - this->insightConfig
      *
      * @see ProjectConfig declaration for more on this.
@@ -228,28 +250,29 @@ private:
     void stopSignalHandler();
 
     /**
-     * Prepares a dedicated thread for the TargetController and kicks it off with a call to
-     * TargetControllerComponent::run().
+     * Prepares a dedicated thread for each environment's TargetController and kicks them off with a call to
+     * TargetControllerComponent::run(). The TargetControllers start up concurrently.
      */
-    void startTargetController();
+    void startTargetControllers();
 
     /**
-     * Invokes a clean shutdown of the TargetController. The TargetController should disconnect from the target
+     * Invokes a clean shutdown of all TargetControllers. Each TargetController should disconnect from its target
      * and debug tool in a clean and safe manner, ensuring that both are left in a sensible state.
      *
-     * This will join the TargetController thread.
+     * This will join the TargetController threads.
      */
-    void stopTargetController();
+    void stopTargetControllers();
 
     /**
-     * Prepares a dedicated thread for the DebugServer and kicks it off with a call to DebugServer::run().
+     * Prepares a dedicated thread for each environment's DebugServer and kicks them off with a call to
+     * DebugServer::run().
      */
-    void startDebugServer();
+    void startDebugServers();
 
     /**
-     * Sends a shutdown request to the DebugServer thread and waits on it to exit.
+     * Sends a shutdown request to the DebugServer threads and waits on them to exit.
      */
-    void stopDebugServer();
+    void stopDebugServers();
 
     /**
      * Dispatches any pending events. This function will be called periodically, via a QTimer.
@@ -290,7 +313,7 @@ private:
     void onShutdownApplicationRequest(const Events::ShutdownApplication&);
 
     /**
-     * If the TargetController unexpectedly shuts down, the rest of the application will follow.
+     * If a TargetController unexpectedly shuts down, the rest of the application will follow.
      *
      * @param event
      */
@@ -305,7 +328,7 @@ private:
     void onDebugServerThreadStateChanged(const Events::DebugServerThreadStateChanged& event);
 
     /**
-     * If configured to do so, Bloom will shutdown upon the end of the current debug session.
+     * If configured to do so (via the environment's config), Bloom will shutdown upon the end of a debug session.
      *
      * @param event
      */
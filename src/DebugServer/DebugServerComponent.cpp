@@ -15,11 +15,13 @@ namespace DebugServer
 
     DebugServerComponent::DebugServerComponent(
         const EnvironmentConfig& environmentConfig,
-        const DebugServerConfig& debugServerConfig
+        const DebugServerConfig& debugServerConfig,
+        TargetController::TargetControllerComponent& targetController
     )
         : environmentConfig(environmentConfig)
         , debugServerConfig(debugServerConfig)
-        , targetDescriptor((Services::TargetControllerService()).getTargetDescriptor())
+        , targetControllerService(targetController)
+        , targetDescriptor(this->targetControllerService.getTargetDescriptor())
     {}
 
     void DebugServerComponent::run() {
@@ -56,6 +58,7 @@ namespace DebugServer
                         this->environmentConfig,
                         this->debugServerConfig,
                         this->targetDescriptor,
+                        this->targetControllerService,
                         *(this->eventListener.get()),
                         this->interruptEventNotifier
                     );
@@ -72,6 +75,7 @@ namespace DebugServer
                         this->environmentConfig,
                         this->debugServerConfig,
                         this->targetDescriptor,
+                        this->targetControllerService,
                         *(this->eventListener.get()),
                         this->interruptEventNotifier
                     );
@@ -82,9 +86,11 @@ namespace DebugServer
 
     void DebugServerComponent::startup() {
         Logger::setThreadName("DS");
-        Logger::info("Starting DebugServer");
+        Logger::info("Starting DebugServer for environment \"" + this->environmentConfig.name + "\"");
         this->blockAllSignals();
 
+        Events::Event::setThreadEnvironmentName(this->environmentConfig.name);
+        this->eventListener->setEnvironmentName(this->environmentConfig.name);
         EventManager::registerListener(this->eventListener);
         this->eventListener->setInterruptEventNotifier(&this->interruptEventNotifier);
 
@@ -93,7 +99,7 @@ namespace DebugServer
             std::bind(&DebugServerComponent::onShutdownDebugServerEvent, this, std::placeholders::_1)
         );
 
-        static const auto availableServersByName = this->getAvailableServersByName();
+        const auto availableServersByName = this->getAvailableServersByName();
         const auto selectedServerIt = availableServersByName.find(this->debugServerConfig.name);
 
         if (selectedServerIt == availableServersByName.end()) {
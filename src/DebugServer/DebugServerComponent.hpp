@@ -25,15 +25,22 @@ namespace DebugServer
     class DebugServerComponent: public Thread
     {
     public:
+        /**
+         * @param environmentConfig
+         * @param debugServerConfig
+         * @param targetController
+         *  The TargetController serving the environment. The server will only issue commands to this instance.
+         */
         explicit DebugServerComponent(
             const EnvironmentConfig& environmentConfig,
-            const DebugServerConfig& debugServerConfig
+            const DebugServerConfig& debugServerConfig,
+            TargetController::TargetControllerComponent& targetController
         );
 
         /**
          * Entry point for the DebugServer. This must called from a dedicated thread.
          *
-         * See Application::startDebugServer() for more.
+         * See Application::startDebugServers() for more.
          */
         void run();
 
@@ -50,6 +57,8 @@ namespace DebugServer
         EnvironmentConfig environmentConfig;
         DebugServerConfig debugServerConfig;
 
+        Services::TargetControllerService targetControllerService;
+
         /**
          * The current target descriptor.
          */
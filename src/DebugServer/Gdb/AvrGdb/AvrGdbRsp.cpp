@@ -32,6 +32,7 @@ namespace DebugServer::Gdb::AvrGdb
         const EnvironmentConfig& environmentConfig,
         const DebugServerConfig& debugServerConfig,
         const Targets::TargetDescriptor& targetDescriptor,
+        const Services::TargetControllerService& targetControllerService,
         EventListener& eventListener,
         EventFdNotifier& eventNotifier
     )
@@ -40,6 +41,7 @@ namespace DebugServer::Gdb::AvrGdb
             debugServerConfig,
             targetDescriptor,
             AvrGdbTargetDescriptor{targetDescriptor},
+            targetControllerService,
             eventListener,
             eventNotifier
         )
@@ -85,11 +87,11 @@ namespace DebugServer::Gdb::AvrGdb
             return std::make_unique<WriteRegister>(rawPacket);
         }
 
-        if (rawPacket[1] == 'm') {
+        if (rawPacket[1] == 'm' || rawPacket[1] == 'x') {
             return std::make_unique<ReadMemory>(rawPacket, this->gdbTargetDescriptor);
         }
 
-        if (rawPacket[1] == 'M') {
+        if (rawPacket[1] == 'M' || rawPacket[1] == 'X') {
             return std::make_unique<WriteMemory>(rawPacket, this->gdbTargetDescriptor);
         }
 
@@ -149,6 +151,7 @@ namespace DebugServer::Gdb::AvrGdb
             {Feature::SOFTWARE_BREAKPOINTS, std::nullopt},
             {Feature::MEMORY_MAP_READ, std::nullopt},
             {Feature::VCONT_ACTIONS_QUERY, std::nullopt},
+            {Feature::BINARY_MEMORY_READ, std::nullopt},
         };
 
         if (!this->debugServerConfig.packetAcknowledgement) {
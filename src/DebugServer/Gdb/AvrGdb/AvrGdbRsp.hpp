@@ -17,6 +17,7 @@ namespace DebugServer::Gdb::AvrGdb
             const EnvironmentConfig& environmentConfig,
             const DebugServerConfig& debugServerConfig,
             const Targets::TargetDescriptor& targetDescriptor,
+            const Services::TargetControllerService& targetControllerService,
             EventListener& eventListener,
             EventFdNotifier& eventNotifier
         );
@@ -40,16 +40,11 @@ namespace DebugServer::Gdb::AvrGdb
                 descriptor.startAddress - this->gpRegistersMemorySegmentDescriptor.addressRange.startAddress
             );
 
-            this->gdbRegisterDescriptorsById.emplace(gdbRegisterId, RegisterDescriptor{gdbRegisterId, 1});
-            this->targetRegisterDescriptorsByGdbId.emplace(gdbRegisterId, &descriptor);
+            this->addRegisterDescriptor(RegisterDescriptor{gdbRegisterId, 1}, &descriptor);
         }
 
-        this->gdbRegisterDescriptorsById.emplace(
-            AvrGdbTargetDescriptor::STATUS_GDB_REGISTER_ID,
-            RegisterDescriptor{AvrGdbTargetDescriptor::STATUS_GDB_REGISTER_ID, 1}
-        );
-        this->targetRegisterDescriptorsByGdbId.emplace(
-            AvrGdbTargetDescriptor::STATUS_GDB_REGISTER_ID,
+        this->addRegisterDescriptor(
+            RegisterDescriptor{AvrGdbTargetDescriptor::STATUS_GDB_REGISTER_ID, 1},
             &(targetDescriptor.getPeripheralDescriptor("cpu").getRegisterGroupDescriptor("cpu")
                 .getRegisterDescriptor("sreg"))
         );
@@ -59,15 +54,14 @@ namespace DebugServer::Gdb::AvrGdb
          * The register command handlers will deal with these registers separately. See CommandPackets::ReadRegister,
          * CommandPackets::WriteRegister, etc for more.
          */
-        this->gdbRegisterDescriptorsById.emplace(
-            AvrGdbTargetDescriptor::STACK_POINTER_GDB_REGISTER_ID,
-            RegisterDescriptor{AvrGdbTargetDescriptor::STACK_POINTER_GDB_REGISTER_ID, 2}
-        );
+        this->addRegisterDescriptor(RegisterDescriptor{AvrGdbTargetDescriptor::STACK_POINTER_GDB_REGISTER_ID, 2});
+        this->addRegisterDescriptor(RegisterDescriptor{AvrGdbTargetDescriptor::PROGRAM_COUNTER_GDB_REGISTER_ID, 4});
 
-        this->gdbRegisterDescriptorsById.emplace(
-            AvrGdbTargetDescriptor::PROGRAM_COUNTER_GDB_REGISTER_ID,
-            RegisterDescriptor{AvrGdbTargetDescriptor::PROGRAM_COUNTER_GDB_REGISTER_ID, 4}
-        );
+        /*
+         * GDB's AVR support doesn't make use of target descriptions - the register layout is fixed. So we only
+         * provide the memory map.
+         */
+        this->memoryMap = this->generateMemoryMap();
     }
 
     const Targets::TargetAddressSpaceDescriptor& AvrGdbTargetDescriptor::addressSpaceDescriptorFromGdbAddress(
@@ -116,4 +110,25 @@ namespace DebugServer::Gdb::AvrGdb
         // We assume everything else is SRAM
         return address | AvrGdbTargetDescriptor::SRAM_ADDRESS_MASK;
     }
+
+    std::string AvrGdbTargetDescriptor::generateMemoryMap() const {
+        /*
+         * We include register and EEPROM memory in our RAM section. This allows GDB to access registers and EEPROM
+         * data via memory read/write packets.
+         */
+        const auto ramSectionEndAddress = this->translateTargetMemoryAddress(
+            this->eepromMemorySegmentDescriptor.addressRange.endAddress,
+            this->eepromAddressSpaceDescriptor,
+            this->eepromMemorySegmentDescriptor
+        );
+        const auto ramSectionStartAddress = AvrGdbTargetDescriptor::SRAM_ADDRESS_MASK;
+        const auto ramSectionSize = ramSectionEndAddress - ramSectionStartAddress + 1;
+
+        return std::string{"<memory-map>"}
+            + "<memory type=\"ram\" start=\"" + std::to_string(ramSectionStartAddress) + "\" length=\"" + std::to_string(ramSectionSize) + "\"/>"
+            + "<memory type=\"flash\" start=\"0\" length=\"" + std::to_string(this->programMemorySegmentDescriptor.size()) + "\">"
+                + "<property name=\"blocksize\">" + std::to_string(this->programMemorySegmentDescriptor.pageSize.value()) + "</property>"
+            + "</memory>"
+            + "</memory-map>";
+    }
 }
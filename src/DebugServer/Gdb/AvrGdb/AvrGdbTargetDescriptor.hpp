@@ -72,5 +72,13 @@ namespace DebugServer::Gdb::AvrGdb
             const Targets::TargetAddressSpaceDescriptor& addressSpaceDescriptor,
             const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor
         ) const;
+
+    private:
+        /**
+         * Generates the memory map XML document. See TargetDescriptor::memoryMap.
+         *
+         * @return
+         */
+        [[nodiscard]] std::string generateMemoryMap() const;
     };
 }
@@ -12,8 +12,8 @@
 namespace DebugServer::Gdb::AvrGdb::CommandPackets
 {
     /**
-     * The ReadMemory class implements a structure for "m" packets. Upon receiving these packets, the server is
-     * expected to read memory from the target and send it the client.
+     * The ReadMemory class implements a structure for "m" and "x" (binary) packets. Upon receiving these packets, the
+     * server is expected to read memory from the target and send it the client.
      */
     class ReadMemory
         : public CommandPackets::AvrGdbCommandPacketInterface
@@ -25,6 +25,12 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
         Targets::TargetMemoryAddress startAddress;
         Targets::TargetMemorySize bytes;
 
+        /**
+         * True if this is a binary memory read ("x") packet, in which case the memory will be sent in binary form,
+         * as opposed to hex.
+         */
+        bool binary = false;
+
         ReadMemory(const RawPacket& rawPacket, const AvrGdbTargetDescriptor& gdbTargetDescriptor);
 
         void handle(
@@ -40,6 +46,7 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
         {
             GdbMemoryAddress gdbStartAddress;
             std::uint32_t bytes;
+            bool binary;
         };
 
         static PacketData extractPacketData(const RawPacket& rawPacket);
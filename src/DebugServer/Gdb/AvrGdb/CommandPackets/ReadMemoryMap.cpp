@@ -1,6 +1,6 @@
 #include "ReadMemoryMap.hpp"
 
-#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/XferResponsePacket.hpp"
 
 #include "src/Services/StringService.hpp"
 #include "src/Exceptions/Exception.hpp"
@@ -9,7 +9,7 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
 {
     using Services::TargetControllerService;
 
-    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::XferResponsePacket;
 
     using Exceptions::Exception;
 
@@ -46,39 +46,8 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
     ) {
         Logger::info("Handling ReadMemoryMap packet");
 
-        /*
-         * We include register and EEPROM memory in our RAM section. This allows GDB to access registers and EEPROM
-         * data via memory read/write packets.
-         */
-        const auto ramSectionEndAddress = gdbTargetDescriptor.translateTargetMemoryAddress(
-            gdbTargetDescriptor.eepromMemorySegmentDescriptor.addressRange.endAddress,
-            gdbTargetDescriptor.eepromAddressSpaceDescriptor,
-            gdbTargetDescriptor.eepromMemorySegmentDescriptor
+        debugSession.connection.writePacket(
+            XferResponsePacket{gdbTargetDescriptor.memoryMap, this->offset, this->length}
         );
-        const auto ramSectionStartAddress = AvrGdbTargetDescriptor::SRAM_ADDRESS_MASK;
-        const auto ramSectionSize = ramSectionEndAddress - ramSectionStartAddress + 1;
-
-        const auto memoryMap =
-                std::string{"<memory-map>"}
-                + "<memory type=\"ram\" start=\"" + std::to_string(ramSectionStartAddress) + "\" length=\"" + std::to_string(ramSectionSize) + "\"/>"
-                + "<memory type=\"flash\" start=\"0\" length=\"" + std::to_string(gdbTargetDescriptor.programMemorySegmentDescriptor.size()) + "\">"
-                    + "<property name=\"blocksize\">" + std::to_string(gdbTargetDescriptor.programMemorySegmentDescriptor.pageSize.value()) + "</property>"
-                + "</memory>"
-            + "</memory-map>";
-
-        auto responseData = std::vector<unsigned char>{'l'};
-
-        if (this->offset < memoryMap.size() && this->length > 0) {
-            responseData.insert(
-                responseData.end(),
-                memoryMap.begin() + this->offset,
-                memoryMap.begin() + this->offset + std::min(
-                    static_cast<long>(this->length),
-                    static_cast<long>(memoryMap.size() - this->offset)
-                )
-            );
-        }
-
-        debugSession.connection.writePacket(ResponsePacket{responseData});
     }
 }
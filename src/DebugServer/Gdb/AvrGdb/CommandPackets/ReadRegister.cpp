@@ -77,25 +77,20 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
                 return;
             }
 
-            const auto gdbRegisterDescriptorIt = gdbTargetDescriptor.gdbRegisterDescriptorsById.find(this->registerId);
-            const auto targetRegisterDescriptorIt = gdbTargetDescriptor.targetRegisterDescriptorsByGdbId.find(
-                this->registerId
-            );
-
-            if (
-                gdbRegisterDescriptorIt == gdbTargetDescriptor.gdbRegisterDescriptorsById.end()
-                || targetRegisterDescriptorIt == gdbTargetDescriptor.targetRegisterDescriptorsByGdbId.end()
-            ) {
+            const auto gdbRegisterDescriptor = gdbTargetDescriptor.tryGetRegisterDescriptor(this->registerId);
+            const auto targetRegisterDescriptor = gdbTargetDescriptor.tryGetTargetRegisterDescriptor(this->registerId);
+
+            if (!gdbRegisterDescriptor.has_value() || !targetRegisterDescriptor.has_value()) {
                 throw Exception{"Unknown GDB register ID (" + std::to_string(this->registerId) + ")"};
             }
 
-            auto registerValue = targetControllerService.readRegister(*(targetRegisterDescriptorIt->second));
+            auto registerValue = targetControllerService.readRegister(targetRegisterDescriptor->get());
             std::reverse(registerValue.begin(), registerValue.end()); // MSB to LSB
 
-            const auto& gdbRegisterDescriptor = gdbRegisterDescriptorIt->second;
-            if (registerValue.size() < gdbRegisterDescriptor.size) {
+            const auto gdbRegisterSize = gdbRegisterDescriptor->get().size;
+            if (registerValue.size() < gdbRegisterSize) {
                 // The register on the target is smaller than the size expected by GDB.
-                registerValue.insert(registerValue.end(), (gdbRegisterDescriptor.size - registerValue.size()), 0x00);
+                registerValue.insert(registerValue.end(), (gdbRegisterSize - registerValue.size()), 0x00);
             }
 
             debugSession.connection.writePacket(ResponsePacket{Services::StringService::toHex(registerValue)});
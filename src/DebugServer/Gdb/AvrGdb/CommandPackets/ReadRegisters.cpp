@@ -38,52 +38,46 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
         try {
             auto buffer = Targets::TargetMemoryBuffer(39, 0x00);
 
-            auto gpRegDescriptors = Targets::TargetRegisterDescriptors{};
-            std::transform(
-                gdbTargetDescriptor.targetRegisterDescriptorsByGdbId.begin(),
-                gdbTargetDescriptor.targetRegisterDescriptorsByGdbId.end(),
-                std::back_inserter(gpRegDescriptors),
-                [] (const auto& pair) {
-                    return pair.second;
-                }
+            /*
+             * We obtain the register values and stack pointer in a single command batch, so that we only need one
+             * round trip to the TargetController. The program counter is taken from the cached target state.
+             */
+            const auto stopContext = targetControllerService.readStopContext(
+                gdbTargetDescriptor.targetRegisterDescriptors
             );
 
-            {
-                const auto atomicSession = targetControllerService.makeAtomicSession();
-
-                for (auto& [regDesc, regVal] : targetControllerService.readRegisters(gpRegDescriptors)) {
-                    if (regDesc.type != Targets::TargetRegisterType::GENERAL_PURPOSE_REGISTER) {
-                        // Status register (SREG)
-                        assert(regVal.size() == 1);
-                        buffer[32] = regVal[0];
-                        continue;
-                    }
-
-                    const auto bufferOffset = regDesc.startAddress
-                        - gdbTargetDescriptor.gpRegistersMemorySegmentDescriptor.addressRange.startAddress;
-
-                    assert((buffer.size() - bufferOffset) >= regVal.size());
-
-                    /*
-                     * GDB expects register values in LSB form, which is why we use reverse iterators below.
-                     *
-                     * This isn't really necessary though, as all of the registers that are handled here are
-                     * single-byte registers.
-                     */
-                    std::copy(regVal.rbegin(), regVal.rend(), buffer.begin() + bufferOffset);
+            for (const auto& [regDesc, regVal] : stopContext.registers) {
+                if (regDesc.type != Targets::TargetRegisterType::GENERAL_PURPOSE_REGISTER) {
+                    // Status register (SREG)
+                    assert(regVal.size() == 1);
+                    buffer[32] = regVal[0];
+                    continue;
                 }
 
-                const auto spValue = targetControllerService.getStackPointer();
-                buffer[33] = static_cast<unsigned char>(spValue);
-                buffer[34] = static_cast<unsigned char>(spValue >> 8);
+                const auto bufferOffset = regDesc.startAddress
+                    - gdbTargetDescriptor.gpRegistersMemorySegmentDescriptor.addressRange.startAddress;
+
+                assert((buffer.size() - bufferOffset) >= regVal.size());
 
-                const auto pcValue = targetState.programCounter.load().value();
-                buffer[35] = static_cast<unsigned char>(pcValue);
-                buffer[36] = static_cast<unsigned char>(pcValue >> 8);
-                buffer[37] = static_cast<unsigned char>(pcValue >> 16);
-                buffer[38] = static_cast<unsigned char>(pcValue >> 24);
+                /*
+                 * GDB expects register values in LSB form, which is why we use reverse iterators below.
+                 *
+                 * This isn't really necessary though, as all of the registers that are handled here are
+                 * single-byte registers.
+                 */
+                std::copy(regVal.rbegin(), regVal.rend(), buffer.begin() + bufferOffset);
             }
 
+            const auto spValue = stopContext.stackPointer;
+            buffer[33] = static_cast<unsigned char>(spValue);
+            buffer[34] = static_cast<unsigned char>(spValue >> 8);
+
+            const auto pcValue = targetState.programCounter.load().value();
+            buffer[35] = static_cast<unsigned char>(pcValue);
+            buffer[36] = static_cast<unsigned char>(pcValue >> 8);
+            buffer[37] = static_cast<unsigned char>(pcValue >> 16);
+            buffer[38] = static_cast<unsigned char>(pcValue >> 24);
+
             debugSession.connection.writePacket(ResponsePacket{Services::StringService::toHex(buffer)});
 
         } catch (const Exception& exception) {
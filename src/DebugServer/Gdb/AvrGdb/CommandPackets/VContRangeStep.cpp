@@ -51,8 +51,6 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
         TargetControllerService& targetControllerService
     ) {
         using Targets::Microchip::Avr8::OpcodeDecoder::Decoder;
-        using Targets::Microchip::Avr8::OpcodeDecoder::Instruction;
-        using Services::Avr8InstructionService;
         using Services::StringService;
 
         Logger::info("Handling VContRangeStep packet");
@@ -95,133 +93,40 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
                 {}
             };
 
-            const auto instructionsByAddress = Decoder::decode(
+            auto programMemory = targetControllerService.readMemory(
+                gdbTargetDescriptor.programAddressSpaceDescriptor,
+                gdbTargetDescriptor.programMemorySegmentDescriptor,
                 stepAddressRange.startAddress,
-                targetControllerService.readMemory(
-                    gdbTargetDescriptor.programAddressSpaceDescriptor,
-                    gdbTargetDescriptor.programMemorySegmentDescriptor,
-                    stepAddressRange.startAddress,
-                    stepByteSize
-                )
+                stepByteSize
             );
 
-            Logger::debug(
-                "Inspecting " + std::to_string(instructionsByAddress.size()) + " instruction(s) within stepping range "
-                    "(byte addresses) 0x" + StringService::toHex(stepAddressRange.startAddress) + " -> 0x"
-                    + StringService::toHex(stepAddressRange.endAddress) + ", in preparation for new range stepping "
-                    "session"
+            const auto cachedInterceptedAddresses = debugSession.rangeSteppingPlanCache.find(
+                gdbTargetDescriptor.programMemorySegmentDescriptor,
+                stepAddressRange,
+                programMemory
             );
 
-            const Instruction* previousInstruction = nullptr;
-            for (const auto& [instructionAddress, instruction] : instructionsByAddress) {
-                if (!instruction.has_value()) {
-                    /*
-                     * We weren't able to decode the opcode at this address. We have no idea what this instruction
-                     * will do.
-                     */
-
-                    if (
-                        previousInstruction != nullptr
-                        && previousInstruction->mnemonic == Instruction::Mnemonic::BREAK
-                    ) {
-                        /*
-                         * There is a software breakpoint at the previous instruction. AVR8 break instructions are
-                         * single-word instructions, so we could be attempting to decode a misaligned address, as a
-                         * result of a break instruction residing within a multi-word instruction. This could explain
-                         * our inability to decode this instruction.
-                         *
-                         * In this case, we'll just ignore the instruction at this address.
-                         *
-                         * I have little confidence that this is the right approach. We're just assuming that the
-                         * original instruction is a multi-word instruction. What if it isn't? We'll end up ignoring
-                         * an instruction that could jump out of the requested range. But this would only be a problem
-                         * if we failed to decode an instruction that proceeds a break instruction. Quite unlikely.
-                         * TODO: Review after v2.0.0
-                         */
-
-                        Logger::debug(
-                            "Failed to decode AVR8 opcode at byte address 0x" + StringService::toHex(instructionAddress)
-                                + " - the instruction proceeds a BREAK instruction, so the decode failure was ignored."
-                        );
-
-                        previousInstruction = nullptr;
-                        continue;
-                    }
-
-                    Logger::error(
-                        "Failed to decode AVR8 opcode at byte address 0x" + StringService::toHex(instructionAddress)
-                            + " - the instruction will have to be intercepted. Please enable debug logging, reproduce "
-                            "this message and report as an issue via " + Services::PathService::homeDomainName()
-                            + "/report-issue"
-                    );
-
-                    /*
-                     * We have no choice but to intercept it. When we reach it, we'll perform a single step and see
-                     * what happens.
-                     */
-                    rangeSteppingSession.interceptedAddresses.insert(instructionAddress);
-                    previousInstruction = nullptr;
-                    continue;
-                }
-
-                previousInstruction = &*instruction;
+            if (cachedInterceptedAddresses.has_value()) {
+                Logger::debug(
+                    "Using cached intercepted addresses for stepping range (byte addresses) 0x"
+                        + StringService::toHex(stepAddressRange.startAddress) + " -> 0x"
+                        + StringService::toHex(stepAddressRange.endAddress)
+                );
+                rangeSteppingSession.interceptedAddresses = cachedInterceptedAddresses->get();
 
-                if (instruction->canChangeProgramFlow) {
-                    const auto destinationAddress = Avr8InstructionService::resolveProgramDestinationAddress(
-                        *instruction,
-                        instructionAddress,
-                        instructionsByAddress
-                    );
+            } else {
+                rangeSteppingSession.interceptedAddresses = VContRangeStep::resolveInterceptedAddresses(
+                    stepAddressRange,
+                    programMemoryAddressRange,
+                    Decoder::decode(stepAddressRange.startAddress, programMemory)
+                );
 
-                    if (!destinationAddress.has_value()) {
-                        /*
-                         * We don't know where this instruction may jump to, so we'll have to intercept it and perform
-                         * a single step when we reach it.
-                         */
-                        Logger::debug(
-                            "Intercepting CCPF instruction (\"" + instruction->name + "\") at byte address 0x"
-                                + StringService::toHex(instructionAddress)
-                        );
-                        rangeSteppingSession.interceptedAddresses.insert(instructionAddress);
-                        continue;
-                    }
-
-                    if (!programMemoryAddressRange.contains(*destinationAddress)) {
-                        /*
-                         * This instruction may jump to an invalid address. Someone screwed up here - could be
-                         * something wrong in Bloom (opcode decoding bug, incorrect program memory address range in
-                         * the target descriptor, etc.), or the user has an invalid instruction in their program code.
-                         *
-                         * We have no choice but to intercept the instruction. When we reach it, we'll perform a single
-                         * step and see what happens.
-                         */
-                        Logger::debug(
-                            "Intercepting CCPF instruction (\"" + instruction->name + "\") with invalid destination "
-                                "byte address (0x" + StringService::toHex(*destinationAddress) + "), at byte address 0x"
-                                + StringService::toHex(instructionAddress)
-                        );
-                        rangeSteppingSession.interceptedAddresses.insert(instructionAddress);
-                        continue;
-                    }
-
-                    if (
-                        *destinationAddress < stepAddressRange.startAddress
-                        || *destinationAddress >= stepAddressRange.endAddress
-                    ) {
-                        /*
-                         * This instruction may jump to an address outside the requested stepping range.
-                         *
-                         * Because we know exactly where it will jump to (if it jumps), we only need to intercept the
-                         * destination address.
-                         */
-                        Logger::debug(
-                            "Intercepting destination byte address 0x" + StringService::toHex(*destinationAddress)
-                                + " of CCPF instruction (\"" + instruction->name + "\") at byte address 0x"
-                                + StringService::toHex(instructionAddress)
-                        );
-                        rangeSteppingSession.interceptedAddresses.insert(*destinationAddress);
-                    }
-                }
+                debugSession.rangeSteppingPlanCache.insert(
+                    gdbTargetDescriptor.programMemorySegmentDescriptor,
+                    stepAddressRange,
+                    std::move(programMemory),
+                    rangeSteppingSession.interceptedAddresses
+                );
             }
 
             /*
@@ -248,4 +153,137 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
             debugSession.connection.writePacket(ErrorResponsePacket{});
         }
     }
+
+    std::set<Targets::TargetMemoryAddress> VContRangeStep::resolveInterceptedAddresses(
+        const Targets::TargetMemoryAddressRange& stepAddressRange,
+        const Targets::TargetMemoryAddressRange& programMemoryAddressRange,
+        const Targets::Microchip::Avr8::OpcodeDecoder::Decoder::InstructionMapping& instructionsByAddress
+    ) {
+        using Targets::Microchip::Avr8::OpcodeDecoder::Instruction;
+        using Services::Avr8InstructionService;
+        using Services::StringService;
+
+        auto output = std::set<Targets::TargetMemoryAddress>{};
+
+        Logger::debug(
+            "Inspecting " + std::to_string(instructionsByAddress.size()) + " instruction(s) within stepping range "
+                "(byte addresses) 0x" + StringService::toHex(stepAddressRange.startAddress) + " -> 0x"
+                + StringService::toHex(stepAddressRange.endAddress) + ", in preparation for new range stepping "
+                "session"
+        );
+
+        const Instruction* previousInstruction = nullptr;
+        for (const auto& [instructionAddress, instruction] : instructionsByAddress) {
+            if (!instruction.has_value()) {
+                /*
+                 * We weren't able to decode the opcode at this address. We have no idea what this instruction
+                 * will do.
+                 */
+
+                if (
+                    previousInstruction != nullptr
+                    && previousInstruction->mnemonic == Instruction::Mnemonic::BREAK
+                ) {
+                    /*
+                     * There is a software breakpoint at the previous instruction. AVR8 break instructions are
+                     * single-word instructions, so we could be attempting to decode a misaligned address, as a
+                     * result of a break instruction residing within a multi-word instruction. This could explain
+                     * our inability to decode this instruction.
+                     *
+                     * In this case, we'll just ignore the instruction at this address.
+                     *
+                     * I have little confidence that this is the right approach. We're just assuming that the
+                     * original instruction is a multi-word instruction. What if it isn't? We'll end up ignoring
+                     * an instruction that could jump out of the requested range. But this would only be a problem
+                     * if we failed to decode an instruction that proceeds a break instruction. Quite unlikely.
+                     * TODO: Review after v2.0.0
+                     */
+
+                    Logger::debug(
+                        "Failed to decode AVR8 opcode at byte address 0x" + StringService::toHex(instructionAddress)
+                            + " - the instruction proceeds a BREAK instruction, so the decode failure was ignored."
+                    );
+
+                    previousInstruction = nullptr;
+                    continue;
+                }
+
+                Logger::error(
+                    "Failed to decode AVR8 opcode at byte address 0x" + StringService::toHex(instructionAddress)
+                        + " - the instruction will have to be intercepted. Please enable debug logging, reproduce "
+                        "this message and report as an issue via " + Services::PathService::homeDomainName()
+                        + "/report-issue"
+                );
+
+                /*
+                 * We have no choice but to intercept it. When we reach it, we'll perform a single step and see
+                 * what happens.
+                 */
+                output.insert(instructionAddress);
+                previousInstruction = nullptr;
+                continue;
+            }
+
+            previousInstruction = &*instruction;
+
+            if (instruction->canChangeProgramFlow) {
+                const auto destinationAddress = Avr8InstructionService::resolveProgramDestinationAddress(
+                    *instruction,
+                    instructionAddress,
+                    instructionsByAddress
+                );
+
+                if (!destinationAddress.has_value()) {
+                    /*
+                     * We don't know where this instruction may jump to, so we'll have to intercept it and perform
+                     * a single step when we reach it.
+                     */
+                    Logger::debug(
+                        "Intercepting CCPF instruction (\"" + instruction->name + "\") at byte address 0x"
+                            + StringService::toHex(instructionAddress)
+                    );
+                    output.insert(instructionAddress);
+                    continue;
+                }
+
+                if (!programMemoryAddressRange.contains(*destinationAddress)) {
+                    /*
+                     * This instruction may jump to an invalid address. Someone screwed up here - could be
+                     * something wrong in Bloom (opcode decoding bug, incorrect program memory address range in
+                     * the target descriptor, etc.), or the user has an invalid instruction in their program code.
+                     *
+                     * We have no choice but to intercept the instruction. When we reach it, we'll perform a single
+                     * step and see what happens.
+                     */
+                    Logger::debug(
+                        "Intercepting CCPF instruction (\"" + instruction->name + "\") with invalid destination "
+                            "byte address (0x" + StringService::toHex(*destinationAddress) + "), at byte address 0x"
+                            + StringService::toHex(instructionAddress)
+                    );
+                    output.insert(instructionAddress);
+                    continue;
+                }
+
+                if (
+                    *destinationAddress < stepAddressRange.startAddress
+                    || *destinationAddress >= stepAddressRange.endAddress
+                ) {
+                    /*
+                     * This instruction may jump to an address outside the requested stepping range.
+                     *
+                     * Because we know exactly where it will jump to (if it jumps), we only need to intercept the
+                     * destination address.
+                     */
+                    Logger::debug(
+                        "Intercepting destination byte address 0x" + StringService::toHex(*destinationAddress)
+                            + " of CCPF instruction (\"" + instruction->name + "\") at byte address 0x"
+                            + StringService::toHex(instructionAddress)
+                    );
+                    output.insert(*destinationAddress);
+                }
+            }
+        }
+
+        return output;
+    }
 }
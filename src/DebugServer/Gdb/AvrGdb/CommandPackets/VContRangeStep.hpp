@@ -1,11 +1,14 @@
 #pragma once
 
 #include <cstdint>
+#include <set>
 
 #include "AvrGdbCommandPacketInterface.hpp"
 #include "src/DebugServer/Gdb/CommandPackets/CommandPacket.hpp"
 
 #include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetMemoryAddressRange.hpp"
+#include "src/Targets/Microchip/Avr8/OpcodeDecoder/Decoder.hpp"
 
 namespace DebugServer::Gdb::AvrGdb::CommandPackets
 {
@@ -31,5 +34,23 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
             const Targets::TargetState& targetState,
             Services::TargetControllerService& targetControllerService
         ) override;
+
+    private:
+        /**
+         * Determines which addresses must be intercepted, in order to detect the target leaving the stepping range.
+         *
+         * @param stepAddressRange
+         * @param programMemoryAddressRange
+         *
+         * @param instructionsByAddress
+         *  The decoded instructions within the stepping range.
+         *
+         * @return
+         */
+        static std::set<Targets::TargetMemoryAddress> resolveInterceptedAddresses(
+            const Targets::TargetMemoryAddressRange& stepAddressRange,
+            const Targets::TargetMemoryAddressRange& programMemoryAddressRange,
+            const Targets::Microchip::Avr8::OpcodeDecoder::Decoder::InstructionMapping& instructionsByAddress
+        );
     };
 }
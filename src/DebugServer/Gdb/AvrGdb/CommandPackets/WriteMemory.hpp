@@ -12,8 +12,8 @@
 namespace DebugServer::Gdb::AvrGdb::CommandPackets
 {
     /**
-     * The WriteMemory class implements the structure for "M" packets. Upon receiving this packet, the server is
-     * expected to write data to the target's memory, at the specified start address.
+     * The WriteMemory class implements the structure for "M" and "X" (binary) packets. Upon receiving this packet, the
+     * server is expected to write data to the target's memory, at the specified start address.
      */
     class WriteMemory
         : public CommandPackets::AvrGdbCommandPacketInterface
@@ -44,6 +44,10 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
         };
 
         static PacketData extractPacketData(const RawPacket& rawPacket);
-        WriteMemory(const RawPacket& rawPacket, const AvrGdbTargetDescriptor& gdbTargetDescriptor, PacketData&& packetData);
+        WriteMemory(
+            const RawPacket& rawPacket,
+            const AvrGdbTargetDescriptor& gdbTargetDescriptor,
+            PacketData&& packetData
+        );
     };
 }
@@ -86,18 +86,13 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
                 return;
             }
 
-            const auto gdbRegisterDescriptorIt = gdbTargetDescriptor.gdbRegisterDescriptorsById.find(this->registerId);
-            const auto targetRegisterDescriptorIt = gdbTargetDescriptor.targetRegisterDescriptorsByGdbId.find(
-                this->registerId
-            );
-            if (
-                gdbRegisterDescriptorIt == gdbTargetDescriptor.gdbRegisterDescriptorsById.end()
-                || targetRegisterDescriptorIt == gdbTargetDescriptor.targetRegisterDescriptorsByGdbId.end()
-            ) {
+            const auto gdbRegisterDescriptor = gdbTargetDescriptor.tryGetRegisterDescriptor(this->registerId);
+            const auto targetRegisterDescriptor = gdbTargetDescriptor.tryGetTargetRegisterDescriptor(this->registerId);
+            if (!gdbRegisterDescriptor.has_value() || !targetRegisterDescriptor.has_value()) {
                 throw Exception{"Unknown GDB register ID (" + std::to_string(this->registerId) + ")"};
             }
 
-            targetControllerService.writeRegister(*(targetRegisterDescriptorIt->second), this->registerValue);
+            targetControllerService.writeRegister(targetRegisterDescriptor->get(), this->registerValue);
             debugSession.connection.writePacket(OkResponsePacket{});
 
         } catch (const Exception& exception) {
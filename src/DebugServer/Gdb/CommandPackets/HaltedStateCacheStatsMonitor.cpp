@@ -0,0 +1,75 @@
+#include "HaltedStateCacheStatsMonitor.hpp"
+
+#include <string>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+    using Services::StringService;
+
+    using ResponsePackets::ErrorResponsePacket;
+    using ResponsePackets::ResponsePacket;
+
+    using Exceptions::Exception;
+
+    HaltedStateCacheStatsMonitor::HaltedStateCacheStatsMonitor(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {}
+
+    void HaltedStateCacheStatsMonitor::handle(
+        DebugSession& debugSession,
+        const TargetDescriptor&,
+        const Targets::TargetDescriptor&,
+        TargetControllerService& targetControllerService
+    ) {
+        Logger::info("Handling HaltedStateCacheStatsMonitor packet");
+
+        try {
+            const auto stats = targetControllerService.getHaltedStateCacheStats();
+
+            static const auto hitRate = [] (std::uint64_t hits, std::uint64_t misses) {
+                const auto total = hits + misses;
+                return total > 0 ? std::to_string((hits * 100) / total) + "%" : std::string{"-"};
+            };
+
+            auto output = std::string{"\nHalted state cache:\n\n"};
+            output += "Memory reads:    " + StringService::applyTerminalColor(
+                std::to_string(stats.memoryReadHits),
+                StringService::TerminalColor::DARK_GREEN
+            ) + " hits, " + StringService::applyTerminalColor(
+                std::to_string(stats.memoryReadMisses),
+                StringService::TerminalColor::DARK_RED
+            ) + " misses (" + hitRate(stats.memoryReadHits, stats.memoryReadMisses) + " hit rate)\n";
+
+            output += "Register reads:  " + StringService::applyTerminalColor(
+                std::to_string(stats.registerReadHits),
+                StringService::TerminalColor::DARK_GREEN
+            ) + " hits, " + StringService::applyTerminalColor(
+                std::to_string(stats.registerReadMisses),
+                StringService::TerminalColor::DARK_RED
+            ) + " misses (" + hitRate(stats.registerReadHits, stats.registerReadMisses) + " hit rate)\n";
+
+            output += "Invalidations:   " + std::to_string(stats.invalidations) + "\n\n";
+
+            output += "Prefetches:      " + std::to_string(stats.prefetches) + " ("
+                + std::to_string(stats.prefetchedBytes) + " bytes), " + StringService::applyTerminalColor(
+                    std::to_string(stats.prefetchHits),
+                    StringService::TerminalColor::DARK_GREEN
+                ) + " reads serviced by prefetched data\n\n";
+
+            debugSession.connection.writePacket(ResponsePacket{StringService::toHex(output)});
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to obtain halted state cache stats - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket{});
+        }
+    }
+}
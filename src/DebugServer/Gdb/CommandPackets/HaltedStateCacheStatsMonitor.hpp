@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Monitor.hpp"
+
+namespace DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The HaltedStateCacheStatsMonitor class implements a structure for the "monitor cache" GDB command.
+     *
+     * We output the hit/miss counters of the TargetController's halted state cache.
+     */
+    class HaltedStateCacheStatsMonitor: public Monitor
+    {
+    public:
+        explicit HaltedStateCacheStatsMonitor(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            const TargetDescriptor& gdbTargetDescriptor,
+            const Targets::TargetDescriptor& targetDescriptor,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -52,6 +52,15 @@ namespace DebugServer::Gdb::CommandPackets
         output += StringService::applyTerminalColor("reset", CMD_COLOR) + "\n\n";
         output += leftPadding + "Resets the target and holds it in a stopped state.\n\n";
 
+        output += StringService::applyTerminalColor("cache", CMD_COLOR) + "\n\n";
+        output += leftPadding + "Outputs the hit/miss counters of the halted state cache (RAM, EEPROM and CPU register reads whilst the target is stopped).\n\n";
+
+        output += StringService::applyTerminalColor("programming", CMD_COLOR) + "\n\n";
+        output += leftPadding + "Outputs programming throughput figures (bytes written, erase/write time, USB transfers) for the last programming session, and for all sessions.\n\n";
+
+        output += StringService::applyTerminalColor("programming machine", CMD_COLOR) + "\n\n";
+        output += leftPadding + "Outputs programming throughput figures in JSON format.\n\n";
+
         output += StringService::applyTerminalColor("exit", CMD_COLOR) + "\n\n";
         output += leftPadding + "Triggers an immediate shutdown - Bloom will immediately disconnect from the target and debug tool before dropping the GDB connection\n\n";
 
@@ -62,7 +62,8 @@ namespace DebugServer::Gdb::CommandPackets
 
             const auto& registerGroupKey = this->commandArguments[2];
 
-            auto registerGroupDescriptorOpt = peripheralDescriptor.tryGetRegisterGroupDescriptor(
+            auto registerGroupDescriptorOpt = targetDescriptor.tryGetRegisterGroupDescriptor(
+                peripheralKey,
                 registerGroupKey
             );
 
@@ -0,0 +1,53 @@
+#include "ProgrammingStatsMachine.hpp"
+
+#include <QString>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+
+#include "src/Application.hpp"
+
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ErrorResponsePacket;
+    using ResponsePackets::ResponsePacket;
+
+    using Exceptions::Exception;
+
+    ProgrammingStatsMachine::ProgrammingStatsMachine(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {}
+
+    void ProgrammingStatsMachine::handle(
+        DebugSession& debugSession,
+        const TargetDescriptor&,
+        const Targets::TargetDescriptor&,
+        TargetControllerService& targetControllerService
+    ) {
+        Logger::info("Handling ProgrammingStatsMachine packet");
+
+        try {
+            const auto stats = targetControllerService.getProgrammingStats();
+
+            auto output = stats.toJson();
+            output.insert("version", QString::fromStdString(Application::VERSION.toString()));
+
+            debugSession.connection.writePacket(
+                ResponsePacket{Services::StringService::toHex(QJsonDocument{output}.toJson().toStdString())}
+            );
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to obtain programming stats - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket{});
+        }
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Monitor.hpp"
+
+#include "src/TargetController/ProgrammingStats.hpp"
+
+namespace DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The ProgrammingStatsMachine class implements a structure for the "monitor programming machine" GDB command.
+     *
+     * We output the TargetController's programming throughput figures in JSON format, for tracking throughput across
+     * builds and releases.
+     */
+    class ProgrammingStatsMachine: public Monitor
+    {
+    public:
+        explicit ProgrammingStatsMachine(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            const TargetDescriptor& gdbTargetDescriptor,
+            const Targets::TargetDescriptor& targetDescriptor,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
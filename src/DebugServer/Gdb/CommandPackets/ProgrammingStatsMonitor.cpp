@@ -0,0 +1,81 @@
+#include "ProgrammingStatsMonitor.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+    using Services::StringService;
+
+    using TargetController::ProgrammingSessionStats;
+
+    using ResponsePackets::ErrorResponsePacket;
+    using ResponsePackets::ResponsePacket;
+
+    using Exceptions::Exception;
+
+    ProgrammingStatsMonitor::ProgrammingStatsMonitor(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {}
+
+    void ProgrammingStatsMonitor::handle(
+        DebugSession& debugSession,
+        const TargetDescriptor&,
+        const Targets::TargetDescriptor&,
+        TargetControllerService& targetControllerService
+    ) {
+        Logger::info("Handling ProgrammingStatsMonitor packet");
+
+        try {
+            const auto stats = targetControllerService.getProgrammingStats();
+
+            if (!stats.lastSession.has_value()) {
+                debugSession.connection.writePacket(ResponsePacket{
+                    StringService::toHex(std::string{"\nNo programming sessions have been completed.\n\n"})
+                });
+                return;
+            }
+
+            auto output = std::string{"\nLast programming session:\n\n"};
+            output += ProgrammingStatsMonitor::sessionOutput(*(stats.lastSession));
+            output += "\nAll programming sessions (" + std::to_string(stats.sessionCount) + "):\n\n";
+            output += ProgrammingStatsMonitor::sessionOutput(stats.totals);
+            output += "\n";
+
+            debugSession.connection.writePacket(ResponsePacket{StringService::toHex(output)});
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to obtain programming stats - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket{});
+        }
+    }
+
+    std::string ProgrammingStatsMonitor::sessionOutput(const ProgrammingSessionStats& session) {
+        static const auto milliseconds = [] (std::chrono::microseconds duration) {
+            return std::to_string(duration.count() / 1000) + " ms";
+        };
+
+        auto output = std::string{};
+        output += "Requested:       " + std::to_string(session.requestedBytes) + " byte(s)\n";
+        output += "Written:         " + std::to_string(session.writtenBytes) + " byte(s), in "
+            + std::to_string(session.writeOperations) + " operation(s)\n";
+        output += "Erase:           " + std::to_string(session.eraseOperations) + " operation(s), "
+            + milliseconds(session.eraseDuration) + "\n";
+        output += "Write:           " + milliseconds(session.writeDuration) + "\n";
+        output += "Finalise:        " + milliseconds(session.finaliseDuration) + "\n";
+        output += "Total:           " + milliseconds(session.totalDuration) + "\n";
+        output += "USB transfers:   " + std::to_string(session.usbTransfers) + "\n";
+        output += "Throughput:      " + StringService::applyTerminalColor(
+            std::to_string(static_cast<std::uint64_t>(session.bytesPerSecond())) + " B/s",
+            StringService::TerminalColor::DARK_GREEN
+        ) + " effective, " + std::to_string(static_cast<std::uint64_t>(session.writeBytesPerSecond()))
+            + " B/s raw write\n";
+        return output;
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "Monitor.hpp"
+
+#include "src/TargetController/ProgrammingStats.hpp"
+
+namespace DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The ProgrammingStatsMonitor class implements a structure for the "monitor programming" GDB command.
+     *
+     * We output the TargetController's programming throughput figures, in a human-readable form. See
+     * ProgrammingStatsMachine for the JSON variant.
+     */
+    class ProgrammingStatsMonitor: public Monitor
+    {
+    public:
+        explicit ProgrammingStatsMonitor(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            const TargetDescriptor& gdbTargetDescriptor,
+            const Targets::TargetDescriptor& targetDescriptor,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        static std::string sessionOutput(const TargetController::ProgrammingSessionStats& session);
+    };
+}
@@ -70,7 +70,8 @@ namespace DebugServer::Gdb::CommandPackets
             const auto& registerGroupKey = this->commandArguments[2];
             auto registerKey = argCount >= 4 ? std::optional{this->commandArguments[3]} : std::nullopt;
 
-            auto registerGroupDescriptorOpt = peripheralDescriptor.tryGetRegisterGroupDescriptor(
+            auto registerGroupDescriptorOpt = targetDescriptor.tryGetRegisterGroupDescriptor(
+                peripheralKey,
                 registerGroupKey
             );
 
@@ -0,0 +1,63 @@
+#include "ReadTargetDescription.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/XferResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+    using Services::StringService;
+
+    using ResponsePackets::XferResponsePacket;
+    using ResponsePackets::ErrorResponsePacket;
+
+    using Exceptions::Exception;
+
+    ReadTargetDescription::ReadTargetDescription(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {
+        // The "qXfer:features:read:" prefix occupies 20 bytes
+        if (this->data.size() < 24) {
+            throw Exception{"Invalid packet length"};
+        }
+
+        /*
+         * The packet consists of the annex (document name), followed by an offset and a length. The annex is
+         * separated by a colon, and the offset and length are separated by a comma.
+         */
+        const auto command = std::string{this->data.begin() + 20, this->data.end()};
+
+        const auto colonPos = command.find_last_of(':');
+        const auto commaPos = command.find_last_of(',');
+        if (colonPos == std::string::npos || commaPos == std::string::npos || commaPos < colonPos) {
+            throw Exception{"Invalid packet"};
+        }
+
+        this->annex = command.substr(0, colonPos);
+        this->offset = StringService::toUint32(command.substr(colonPos + 1, commaPos - (colonPos + 1)), 16);
+        this->length = StringService::toUint32(command.substr(commaPos + 1), 16);
+    }
+
+    void ReadTargetDescription::handle(
+        DebugSession& debugSession,
+        const TargetDescriptor& gdbTargetDescriptor,
+        const Targets::TargetDescriptor&,
+        TargetControllerService&
+    ) {
+        Logger::info("Handling ReadTargetDescription packet");
+
+        if (this->annex != "target.xml" || !gdbTargetDescriptor.targetDescription.has_value()) {
+            Logger::debug("Unknown target description document requested (\"" + this->annex + "\")");
+            debugSession.connection.writePacket(ErrorResponsePacket{});
+            return;
+        }
+
+        debugSession.connection.writePacket(
+            XferResponsePacket{*(gdbTargetDescriptor.targetDescription), this->offset, this->length}
+        );
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "CommandPacket.hpp"
+
+namespace DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The ReadTargetDescription class implements a structure for the "qXfer:features:read:..." packet. Upon receiving
+     * this packet, the server is expected to respond with the requested target description document.
+     *
+     * We only provide a single document ("target.xml"). See TargetDescriptor::targetDescription.
+     */
+    class ReadTargetDescription: public CommandPacket
+    {
+    public:
+        /**
+         * The name of the requested document.
+         */
+        std::string annex;
+
+        /**
+         * The offset of the document, from which to read.
+         */
+        std::uint32_t offset = 0;
+
+        /**
+         * The length of the document to read.
+         */
+        std::uint32_t length = 0;
+
+        explicit ReadTargetDescription(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            const TargetDescriptor& gdbTargetDescriptor,
+            const Targets::TargetDescriptor& targetDescriptor,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
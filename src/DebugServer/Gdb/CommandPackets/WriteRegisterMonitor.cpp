@@ -60,7 +60,10 @@ namespace DebugServer::Gdb::CommandPackets
             const auto registerGroupKeyProvided = argCount >= 5;
             if (registerGroupKeyProvided) {
                 const auto& registerGroupKey = this->commandArguments[2];
-                registerGroupDescriptorOpt = peripheralDescriptor.tryGetRegisterGroupDescriptor(registerGroupKey);
+                registerGroupDescriptorOpt = targetDescriptor.tryGetRegisterGroupDescriptor(
+                    peripheralKey,
+                    registerGroupKey
+                );
                 if (!registerGroupDescriptorOpt.has_value()) {
                     throw Exception{"Unknown absolute register group key `" + registerGroupKey + "`"};
                 }
@@ -2,6 +2,7 @@
 
 #include <arpa/inet.h>
 #include <unistd.h>
+#include <poll.h>
 #include <cerrno>
 #include <fcntl.h>
 #include <algorithm>
@@ -11,7 +12,6 @@
 #include "Exceptions/ClientCommunicationError.hpp"
 
 #include "src/Exceptions/Exception.hpp"
-#include "src/Exceptions/InternalFatalErrorException.hpp"
 
 #include "src/Logger/Logger.hpp"
 #include "src/Services/StringService.hpp"
@@ -27,7 +27,22 @@ namespace DebugServer::Gdb
         : interruptEventNotifier(interruptEventNotifier)
     {
         this->accept(serverSocketFileDescriptor);
+        this->init();
+    }
+
+    Connection Connection::fromConnectedSocket(int socketFileDescriptor, EventFdNotifier& interruptEventNotifier) {
+        auto connection = Connection{interruptEventNotifier};
+        connection.socketFileDescriptor = socketFileDescriptor;
+        connection.init();
+
+        return connection;
+    }
+
+    Connection::~Connection() {
+        this->close();
+    }
 
+    void Connection::init() {
         ::fcntl(
             this->socketFileDescriptor.value(),
             F_SETFL,
@@ -41,10 +56,6 @@ namespace DebugServer::Gdb
         this->enableReadInterrupts();
     }
 
-    Connection::~Connection() {
-        this->close();
-    }
-
     std::string Connection::getIpAddress() const {
         auto ipAddress = std::array<char, INET_ADDRSTRLEN>{};
 
@@ -55,108 +66,215 @@ namespace DebugServer::Gdb
         return {ipAddress.data()};
     }
 
-    std::vector<RawPacket> Connection::readRawPackets() {
+    std::vector<RawPacket> Connection::readRawPackets(std::optional<std::chrono::milliseconds> timeout) {
         auto output = std::vector<RawPacket>{};
+        auto& buffer = this->receiveBuffer;
 
-        do {
-            const auto bytes = this->read();
-
-            auto bufferSize = bytes.size();
-            for (auto byteIndex = std::size_t{0}; byteIndex < bufferSize; byteIndex++) {
-                auto byte = bytes[byteIndex];
+        while (true) {
+            while (this->receiveBufferStart < this->receiveBufferEnd) {
+                const auto byte = buffer[this->receiveBufferStart];
 
                 if (byte == 0x03) {
-                    /*
-                     * This is an interrupt packet - it doesn't carry any of the usual packet frame bytes, so we'll
-                     * just add them here, in order to keep things consistent.
-                     *
-                     * Because we're effectively faking the packet frame, we can use any value for the checksum.
-                     */
-                    output.push_back({'$', byte, '#', 'F', 'F'});
+                    output.emplace_back(Connection::INTERRUPT_PACKET);
+                    ++(this->receiveBufferStart);
+                    continue;
+                }
+
+                if (byte != '$') {
+                    // Not the beginning of a packet - ignore
+                    ++(this->receiveBufferStart);
                     continue;
                 }
 
-                if (byte == '$') {
-                    // Beginning of packet
-                    RawPacket rawPacket;
-                    rawPacket.push_back('$');
-
-                    auto packetIndex = byteIndex;
-                    bool validPacket = false;
-                    bool isByteEscaped = false;
-
-                    for (packetIndex++; packetIndex < bufferSize; packetIndex++) {
-                        byte = bytes[packetIndex];
-
-                        if (byte == '}' && !isByteEscaped) {
-                            isByteEscaped = true;
-                            continue;
-                        }
-
-                        if (!isByteEscaped) {
-                            if (byte == '$') {
-                                // Unexpected end of packet
-                                break;
-                            }
-
-                            if (byte == '#') {
-                                // End of packet data
-                                if ((bufferSize - 1) < (packetIndex + 2)) {
-                                    // There should be at least two more bytes in the buffer, for the checksum.
-                                    break;
-                                }
-
-                                rawPacket.push_back(byte);
-
-                                // Add the checksum bytes and break the loop
-                                rawPacket.push_back(bytes[++packetIndex]);
-                                rawPacket.push_back(bytes[++packetIndex]);
-                                validPacket = true;
-                                break;
-                            }
-
-                        } else {
-                            // Escaped bytes are XOR'd with a 0x20 mask.
-                            byte ^= 0x20;
-                            isByteEscaped = false;
-                        }
-
-                        rawPacket.push_back(byte);
+                /*
+                 * Find the end of the packet data, without modifying the buffer. If we don't yet have the whole
+                 * packet, we leave it in the buffer, to be parsed after the next read.
+                 */
+                auto terminatorIndex = std::optional<std::size_t>{};
+                auto validPacket = true;
+                auto isByteEscaped = false;
+
+                for (auto index = this->receiveBufferStart + 1; index < this->receiveBufferEnd; ++index) {
+                    const auto packetByte = buffer[index];
+
+                    if (isByteEscaped) {
+                        isByteEscaped = false;
+                        continue;
                     }
 
-                    if (!validPacket) {
-                        Logger::warning("GDB client sent invalid packet data - ignoring");
+                    if (packetByte == '}') {
+                        isByteEscaped = true;
                         continue;
                     }
 
-                    Logger::debug(
-                        "Read GDB packet: "
-                            + Services::StringService::replaceUnprintable(
-                                std::string{rawPacket.begin(), rawPacket.end()}
-                            )
-                    );
+                    if (packetByte == '$') {
+                        // Unexpected end of packet
+                        validPacket = false;
+                        break;
+                    }
 
-                    if (this->packetAcknowledgement) {
-                        // Acknowledge receipt
-                        this->write({'+'});
+                    if (packetByte == '#') {
+                        terminatorIndex = index;
+                        break;
                     }
+                }
+
+                if (!validPacket) {
+                    Logger::warning("GDB client sent invalid packet data - ignoring");
+                    ++(this->receiveBufferStart);
+                    continue;
+                }
+
+                if (!terminatorIndex.has_value() || (*terminatorIndex + 2) >= this->receiveBufferEnd) {
+                    // We need at least two more bytes in the buffer, for the checksum.
+                    break;
+                }
 
-                    output.emplace_back(std::move(rawPacket));
-                    byteIndex = packetIndex;
+                /*
+                 * Unescape the packet data in place. Escaped bytes are XOR'd with a 0x20 mask. The data can only
+                 * shrink, so we'll never overwrite anything that we've yet to read.
+                 */
+                auto writeIndex = this->receiveBufferStart + 1;
+                isByteEscaped = false;
+
+                for (auto index = writeIndex; index < *terminatorIndex; ++index) {
+                    const auto packetByte = buffer[index];
+
+                    if (packetByte == '}' && !isByteEscaped) {
+                        isByteEscaped = true;
+                        continue;
+                    }
+
+                    buffer[writeIndex++] = isByteEscaped ? static_cast<unsigned char>(packetByte ^ 0x20) : packetByte;
+                    isByteEscaped = false;
                 }
+
+                // The terminator and checksum bytes
+                buffer[writeIndex] = '#';
+                buffer[writeIndex + 1] = buffer[*terminatorIndex + 1];
+                buffer[writeIndex + 2] = buffer[*terminatorIndex + 2];
+
+                const auto rawPacket = RawPacket{
+                    buffer.data() + this->receiveBufferStart,
+                    writeIndex + 3 - this->receiveBufferStart
+                };
+                this->receiveBufferStart = *terminatorIndex + 3;
+
+                Logger::debug(
+                    "Read GDB packet: "
+                        + Services::StringService::replaceUnprintable(std::string{rawPacket.begin(), rawPacket.end()})
+                );
+
+                if (this->packetAcknowledgement) {
+                    // Acknowledge receipt
+                    this->write(std::array<unsigned char, 1>{'+'});
+                }
+
+                output.emplace_back(rawPacket);
+            }
+
+            if (!output.empty()) {
+                return output;
             }
 
-        } while (output.empty());
+            if (this->receiveBufferStart == this->receiveBufferEnd) {
+                this->receiveBufferStart = 0;
+                this->receiveBufferEnd = 0;
 
-        return output;
+            } else if (this->receiveBufferEnd == buffer.size()) {
+                if (this->receiveBufferStart == 0) {
+                    /*
+                     * GDB should never send a packet this large (we tell it the maximum packet size). We assume the
+                     * worst and kill the connection.
+                     */
+                    throw ClientCommunicationError{"GDB packet exceeds maximum packet size"};
+                }
+
+                // Move the incomplete packet to the start of the buffer, to make room for the rest of it
+                std::copy(
+                    buffer.begin() + static_cast<long>(this->receiveBufferStart),
+                    buffer.begin() + static_cast<long>(this->receiveBufferEnd),
+                    buffer.begin()
+                );
+                this->receiveBufferEnd -= this->receiveBufferStart;
+                this->receiveBufferStart = 0;
+            }
+
+            if (this->read(true, timeout) == 0 && timeout.has_value()) {
+                return output;
+            }
+        }
     }
 
     void Connection::writePacket(const ResponsePacket& packet) {
-        const auto rawPacket = packet.toRawPacket();
+        static constexpr auto HEX_DIGITS = std::array<unsigned char, 16>{
+            '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+        };
+
+        const auto& payload = packet.getData();
+
+        /*
+         * Bytes that would otherwise be interpreted as part of the packet frame ('$' and '#'), the escape byte itself
+         * ('}'), and the run-length encoding marker ('*') must be escaped.
+         *
+         * We only copy the payload if it contains bytes that need escaping. This is rare for anything other than
+         * binary data (see BinaryMemoryResponsePacket).
+         */
+        auto escapedPayload = std::optional<std::vector<unsigned char>>{};
+        auto checksum = std::uint8_t{0};
+
+        for (auto byteIndex = std::size_t{0}; byteIndex < payload.size(); ++byteIndex) {
+            const auto byte = payload[byteIndex];
+
+            if (byte == '$' || byte == '#' || byte == '}' || byte == '*') {
+                if (!escapedPayload.has_value()) {
+                    escapedPayload = std::vector<unsigned char>{};
+                    escapedPayload->reserve(payload.size() + (payload.size() / 8));
+                    escapedPayload->insert(
+                        escapedPayload->end(),
+                        payload.begin(),
+                        payload.begin() + static_cast<long>(byteIndex)
+                    );
+                }
+
+                const auto escapedByte = static_cast<unsigned char>(byte ^ 0x20);
+                escapedPayload->push_back('}');
+                escapedPayload->push_back(escapedByte);
+                checksum += '}' + escapedByte;
+                continue;
+            }
+
+            if (escapedPayload.has_value()) {
+                escapedPayload->push_back(byte);
+            }
+
+            checksum += byte;
+        }
 
-        Logger::debug("Writing GDB packet: " + std::string{rawPacket.begin(), rawPacket.end()});
+        const auto& framedPayload = escapedPayload.has_value() ? *escapedPayload : payload;
+        auto packetStart = std::array<unsigned char, 1>{'$'};
+        auto packetEnd = std::array<unsigned char, 3>{'#', HEX_DIGITS[checksum >> 4], HEX_DIGITS[checksum & 0x0F]};
 
-        this->write(rawPacket);
+        Logger::debug(
+            "Writing GDB packet: $"
+                + Services::StringService::replaceUnprintable(std::string{framedPayload.begin(), framedPayload.end()})
+                + std::string{packetEnd.begin(), packetEnd.end()}
+        );
+
+        const auto writeFramedPacket = [&] {
+            auto buffers = std::array<::iovec, 3>{
+                ::iovec{.iov_base = packetStart.data(), .iov_len = packetStart.size()},
+                ::iovec{
+                    .iov_base = const_cast<unsigned char*>(framedPayload.data()),
+                    .iov_len = framedPayload.size()
+                },
+                ::iovec{.iov_base = packetEnd.data(), .iov_len = packetEnd.size()},
+            };
+
+            this->write(buffers);
+        };
+
+        writeFramedPacket();
 
         if (this->packetAcknowledgement) {
             auto attempts = std::size_t{0};
@@ -171,7 +289,7 @@ namespace DebugServer::Gdb
                 if (ackByte == '-') {
                     // GDB has requested retransmission
                     Logger::debug("Sending packet again, upon GDB's request");
-                    this->write(rawPacket);
+                    writeFramedPacket();
                 }
 
                 ackByte = this->readSingleByte(false);
@@ -203,17 +321,7 @@ namespace DebugServer::Gdb
         }
     }
 
-    std::vector<unsigned char> Connection::read(
-        std::optional<std::size_t> bytes,
-        bool interruptible,
-        std::optional<std::chrono::milliseconds> timeout
-    ) {
-        if (bytes.has_value() && *bytes > Connection::ABSOLUTE_MAXIMUM_PACKET_READ_SIZE) {
-            throw InternalFatalErrorException{"Attempted to read too many bytes from GDB socket"};
-        }
-
-        auto output = std::vector<unsigned char>{};
-
+    std::size_t Connection::read(bool interruptible, std::optional<std::chrono::milliseconds> timeout) {
         if (this->readInterruptEnabled != interruptible) {
             if (interruptible) {
                 this->enableReadInterrupts();
@@ -230,7 +338,7 @@ namespace DebugServer::Gdb
 
         if (!eventFileDescriptor.has_value()) {
             // Timed out
-            return output;
+            return 0;
         }
 
         if (eventFileDescriptor.value() == this->interruptEventNotifier.getFileDescriptor()) {
@@ -239,16 +347,17 @@ namespace DebugServer::Gdb
             throw DebugServerInterrupted{};
         }
 
-        const auto bytesToRead = bytes.value_or(Connection::ABSOLUTE_MAXIMUM_PACKET_READ_SIZE);
-        output.resize(bytesToRead, 0x00);
-
         const auto bytesRead = ::read(
             this->socketFileDescriptor.value(),
-            output.data(),
-            bytesToRead
+            this->receiveBuffer.data() + this->receiveBufferEnd,
+            this->receiveBuffer.size() - this->receiveBufferEnd
         );
 
         if (bytesRead < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+                return 0;
+            }
+
             throw ClientCommunicationError{
                 "Failed to read data from GDB client - error code: " + std::to_string(errno)
             };
@@ -259,34 +368,82 @@ namespace DebugServer::Gdb
             throw ClientDisconnected{};
         }
 
-        if (bytesRead != output.size()) {
-            output.resize(static_cast<unsigned long>(std::max(ssize_t{0}, bytesRead)));
-        }
-
-        return output;
+        this->receiveBufferEnd += static_cast<std::size_t>(bytesRead);
+        return static_cast<std::size_t>(bytesRead);
     }
 
     std::optional<unsigned char> Connection::readSingleByte(bool interruptible) {
-        auto bytes = this->read(1, interruptible, std::chrono::milliseconds{300});
+        if (this->receiveBufferStart == this->receiveBufferEnd) {
+            this->receiveBufferStart = 0;
+            this->receiveBufferEnd = 0;
 
-        if (!bytes.empty()) {
-            return bytes.front();
+            if (this->read(interruptible, std::chrono::milliseconds{300}) == 0) {
+                return std::nullopt;
+            }
         }
 
-        return std::nullopt;
+        return this->receiveBuffer[this->receiveBufferStart++];
     }
 
-    void Connection::write(const std::vector<unsigned char>& buffer) {
-        if (::write(this->socketFileDescriptor.value(), buffer.data(), buffer.size()) == -1) {
-            if (errno == EPIPE || errno == ECONNRESET) {
-                // Connection was closed
-                throw ClientDisconnected{};
+    void Connection::write(std::span<const unsigned char> buffer) {
+        auto buffers = std::array<::iovec, 1>{
+            ::iovec{.iov_base = const_cast<unsigned char*>(buffer.data()), .iov_len = buffer.size()}
+        };
+
+        this->write(buffers);
+    }
+
+    void Connection::write(std::span<::iovec> buffers) {
+        auto bufferIt = buffers.begin();
+
+        while (bufferIt != buffers.end()) {
+            const auto bytesWritten = ::writev(
+                this->socketFileDescriptor.value(),
+                &*bufferIt,
+                static_cast<int>(std::distance(bufferIt, buffers.end()))
+            );
+
+            if (bytesWritten < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    // The socket's send buffer is full - wait for the client to catch up
+                    auto pollDescriptor = ::pollfd{
+                        .fd = this->socketFileDescriptor.value(),
+                        .events = POLLOUT,
+                        .revents = 0
+                    };
+
+                    if (::poll(&pollDescriptor, 1, 5000) <= 0) {
+                        throw ClientCommunicationError{"Timed out waiting for GDB client to accept data"};
+                    }
+
+                    continue;
+                }
+
+                if (errno == EPIPE || errno == ECONNRESET) {
+                    // Connection was closed
+                    throw ClientDisconnected{};
+                }
+
+                throw ClientCommunicationError{
+                    "Failed to write data to GDB client socket - error no: " + std::to_string(errno)
+                };
             }
 
-            throw ClientCommunicationError{
-                "Failed to write " + std::to_string(buffer.size()) + " bytes to GDP client socket - error no: "
-                    + std::to_string(errno)
-            };
+            // Skip over the buffers that have been written in full, and adjust the one that was partially written
+            auto remainingBytes = static_cast<std::size_t>(bytesWritten);
+            while (bufferIt != buffers.end() && remainingBytes >= bufferIt->iov_len) {
+                remainingBytes -= bufferIt->iov_len;
+                ++bufferIt;
+            }
+
+            if (bufferIt != buffers.end() && remainingBytes > 0) {
+                bufferIt->iov_base = static_cast<unsigned char*>(bufferIt->iov_base) + remainingBytes;
+                bufferIt->iov_len -= remainingBytes;
+            }
         }
     }
 
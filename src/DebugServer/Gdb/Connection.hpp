@@ -1,6 +1,7 @@
 #pragma once
 
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <cstdint>
 #include <utility>
@@ -8,6 +9,7 @@
 #include <vector>
 #include <queue>
 #include <array>
+#include <span>
 #include <chrono>
 
 #include "src/Helpers/EventFdNotifier.hpp"
@@ -20,6 +22,10 @@ namespace DebugServer::Gdb
 {
     /**
      * The Connection class represents an active connection between the GDB RSP server and client.
+     *
+     * Incoming data is read directly into a receive buffer, where packets are parsed and unescaped in place. Packets
+     * are handed out as views (RawPacket) into the receive buffer, so there's no copying on the way in. Outgoing
+     * packets are written with a single ::writev() call, from the response packet's own payload.
      */
     class Connection
     {
@@ -35,6 +41,17 @@ namespace DebugServer::Gdb
 
         Connection(int serverSocketFileDescriptor, EventFdNotifier& interruptEventNotifier);
 
+        /**
+         * Constructs a connection from a socket that is already connected to the client (e.g. one end of a
+         * socketpair). The connection takes ownership of the socket.
+         *
+         * @param socketFileDescriptor
+         * @param interruptEventNotifier
+         *
+         * @return
+         */
+        static Connection fromConnectedSocket(int socketFileDescriptor, EventFdNotifier& interruptEventNotifier);
+
         Connection() = delete;
         Connection(const Connection&) = delete;
         Connection& operator = (Connection&) = delete;
@@ -49,6 +66,9 @@ namespace DebugServer::Gdb
             , interruptEventNotifier(other.interruptEventNotifier)
             , epollInstance(std::move(other.epollInstance))
             , readInterruptEnabled(other.readInterruptEnabled)
+            , receiveBuffer(std::move(other.receiveBuffer))
+            , receiveBufferStart(other.receiveBufferStart)
+            , receiveBufferEnd(other.receiveBufferEnd)
         {
             other.socketFileDescriptor = std::nullopt;
         }
@@ -65,9 +85,16 @@ namespace DebugServer::Gdb
         /**
          * Waits for incoming data from the client and returns the raw GDB packets.
          *
+         * The returned packets are views into this connection's receive buffer. They're only valid until the next
+         * read from the connection (including the reading of acknowledgements, in Connection::writePacket()).
+         *
+         * @param timeout
+         *  If supplied, we'll give up waiting for a complete packet after this period, and return an empty vector.
+         *  A timeout of 0 will only collect packets that have already been received.
+         *
          * @return
          */
-        std::vector<RawPacket> readRawPackets();
+        std::vector<RawPacket> readRawPackets(std::optional<std::chrono::milliseconds> timeout = std::nullopt);
 
         /**
          * Sends a response packet to the client.
@@ -98,6 +125,37 @@ namespace DebugServer::Gdb
 
         bool readInterruptEnabled = false;
 
+        /**
+         * Interrupts don't carry any of the usual packet frame bytes, so we fake the packet frame, to keep things
+         * consistent. Because we're faking the packet frame, we can use any value for the checksum.
+         */
+        static constexpr auto INTERRUPT_PACKET = std::array<unsigned char, 5>{'$', 0x03, '#', 'F', 'F'};
+
+        /**
+         * Data is read from the socket into the receive buffer, between receiveBufferEnd and the end of the buffer.
+         * Data that has yet to be consumed lives between receiveBufferStart and receiveBufferEnd.
+         *
+         * Once all data has been consumed, both offsets are reset to 0. Incomplete packets are left in place until
+         * the rest of the packet arrives. If we run out of space at the end of the buffer, the incomplete packet is
+         * moved to the start of the buffer.
+         */
+        std::vector<unsigned char> receiveBuffer = std::vector<unsigned char>(
+            Connection::ABSOLUTE_MAXIMUM_PACKET_READ_SIZE,
+            0x00
+        );
+        std::size_t receiveBufferStart = 0;
+        std::size_t receiveBufferEnd = 0;
+
+        explicit Connection(EventFdNotifier& interruptEventNotifier)
+            : interruptEventNotifier(interruptEventNotifier)
+        {}
+
+        /**
+         * Prepares the connected socket for use - switches it to non-blocking mode and registers it, along with the
+         * interrupt notifier, with the epoll instance.
+         */
+        void init();
+
         /**
          * Accepts a connection on serverSocketFileDescriptor.
          *
@@ -111,10 +169,7 @@ namespace DebugServer::Gdb
         void close() noexcept;
 
         /**
-         * Reads data from the client into a raw buffer.
-         *
-         * @param bytes
-         *  Number of bytes to read.
+         * Reads any available data from the client into the receive buffer.
          *
          * @param interruptible
          *  If this flag is set to false, no other component within Bloom will be able to gracefully interrupt
@@ -125,15 +180,12 @@ namespace DebugServer::Gdb
          *  The timeout in milliseconds. If not supplied, no timeout will be applied.
          *
          * @return
+         *  The number of bytes read. 0 if the timeout was reached.
          */
-        std::vector<unsigned char> read(
-            std::optional<std::size_t> bytes = std::nullopt,
-            bool interruptible = true,
-            std::optional<std::chrono::milliseconds> timeout = std::nullopt
-        );
+        std::size_t read(bool interruptible = true, std::optional<std::chrono::milliseconds> timeout = std::nullopt);
 
         /**
-         * Does the same as Connection::read(), but only reads a single byte.
+         * Consumes a single byte from the receive buffer, reading from the client if the receive buffer is empty.
          *
          * @param interruptible
          *  See Connection::read().
@@ -147,7 +199,16 @@ namespace DebugServer::Gdb
          *
          * @param buffer
          */
-        void write(const std::vector<unsigned char>& buffer);
+        void write(std::span<const unsigned char> buffer);
+
+        /**
+         * Writes data from multiple buffers to the client connection, via ::writev(). Partial writes are resumed
+         * until all data has been written.
+         *
+         * @param buffers
+         *  The buffers to write. The iovec objects are modified to track partial writes.
+         */
+        void write(std::span<::iovec> buffers);
 
         /**
          * Removes this->interruptEventNotifier's file descriptor from the EpollInstance (this->epollInstance),
@@ -10,6 +10,7 @@
 #include "Feature.hpp"
 #include "ProgrammingSession.hpp"
 #include "RangeSteppingSession.hpp"
+#include "RangeSteppingPlanCache.hpp"
 
 #include "src/Targets/TargetMemory.hpp"
 #include "src/Targets/TargetAddressSpaceDescriptor.hpp"
@@ -90,6 +91,12 @@ namespace DebugServer::Gdb
          */
         std::optional<RangeSteppingSession> activeRangeSteppingSession = std::nullopt;
 
+        /**
+         * Intercepted addresses from previous range stepping sessions, to save us from decoding the same stepping
+         * range repeatedly. See RangeSteppingPlanCache for more.
+         */
+        RangeSteppingPlanCache rangeSteppingPlanCache;
+
         DebugSession(
             Connection&& connection,
             const std::set<std::pair<Feature, std::optional<std::string>>>& supportedFeatures,
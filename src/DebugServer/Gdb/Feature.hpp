@@ -12,6 +12,8 @@ namespace DebugServer::Gdb
         MEMORY_MAP_READ,
         VCONT_ACTIONS_QUERY,
         NO_ACK_MODE,
+        BINARY_MEMORY_READ,
+        TARGET_DESCRIPTION_READ,
     };
 
     static inline BiMap<Feature, std::string> getGdbFeatureToNameMapping() {
@@ -22,6 +24,8 @@ namespace DebugServer::Gdb
             {Feature::MEMORY_MAP_READ, "qXfer:memory-map:read"},
             {Feature::VCONT_ACTIONS_QUERY, "vContSupported"},
             {Feature::NO_ACK_MODE, "QStartNoAckMode"},
+            {Feature::BINARY_MEMORY_READ, "binary-upload"},
+            {Feature::TARGET_DESCRIPTION_READ, "qXfer:features:read"},
         };
     }
 }
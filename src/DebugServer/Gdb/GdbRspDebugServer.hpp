@@ -5,6 +5,7 @@
 #include <arpa/inet.h>
 #include <vector>
 #include <queue>
+#include <deque>
 #include <variant>
 #include <functional>
 #include <optional>
@@ -26,6 +27,7 @@
 #include "CommandPackets/CommandPacket.hpp"
 #include "CommandPackets/CommandPacket.hpp"
 #include "CommandPackets/SupportedFeaturesQuery.hpp"
+#include "CommandPackets/ReadTargetDescription.hpp"
 #include "CommandPackets/InterruptExecution.hpp"
 #include "CommandPackets/ContinueExecution.hpp"
 #include "CommandPackets/StepExecution.hpp"
@@ -34,6 +36,9 @@
 #include "CommandPackets/HelpMonitorInfo.hpp"
 #include "CommandPackets/BloomVersion.hpp"
 #include "CommandPackets/BloomVersionMachine.hpp"
+#include "CommandPackets/HaltedStateCacheStatsMonitor.hpp"
+#include "CommandPackets/ProgrammingStatsMonitor.hpp"
+#include "CommandPackets/ProgrammingStatsMachine.hpp"
 #include "CommandPackets/Detach.hpp"
 #include "CommandPackets/ListRegistersMonitor.hpp"
 #include "CommandPackets/ReadRegistersMonitor.hpp"
@@ -84,6 +89,7 @@ namespace DebugServer::Gdb
             const DebugServerConfig& debugServerConfig,
             const Targets::TargetDescriptor& targetDescriptor,
             GdbTargetDescriptorType&& gdbTargetDescriptor,
+            const Services::TargetControllerService& targetControllerService,
             EventListener& eventListener,
             EventFdNotifier& eventNotifier
         )
@@ -93,6 +99,7 @@ namespace DebugServer::Gdb
             , gdbTargetDescriptor(std::move(gdbTargetDescriptor))
             , eventListener(eventListener)
             , interruptEventNotifier(eventNotifier)
+            , targetControllerService(targetControllerService)
             , targetState(this->targetControllerService.getTargetState())
         {}
 
@@ -291,7 +298,7 @@ namespace DebugServer::Gdb
          */
         EpollInstance epollInstance = {};
 
-        Services::TargetControllerService targetControllerService = {};
+        Services::TargetControllerService targetControllerService;
 
         const Targets::TargetState& targetState;
 
@@ -324,6 +331,7 @@ namespace DebugServer::Gdb
                 }
             }
 
+            this->pendingCommandPackets.clear();
             this->debugSession.reset();
         }
 
@@ -344,39 +352,76 @@ namespace DebugServer::Gdb
             return {this->serverSocketFileDescriptor.value(), this->interruptEventNotifier};
         }
 
+        using CommandPacketVariant = std::variant<
+            std::unique_ptr<CommandPacketType>,
+            std::unique_ptr<CommandPackets::CommandPacket>
+        >;
+
+        /**
+         * Command packets that have been received from the client, but are yet to be handled, in the order in which
+         * they were received.
+         *
+         * Packets are decoded as soon as they're read from the connection. If the client sends multiple packets
+         * before we've responded to the first (which it may do in no-ack mode), they're all queued here and handled
+         * in order, with any events dispatched in between.
+         */
+        std::deque<CommandPacketVariant> pendingCommandPackets;
+
         /**
          * Waits for a command packet from the connected GDB client.
          *
-         * This function will first attempt to construct a server-implementation-specific command packet, but if that
-         * yields nothing, it will fall back to a generic command packet.
+         * If there are pending command packets, the next one is returned without blocking.
          *
          * @return
          */
-        std::variant<
-            std::unique_ptr<CommandPacketType>,
-            std::unique_ptr<CommandPackets::CommandPacket>
-        > waitForCommandPacket() {
-            const auto rawPackets = this->debugSession->connection.readRawPackets();
-            assert(!rawPackets.empty());
+        CommandPacketVariant waitForCommandPacket() {
+            if (this->pendingCommandPackets.empty()) {
+                this->queueCommandPackets(this->debugSession->connection.readRawPackets());
+            }
+
+            /*
+             * Collect any further packets that have already arrived, without blocking, so that they're decoded
+             * before we begin servicing the current one.
+             */
+            this->queueCommandPackets(this->debugSession->connection.readRawPackets(std::chrono::milliseconds{0}));
+
+            assert(!this->pendingCommandPackets.empty());
+            auto commandPacket = std::move(this->pendingCommandPackets.front());
+            this->pendingCommandPackets.pop_front();
 
-            if (rawPackets.size() > 1) {
-                const auto& firstRawPacket = rawPackets.front();
+            return commandPacket;
+        }
 
-                if (firstRawPacket.size() == 5 && firstRawPacket[1] == 0x03) {
+        /**
+         * Decodes the given raw packets and adds them to the pending command packet queue.
+         *
+         * This function will first attempt to construct a server-implementation-specific command packet, but if that
+         * yields nothing, it will fall back to a generic command packet.
+         *
+         * @param rawPackets
+         */
+        void queueCommandPackets(const std::vector<RawPacket>& rawPackets) {
+            for (auto packetIt = rawPackets.begin(); packetIt != rawPackets.end(); ++packetIt) {
+                const auto& rawPacket = *packetIt;
+
+                if (
+                    rawPacket.size() == 5
+                    && rawPacket[1] == 0x03
+                    && (std::next(packetIt) != rawPackets.end() || !this->pendingCommandPackets.empty())
+                ) {
                     // Interrupt packet that came in too quickly before another packet
                     this->debugSession->pendingInterrupt = true;
+                    continue;
+                }
 
-                } else {
-                    Logger::warning("Multiple packets received from GDB - only the most recent will be processed");
+                auto commandPacket = this->rawPacketToCommandPacket(rawPacket);
+                if (commandPacket) {
+                    this->pendingCommandPackets.emplace_back(std::move(commandPacket));
+                    continue;
                 }
-            }
 
-            auto commandPacket = this->rawPacketToCommandPacket(rawPackets.back());
-            if (commandPacket) {
-                return commandPacket;
+                this->pendingCommandPackets.emplace_back(this->rawPacketToGenericCommandPacket(rawPacket));
             }
-
-            return this->rawPacketToGenericCommandPacket(rawPackets.back());
         }
 
         /**
@@ -423,6 +468,10 @@ namespace DebugServer::Gdb
                 return std::make_unique<CommandPackets::SupportedFeaturesQuery>(rawPacket);
             }
 
+            if (rawPacketString.find("qXfer:features:read:") == 0) {
+                return std::make_unique<CommandPackets::ReadTargetDescription>(rawPacket);
+            }
+
             if (rawPacketString.find("vCont;c") == 0 || rawPacketString.find("vCont;C") == 0) {
                 return std::make_unique<CommandPackets::VContContinueExecution>(rawPacket);
             }
@@ -447,6 +496,24 @@ namespace DebugServer::Gdb
                     return std::make_unique<CommandPackets::BloomVersionMachine>(std::move(*(monitorCommand.release())));
                 }
 
+                if (monitorCommand->command == "cache") {
+                    return std::make_unique<CommandPackets::HaltedStateCacheStatsMonitor>(
+                        std::move(*(monitorCommand.release()))
+                    );
+                }
+
+                if (monitorCommand->command == "programming") {
+                    return std::make_unique<CommandPackets::ProgrammingStatsMonitor>(
+                        std::move(*(monitorCommand.release()))
+                    );
+                }
+
+                if (monitorCommand->command == "programming machine") {
+                    return std::make_unique<CommandPackets::ProgrammingStatsMachine>(
+                        std::move(*(monitorCommand.release()))
+                    );
+                }
+
                 if (monitorCommand->command == "reset") {
                     return std::make_unique<CommandPackets::ResetTarget>(std::move(*(monitorCommand.release())));
                 }
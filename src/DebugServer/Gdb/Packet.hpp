@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <span>
 #include <memory>
 #include <numeric>
 #include <QString>
@@ -9,7 +10,12 @@
 
 namespace DebugServer::Gdb
 {
-    using RawPacket = std::vector<unsigned char>;
+    /**
+     * A complete packet, including the packet frame ('$', '#' and the checksum), with the packet data unescaped.
+     *
+     * Raw packets are views into the Connection's receive buffer - see Connection::readRawPackets().
+     */
+    using RawPacket = std::span<const unsigned char>;
 
     /**
      * The Packet class implements the data structure for GDB RSP packets.
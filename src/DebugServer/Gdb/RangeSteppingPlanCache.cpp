@@ -0,0 +1,60 @@
+#include "RangeSteppingPlanCache.hpp"
+
+#include <algorithm>
+
+namespace DebugServer::Gdb
+{
+    std::optional<
+        std::reference_wrapper<const std::set<Targets::TargetMemoryAddress>>
+    > RangeSteppingPlanCache::find(
+        const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor,
+        const Targets::TargetMemoryAddressRange& range,
+        const Targets::TargetMemoryBuffer& programMemory
+    ) {
+        const auto entryIt = this->entriesByKey.find(
+            Key{memorySegmentDescriptor.id, range.startAddress, range.endAddress}
+        );
+        if (entryIt == this->entriesByKey.end()) {
+            return std::nullopt;
+        }
+
+        auto& entry = entryIt->second;
+        if (entry.programMemory != programMemory) {
+            this->entriesByKey.erase(entryIt);
+            return std::nullopt;
+        }
+
+        entry.lastUse = ++(this->useCounter);
+        return std::cref(entry.interceptedAddresses);
+    }
+
+    void RangeSteppingPlanCache::insert(
+        const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor,
+        const Targets::TargetMemoryAddressRange& range,
+        Targets::TargetMemoryBuffer&& programMemory,
+        const std::set<Targets::TargetMemoryAddress>& interceptedAddresses
+    ) {
+        auto key = Key{memorySegmentDescriptor.id, range.startAddress, range.endAddress};
+
+        if (this->entriesByKey.size() >= RangeSteppingPlanCache::MAX_ENTRY_COUNT && !this->entriesByKey.contains(key)) {
+            const auto leastRecentlyUsedIt = std::min_element(
+                this->entriesByKey.begin(),
+                this->entriesByKey.end(),
+                [] (const auto& pairA, const auto& pairB) {
+                    return pairA.second.lastUse < pairB.second.lastUse;
+                }
+            );
+
+            this->entriesByKey.erase(leastRecentlyUsedIt);
+        }
+
+        this->entriesByKey.insert_or_assign(
+            std::move(key),
+            Entry{
+                .programMemory = std::move(programMemory),
+                .interceptedAddresses = interceptedAddresses,
+                .lastUse = ++(this->useCounter),
+            }
+        );
+    }
+}
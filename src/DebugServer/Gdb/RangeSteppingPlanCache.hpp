@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <map>
+#include <tuple>
+#include <optional>
+#include <functional>
+
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetMemoryAddressRange.hpp"
+#include "src/Targets/TargetMemorySegmentDescriptor.hpp"
+
+namespace DebugServer::Gdb
+{
+    /**
+     * Preparing a range stepping session involves decoding every instruction in the stepping range and resolving
+     * their destination addresses, to determine which addresses must be intercepted. GDB will often request the same
+     * range repeatedly (when stepping through a loop, or stepping over the same function more than once), so we cache
+     * the intercepted addresses of previous sessions here.
+     *
+     * Entries are keyed by memory segment and stepping range, and hold a copy of the program memory from which the
+     * intercepted addresses were derived. An entry is only used if the current program memory matches that copy, so
+     * any modification to the range (programming, software breakpoints, writes via Insight, etc.) invalidates the
+     * entry, without the cache having to be notified of the modification.
+     */
+    class RangeSteppingPlanCache
+    {
+    public:
+        /**
+         * The maximum number of entries to hold. Once exceeded, the least recently used entry is evicted.
+         */
+        static constexpr auto MAX_ENTRY_COUNT = std::size_t{64};
+
+        /**
+         * Looks up the intercepted addresses for the given stepping range.
+         *
+         * @param memorySegmentDescriptor
+         * @param range
+         *
+         * @param programMemory
+         *  The current contents of program memory, for the given range.
+         *
+         * @return
+         *  The cached intercepted addresses, or std::nullopt if there's no entry for the range, or the entry is stale
+         *  (the program memory has changed since the entry was created). Stale entries are removed.
+         */
+        std::optional<std::reference_wrapper<const std::set<Targets::TargetMemoryAddress>>> find(
+            const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor,
+            const Targets::TargetMemoryAddressRange& range,
+            const Targets::TargetMemoryBuffer& programMemory
+        );
+
+        void insert(
+            const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor,
+            const Targets::TargetMemoryAddressRange& range,
+            Targets::TargetMemoryBuffer&& programMemory,
+            const std::set<Targets::TargetMemoryAddress>& interceptedAddresses
+        );
+
+    private:
+        /**
+         * Memory segment ID, followed by the start and end addresses of the stepping range.
+         *
+         * We don't use TargetMemoryAddressRange in the key, as its ordering only considers the start address. Ranges
+         * that share a start address would otherwise map to the same entry.
+         */
+        using Key = std::tuple<
+            Targets::TargetMemorySegmentId,
+            Targets::TargetMemoryAddress,
+            Targets::TargetMemoryAddress
+        >;
+
+        struct Entry
+        {
+            Targets::TargetMemoryBuffer programMemory;
+            std::set<Targets::TargetMemoryAddress> interceptedAddresses;
+            std::uint64_t lastUse = 0;
+        };
+
+        std::map<Key, Entry> entriesByKey;
+        std::uint64_t useCounter = 0;
+    };
+}
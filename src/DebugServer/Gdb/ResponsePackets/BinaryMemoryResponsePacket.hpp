@@ -0,0 +1,24 @@
+#pragma once
+
+#include "ResponsePacket.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace DebugServer::Gdb::ResponsePackets
+{
+    /**
+     * Response to the binary memory read ("x") packet. The memory is sent in binary form, with a 'b' prefix.
+     *
+     * Any bytes that conflict with the packet frame are escaped when the packet is written - see
+     * Connection::writePacket().
+     */
+    class BinaryMemoryResponsePacket: public ResponsePacket
+    {
+    public:
+        explicit BinaryMemoryResponsePacket(Targets::TargetMemoryBufferSpan buffer)
+            : ResponsePacket(std::vector<unsigned char>{'b'})
+        {
+            this->data.insert(this->data.end(), buffer.begin(), buffer.end());
+        }
+    };
+}
@@ -24,10 +24,12 @@ namespace DebugServer::Gdb::ResponsePackets
         }
 
         /**
-         * Generates a raw packet.
+         * The packet data, prior to escaping and framing. See Connection::writePacket().
          *
          * @return
          */
-        [[nodiscard]] RawPacket toRawPacket() const;
+        [[nodiscard]] const std::vector<unsigned char>& getData() const {
+            return this->data;
+        }
     };
 }
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <algorithm>
+
+#include "ResponsePacket.hpp"
+
+namespace DebugServer::Gdb::ResponsePackets
+{
+    /**
+     * Response to "qXfer:<object>:read" packets. Carries a chunk of the requested document, starting at the given
+     * offset.
+     *
+     * The chunk is prefixed with 'l' if it reaches the end of the document, or 'm' if there's more to come.
+     */
+    class XferResponsePacket: public ResponsePacket
+    {
+    public:
+        XferResponsePacket(const std::string& document, std::uint32_t offset, std::uint32_t length)
+            : ResponsePacket(std::vector<unsigned char>{'l'})
+        {
+            if (offset >= document.size() || length == 0) {
+                return;
+            }
+
+            const auto chunkSize = std::min(static_cast<std::size_t>(length), document.size() - offset);
+
+            if ((offset + chunkSize) < document.size()) {
+                this->data[0] = 'm';
+            }
+
+            this->data.insert(
+                this->data.end(),
+                document.begin() + offset,
+                document.begin() + static_cast<long>(offset + chunkSize)
+            );
+        }
+    };
+}
@@ -6,6 +6,7 @@
 
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/BinaryMemoryResponsePacket.hpp"
 
 #include "src/Services/StringService.hpp"
 #include "src/Logger/Logger.hpp"
@@ -18,6 +19,7 @@ namespace DebugServer::Gdb::RiscVGdb::CommandPackets
 
     using ResponsePackets::ErrorResponsePacket;
     using ResponsePackets::ResponsePacket;
+    using ResponsePackets::BinaryMemoryResponsePacket;
 
     using Exceptions::Exception;
 
@@ -36,7 +38,13 @@ namespace DebugServer::Gdb::RiscVGdb::CommandPackets
 
         try {
             if (this->bytes == 0) {
-                debugSession.connection.writePacket(ResponsePacket{Targets::TargetMemoryBuffer{}});
+                if (this->binary) {
+                    debugSession.connection.writePacket(BinaryMemoryResponsePacket{Targets::TargetMemoryBuffer{}});
+
+                } else {
+                    debugSession.connection.writePacket(ResponsePacket{Targets::TargetMemoryBuffer{}});
+                }
+
                 return;
             }
 
@@ -99,6 +107,11 @@ namespace DebugServer::Gdb::RiscVGdb::CommandPackets
                 }
             }
 
+            if (this->binary) {
+                debugSession.connection.writePacket(BinaryMemoryResponsePacket{buffer});
+                return;
+            }
+
             debugSession.connection.writePacket(ResponsePacket{Services::StringService::toHex(buffer)});
 
         } catch (const Exception& exception) {
@@ -123,7 +136,8 @@ namespace DebugServer::Gdb::RiscVGdb::CommandPackets
 
         return {
             .gdbStartAddress = StringService::toUint32(command.substr(0, delimiterPos), 16),
-            .bytes = StringService::toUint32(command.substr(delimiterPos + 1), 16)
+            .bytes = StringService::toUint32(command.substr(delimiterPos + 1), 16),
+            .binary = rawPacket[1] == 'x'
         };
     }
 
@@ -136,5 +150,6 @@ namespace DebugServer::Gdb::RiscVGdb::CommandPackets
         , addressSpaceDescriptor(gdbTargetDescriptor.systemAddressSpaceDescriptor)
         , startAddress(packetData.gdbStartAddress)
         , bytes(packetData.bytes)
+        , binary(packetData.binary)
     {}
 }
@@ -21,6 +21,12 @@ namespace DebugServer::Gdb::RiscVGdb::CommandPackets
         Targets::TargetMemoryAddress startAddress;
         Targets::TargetMemorySize bytes;
 
+        /**
+         * True if this is a binary memory read ("x") packet, in which case the memory will be sent in binary form,
+         * as opposed to hex.
+         */
+        bool binary = false;
+
         ReadMemory(const RawPacket& rawPacket, const RiscVGdbTargetDescriptor& gdbTargetDescriptor);
 
         void handle(
@@ -36,6 +42,7 @@ namespace DebugServer::Gdb::RiscVGdb::CommandPackets
         {
             GdbMemoryAddress gdbStartAddress;
             std::uint32_t bytes;
+            bool binary;
         };
 
         static PacketData extractPacketData(const RawPacket& rawPacket);
@@ -1,6 +1,6 @@
 #include "ReadMemoryMap.hpp"
 
-#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/XferResponsePacket.hpp"
 
 #include "src/Services/StringService.hpp"
 #include "src/Exceptions/Exception.hpp"
@@ -10,7 +10,7 @@ namespace DebugServer::Gdb::RiscVGdb::CommandPackets
     using Services::TargetControllerService;
     using Services::StringService;
 
-    using ResponsePackets::ResponsePacket;
+    using ResponsePackets::XferResponsePacket;
 
     using Exceptions::Exception;
 
@@ -43,67 +43,10 @@ namespace DebugServer::Gdb::RiscVGdb::CommandPackets
         const Targets::TargetState& targetState,
         TargetControllerService& targetControllerService
     ) {
-        using Targets::TargetMemorySegmentType;
-
         Logger::info("Handling ReadMemoryMap packet");
 
-        static const auto gdbMemoryTypeFromSegment = [] (
-            const Targets::TargetMemorySegmentDescriptor& segmentDescriptor
-        ) -> std::optional<std::string> {
-            switch (segmentDescriptor.type) {
-                case TargetMemorySegmentType::FLASH:
-                case TargetMemorySegmentType::ALIASED: {
-                    return "flash";
-                }
-                case TargetMemorySegmentType::RAM:
-                case TargetMemorySegmentType::IO: {
-                    return "ram";
-                }
-                default: {
-                    return std::nullopt;
-                }
-            }
-        };
-
-        auto memoryMap = std::string{"<memory-map>\n"};
-
-        for (const auto& segmentDescriptor : gdbTargetDescriptor.systemAddressSpaceDescriptor.segmentDescriptorsByKey | std::views::values) {
-            const auto gdbMemType = gdbMemoryTypeFromSegment(segmentDescriptor);
-            if (!gdbMemType.has_value()) {
-                continue;
-            }
-
-            const auto segmentWritable = (
-                segmentDescriptor.debugModeAccess.writeable || segmentDescriptor.programmingModeAccess.writeable
-            );
-
-            memoryMap += "<memory type=\"" + (!segmentWritable ? "rom" : *gdbMemType) + "\" start=\"0x"
-                + StringService::toHex(segmentDescriptor.addressRange.startAddress) + "\" length=\""
-                + std::to_string(segmentDescriptor.size()) + "\"";
-
-            if (segmentWritable && segmentDescriptor.pageSize.has_value()) {
-                memoryMap += ">\n    <property name=\"blocksize\">" + std::to_string(*(segmentDescriptor.pageSize))
-                    + "</property>\n</memory>\n";
-            } else {
-                memoryMap += "/>\n";
-            }
-        }
-
-        memoryMap += "</memory-map>";
-
-        auto responseData = std::vector<unsigned char>{'l'};
-
-        if (this->offset < memoryMap.size() && this->length > 0) {
-            responseData.insert(
-                responseData.end(),
-                memoryMap.begin() + this->offset,
-                memoryMap.begin() + this->offset + std::min(
-                    static_cast<long>(this->length),
-                    static_cast<long>(memoryMap.size() - this->offset)
-                )
-            );
-        }
-
-        debugSession.connection.writePacket(ResponsePacket{responseData});
+        debugSession.connection.writePacket(
+            XferResponsePacket{gdbTargetDescriptor.memoryMap, this->offset, this->length}
+        );
     }
 }
@@ -36,23 +36,17 @@ namespace DebugServer::Gdb::RiscVGdb::CommandPackets
         Logger::info("Handling ReadRegisters packet");
 
         try {
-            const auto totalRegBytes = (gdbTargetDescriptor.targetRegisterDescriptorsByGdbId.size() + 1) * 4;
+            const auto totalRegBytes = (gdbTargetDescriptor.targetRegisterDescriptors.size() + 1) * 4;
             auto buffer = Targets::TargetMemoryBuffer(totalRegBytes, 0x00);
 
-            auto gpRegDescriptors = Targets::TargetRegisterDescriptors{};
-            std::transform(
-                gdbTargetDescriptor.targetRegisterDescriptorsByGdbId.begin(),
-                gdbTargetDescriptor.targetRegisterDescriptorsByGdbId.end(),
-                std::back_inserter(gpRegDescriptors),
-                [] (const auto& pair) {
-                    return pair.second;
-                }
-            );
-
             {
                 const auto atomicSession = targetControllerService.makeAtomicSession();
 
-                for (auto& [regDesc, regVal] : targetControllerService.readRegisters(gpRegDescriptors)) {
+                const auto registers = targetControllerService.readRegisters(
+                    gdbTargetDescriptor.targetRegisterDescriptors
+                );
+
+                for (const auto& [regDesc, regVal] : registers) {
                     const auto bufferOffset = (
                         regDesc.startAddress - gdbTargetDescriptor.gpRegistersMemorySegmentDescriptor.addressRange.startAddress
                     ) * gdbTargetDescriptor.gpRegistersMemorySegmentDescriptor.addressSpaceUnitSize;
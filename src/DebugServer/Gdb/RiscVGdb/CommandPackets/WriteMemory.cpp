@@ -102,9 +102,17 @@ namespace DebugServer::Gdb::RiscVGdb::CommandPackets
 
         const auto command = std::string{rawPacket.begin() + 2, rawPacket.end() - 3};
 
+        /*
+         * The address and length fields are hex encoded, so the first colon will always be the delimiter, even if the
+         * data is binary.
+         */
         const auto commaDelimiterPos = command.find_first_of(',');
         const auto colonDelimiterPos = command.find_first_of(':');
-        if (commaDelimiterPos == std::string::npos || colonDelimiterPos == std::string::npos) {
+        if (
+            commaDelimiterPos == std::string::npos
+            || colonDelimiterPos == std::string::npos
+            || colonDelimiterPos < commaDelimiterPos
+        ) {
             throw Exception{"Invalid packet"};
         }
 
@@ -114,7 +122,16 @@ namespace DebugServer::Gdb::RiscVGdb::CommandPackets
                 command.substr(commaDelimiterPos + 1, colonDelimiterPos - (commaDelimiterPos + 1)),
                 16
             ),
-            .buffer = StringService::dataFromHex(command.substr(colonDelimiterPos + 1))
+            /*
+             * Binary data in "X" packets will have already been unescaped by the Connection, so we can take it as
+             * is.
+             */
+            .buffer = rawPacket[1] == 'X'
+                ? Targets::TargetMemoryBuffer{
+                    rawPacket.begin() + 2 + static_cast<long>(colonDelimiterPos) + 1,
+                    rawPacket.end() - 3
+                }
+                : StringService::dataFromHex(command.substr(colonDelimiterPos + 1))
         };
     }
 
@@ -29,6 +29,7 @@ namespace DebugServer::Gdb::RiscVGdb
         const EnvironmentConfig& environmentConfig,
         const DebugServerConfig& debugServerConfig,
         const Targets::TargetDescriptor& targetDescriptor,
+        const Services::TargetControllerService& targetControllerService,
         EventListener& eventListener,
         EventFdNotifier& eventNotifier
     )
@@ -37,6 +38,7 @@ namespace DebugServer::Gdb::RiscVGdb
             debugServerConfig,
             targetDescriptor,
             RiscVGdbTargetDescriptor{targetDescriptor},
+            targetControllerService,
             eventListener,
             eventNotifier
         )
@@ -80,11 +82,11 @@ namespace DebugServer::Gdb::RiscVGdb
             return std::make_unique<WriteRegister>(rawPacket);
         }
 
-        if (rawPacket[1] == 'm') {
+        if (rawPacket[1] == 'm' || rawPacket[1] == 'x') {
             return std::make_unique<ReadMemory>(rawPacket, this->gdbTargetDescriptor);
         }
 
-        if (rawPacket[1] == 'M') {
+        if (rawPacket[1] == 'M' || rawPacket[1] == 'X') {
             return std::make_unique<WriteMemory>(rawPacket, this->gdbTargetDescriptor);
         }
 
@@ -129,6 +131,8 @@ namespace DebugServer::Gdb::RiscVGdb
             {Feature::SOFTWARE_BREAKPOINTS, std::nullopt},
             {Feature::MEMORY_MAP_READ, std::nullopt},
             {Feature::VCONT_ACTIONS_QUERY, std::nullopt},
+            {Feature::BINARY_MEMORY_READ, std::nullopt},
+            {Feature::TARGET_DESCRIPTION_READ, std::nullopt},
         };
 
         if (!this->debugServerConfig.packetAcknowledgement) {
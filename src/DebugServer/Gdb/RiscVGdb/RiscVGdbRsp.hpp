@@ -20,6 +20,7 @@ namespace DebugServer::Gdb::RiscVGdb
             const EnvironmentConfig& environmentConfig,
             const DebugServerConfig& debugServerConfig,
             const Targets::TargetDescriptor& targetDescriptor,
+            const Services::TargetControllerService& targetControllerService,
             EventListener& eventListener,
             EventFdNotifier& eventNotifier
         );
@@ -1,5 +1,8 @@
 #include "RiscVGdbTargetDescriptor.hpp"
 
+#include <ranges>
+
+#include "src/Services/StringService.hpp"
 #include "src/Exceptions/Exception.hpp"
 
 namespace DebugServer::Gdb::RiscVGdb
@@ -28,13 +31,86 @@ namespace DebugServer::Gdb::RiscVGdb
                 descriptor.startAddress - this->gpRegistersMemorySegmentDescriptor.addressRange.startAddress
             );
 
-            this->gdbRegisterDescriptorsById.emplace(gdbRegisterId, RegisterDescriptor{gdbRegisterId, 4});
-            this->targetRegisterDescriptorsByGdbId.emplace(gdbRegisterId, &descriptor);
+            this->addRegisterDescriptor(RegisterDescriptor{gdbRegisterId, 4}, &descriptor);
+        }
+
+        this->addRegisterDescriptor(RegisterDescriptor{this->programCounterGdbRegisterId, 4});
+
+        this->memoryMap = this->generateMemoryMap();
+        this->targetDescription = this->generateTargetDescription();
+    }
+
+    std::string RiscVGdbTargetDescriptor::generateMemoryMap() const {
+        using Targets::TargetMemorySegmentType;
+        using Services::StringService;
+
+        static const auto gdbMemoryTypeFromSegment = [] (
+            const Targets::TargetMemorySegmentDescriptor& segmentDescriptor
+        ) -> std::optional<std::string> {
+            switch (segmentDescriptor.type) {
+                case TargetMemorySegmentType::FLASH:
+                case TargetMemorySegmentType::ALIASED: {
+                    return "flash";
+                }
+                case TargetMemorySegmentType::RAM:
+                case TargetMemorySegmentType::IO: {
+                    return "ram";
+                }
+                default: {
+                    return std::nullopt;
+                }
+            }
+        };
+
+        auto memoryMap = std::string{"<memory-map>\n"};
+
+        for (const auto& segmentDescriptor : this->systemAddressSpaceDescriptor.segmentDescriptorsByKey | std::views::values) {
+            const auto gdbMemType = gdbMemoryTypeFromSegment(segmentDescriptor);
+            if (!gdbMemType.has_value()) {
+                continue;
+            }
+
+            const auto segmentWritable = (
+                segmentDescriptor.debugModeAccess.writeable || segmentDescriptor.programmingModeAccess.writeable
+            );
+
+            memoryMap += "<memory type=\"" + (!segmentWritable ? "rom" : *gdbMemType) + "\" start=\"0x"
+                + StringService::toHex(segmentDescriptor.addressRange.startAddress) + "\" length=\""
+                + std::to_string(segmentDescriptor.size()) + "\"";
+
+            if (segmentWritable && segmentDescriptor.pageSize.has_value()) {
+                memoryMap += ">\n    <property name=\"blocksize\">" + std::to_string(*(segmentDescriptor.pageSize))
+                    + "</property>\n</memory>\n";
+            } else {
+                memoryMap += "/>\n";
+            }
+        }
+
+        memoryMap += "</memory-map>";
+
+        return memoryMap;
+    }
+
+    std::string RiscVGdbTargetDescriptor::generateTargetDescription() const {
+        auto output = std::string{"<?xml version=\"1.0\"?>\n<!DOCTYPE target SYSTEM \"gdb-target.dtd\">\n"};
+        output += "<target version=\"1.0\">\n";
+        output += "<architecture>riscv:rv32</architecture>\n";
+        output += "<feature name=\"org.gnu.gdb.riscv.cpu\">\n";
+
+        for (const auto& registerDescriptor : this->gdbRegisterDescriptorsById) {
+            if (!registerDescriptor.has_value()) {
+                continue;
+            }
+
+            const auto& [gdbRegisterId, size] = *registerDescriptor;
+            const auto programCounter = gdbRegisterId == this->programCounterGdbRegisterId;
+
+            output += "<reg name=\"" + (programCounter ? std::string{"pc"} : "x" + std::to_string(gdbRegisterId))
+                + "\" bitsize=\"" + std::to_string(size * 8) + "\" type=\""
+                + (programCounter ? "code_ptr" : "int") + "\" regnum=\"" + std::to_string(gdbRegisterId) + "\"/>\n";
         }
 
-        this->gdbRegisterDescriptorsById.emplace(
-            this->programCounterGdbRegisterId,
-            RegisterDescriptor{this->programCounterGdbRegisterId, 4}
-        );
+        output += "</feature>\n</target>";
+        return output;
     }
 }
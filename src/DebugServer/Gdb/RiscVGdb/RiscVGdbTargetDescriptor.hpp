@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #include "src/DebugServer/Gdb/TargetDescriptor.hpp"
 
 #include "src/Targets/TargetDescriptor.hpp"
@@ -25,5 +27,21 @@ namespace DebugServer::Gdb::RiscVGdb
         const GdbRegisterId programCounterGdbRegisterId;
 
         explicit RiscVGdbTargetDescriptor(const Targets::TargetDescriptor& targetDescriptor);
+
+    private:
+        /**
+         * Generates the memory map XML document. See TargetDescriptor::memoryMap.
+         *
+         * @return
+         */
+        [[nodiscard]] std::string generateMemoryMap() const;
+
+        /**
+         * Generates the target description XML document, describing the general purpose registers and the program
+         * counter, in the order in which they appear in 'g' packets. See TargetDescriptor::targetDescription.
+         *
+         * @return
+         */
+        [[nodiscard]] std::string generateTargetDescription() const;
     };
 }
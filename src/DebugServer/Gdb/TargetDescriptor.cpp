@@ -0,0 +1,53 @@
+#include "TargetDescriptor.hpp"
+
+namespace DebugServer::Gdb
+{
+    std::optional<std::reference_wrapper<const RegisterDescriptor>> TargetDescriptor::tryGetRegisterDescriptor(
+        GdbRegisterId id
+    ) const {
+        if (id >= this->gdbRegisterDescriptorsById.size() || !this->gdbRegisterDescriptorsById[id].has_value()) {
+            return std::nullopt;
+        }
+
+        return std::cref(*(this->gdbRegisterDescriptorsById[id]));
+    }
+
+    std::optional<
+        std::reference_wrapper<const Targets::TargetRegisterDescriptor>
+    > TargetDescriptor::tryGetTargetRegisterDescriptor(GdbRegisterId id) const {
+        if (
+            id >= this->targetRegisterDescriptorsByGdbId.size()
+            || this->targetRegisterDescriptorsByGdbId[id] == nullptr
+        ) {
+            return std::nullopt;
+        }
+
+        return std::cref(*(this->targetRegisterDescriptorsByGdbId[id]));
+    }
+
+    void TargetDescriptor::addRegisterDescriptor(
+        const RegisterDescriptor& descriptor,
+        const Targets::TargetRegisterDescriptor* targetRegisterDescriptor
+    ) {
+        if (descriptor.id >= this->gdbRegisterDescriptorsById.size()) {
+            this->gdbRegisterDescriptorsById.resize(descriptor.id + 1, std::nullopt);
+            this->targetRegisterDescriptorsByGdbId.resize(descriptor.id + 1, nullptr);
+        }
+
+        this->gdbRegisterDescriptorsById[descriptor.id] = descriptor;
+
+        if (targetRegisterDescriptor == nullptr) {
+            return;
+        }
+
+        this->targetRegisterDescriptorsByGdbId[descriptor.id] = targetRegisterDescriptor;
+
+        // Keep the list in GDB register ID order
+        this->targetRegisterDescriptors.clear();
+        for (const auto* mappedDescriptor : this->targetRegisterDescriptorsByGdbId) {
+            if (mappedDescriptor != nullptr) {
+                this->targetRegisterDescriptors.push_back(mappedDescriptor);
+            }
+        }
+    }
+}
@@ -1,10 +1,10 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <optional>
 #include <vector>
-#include <set>
-#include <map>
+#include <functional>
 
 #include "src/Targets/TargetDescriptor.hpp"
 #include "src/Targets/TargetRegisterDescriptor.hpp"
@@ -22,9 +22,69 @@ namespace DebugServer::Gdb
     class TargetDescriptor
     {
     public:
-        std::map<GdbRegisterId, RegisterDescriptor> gdbRegisterDescriptorsById;
-        std::map<GdbRegisterId, const Targets::TargetRegisterDescriptor*> targetRegisterDescriptorsByGdbId;
+        /**
+         * GDB register IDs are dense (0 through N), so the register descriptors are held in contiguous arrays,
+         * indexed by GDB register ID. This gives the register packet handlers constant-time lookups.
+         *
+         * Both arrays are populated via addRegisterDescriptor(). An entry in targetRegisterDescriptorsByGdbId is null
+         * if the GDB register isn't mapped to a target register (the register packet handlers deal with those
+         * registers separately).
+         */
+        std::vector<std::optional<RegisterDescriptor>> gdbRegisterDescriptorsById;
+        std::vector<const Targets::TargetRegisterDescriptor*> targetRegisterDescriptorsByGdbId;
+
+        /**
+         * All target register descriptors that are mapped to GDB registers, in GDB register ID order.
+         *
+         * Held here so that the descriptor list doesn't have to be rebuilt for every 'g' packet.
+         */
+        Targets::TargetRegisterDescriptors targetRegisterDescriptors;
+
+        /**
+         * The memory map XML document, served in response to "qXfer:memory-map:read" packets.
+         *
+         * The document is generated once, by the server-implementation-specific target descriptor, and served from
+         * here for every request, across debug sessions.
+         */
+        std::string memoryMap;
+
+        /**
+         * The target description XML document ("target.xml"), served in response to "qXfer:features:read" packets.
+         *
+         * Like the memory map, this is generated once. Server implementations that don't provide a target
+         * description will leave this empty, and shouldn't advertise support for Feature::TARGET_DESCRIPTION_READ.
+         */
+        std::optional<std::string> targetDescription;
 
         virtual ~TargetDescriptor() = default;
+
+        [[nodiscard]] std::optional<std::reference_wrapper<const RegisterDescriptor>> tryGetRegisterDescriptor(
+            GdbRegisterId id
+        ) const;
+
+        /**
+         * Looks up the target register descriptor mapped to the given GDB register.
+         *
+         * @param id
+         *
+         * @return
+         *  The target register descriptor, or std::nullopt if the GDB register ID is unknown or not mapped to a
+         *  target register.
+         */
+        [[nodiscard]] std::optional<
+            std::reference_wrapper<const Targets::TargetRegisterDescriptor>
+        > tryGetTargetRegisterDescriptor(GdbRegisterId id) const;
+
+    protected:
+        /**
+         * Adds a GDB register descriptor, and optionally maps it to a target register descriptor.
+         *
+         * @param descriptor
+         * @param targetRegisterDescriptor
+         */
+        void addRegisterDescriptor(
+            const RegisterDescriptor& descriptor,
+            const Targets::TargetRegisterDescriptor* targetRegisterDescriptor = nullptr
+        );
     };
 }
@@ -12,6 +12,7 @@
 #include "src/Exceptions/InvalidConfig.hpp"
 #include "src/TargetController/Exceptions/DeviceFailure.hpp"
 #include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
+#include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
 
 #include "src/Logger/Logger.hpp"
 
@@ -30,7 +31,7 @@ namespace DebugToolDrivers::Microchip
         bool supportsTargetPowerManagement,
         std::optional<std::uint8_t> configurationIndex
     )
-        : UsbDevice(vendorId, productId)
+        : UsbDevice(vendorId, productId, debugToolConfig.serialNumber)
         , toolConfig(EdbgToolConfig{debugToolConfig})
         , cmsisHidInterfaceNumber(cmsisHidInterfaceNumber)
         , supportsTargetPowerManagement(supportsTargetPowerManagement)
@@ -56,7 +57,8 @@ namespace DebugToolDrivers::Microchip
                 this->getFirstEndpointAddress(this->cmsisHidInterfaceNumber, LIBUSB_ENDPOINT_IN)
             ),
             this->vendorId,
-            this->productId
+            this->productId,
+            this->serialNumber
         };
 
         cmsisHidInterface.init();
@@ -88,6 +90,20 @@ namespace DebugToolDrivers::Microchip
             this->edbgInterface->setCommandDelay(cmsisCommandDelay);
         }
 
+        /*
+         * The packet count determines how many CMSIS-DAP commands we can have in flight at any given time, when
+         * sending fragmented AVR command frames. Not all EDBG tools respond sensibly to the DAP_Info command, so we
+         * fall back to a packet count of 1 (no pipelining) on failure.
+         */
+        try {
+            const auto packetCount = this->edbgInterface->fetchPacketCount();
+            Logger::debug("CMSIS-DAP packet count: " + std::to_string(packetCount));
+            this->edbgInterface->setPacketCount(packetCount);
+
+        } catch (const Exceptions::DeviceCommunicationFailure& exception) {
+            Logger::debug("Failed to fetch CMSIS-DAP packet count - " + exception.getMessage());
+        }
+
         // We don't need to claim the CMSISDAP interface here as the HIDAPI will have already done so.
         if (!this->sessionStarted) {
             this->startSession();
@@ -217,10 +217,25 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
          * Issuing another command immediately after reset sometimes results in an 'illegal target state' error from
          * the EDBG debug tool. Even though we waited for the break event.
          *
-         * All we can really do here is introduce a small delay, to ensure that we're not issuing commands too quickly
-         * after reset.
+         * A successful command doesn't necessarily mean the target has settled - a command issued too soon after
+         * reset can succeed, only for a subsequent command to fail. So we always wait for the full settle delay.
+         * We then confirm that the target has settled, by polling the tool with a harmless command (reading the
+         * program counter) until it succeeds.
          */
-        std::this_thread::sleep_for(std::chrono::milliseconds{250});
+        std::this_thread::sleep_for(EdbgAvr8Interface::POST_RESET_SETTLE_DELAY);
+
+        const auto settled = this->postResetPoller.poll(
+            [this] {
+                return this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+                    GetProgramCounter{}
+                ).id != Avr8ResponseId::FAILED;
+            },
+            EdbgAvr8Interface::POST_RESET_SETTLE_TIMEOUT
+        );
+
+        if (!settled) {
+            throw Exception{"Failed to reset AVR8 target - target did not settle after reset"};
+        }
     }
 
     void EdbgAvr8Interface::activate() {
@@ -279,6 +294,12 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
         if (this->physicalInterfaceActivated) {
             this->deactivatePhysical();
         }
+
+        for (const auto* poller : {&this->avrEventPoller, &this->postResetPoller}) {
+            if (poller->getHistogram().count() > 0 || poller->getHistogram().timeouts() > 0) {
+                Logger::debug("EDBG " + poller->name + " latency - " + poller->getHistogram().toString());
+            }
+        }
     }
 
     void EdbgAvr8Interface::applyAccessRestrictions(
@@ -1242,7 +1263,7 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
     }
 
     void EdbgAvr8Interface::setHardwareBreakpoint(TargetMemoryAddress address) {
-        static const auto getAvailableBreakpointNumbers = [this] () {
+        const auto getAvailableBreakpointNumbers = [this] () {
             auto breakpointNumbers = std::set<std::uint8_t>{1, 2, 3};
 
             for (const auto& [address, allocatedNumber] : this->hardwareBreakpointNumbersByAddress) {
@@ -1584,6 +1605,25 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
         return bytes;
     }
 
+    TargetMemorySize EdbgAvr8Interface::maximumMemoryReadSize(
+        const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+    ) {
+        // This should reflect the memory types selected in EdbgAvr8Interface::readMemory()
+        if (memorySegmentDescriptor.type == TargetMemorySegmentType::FLASH) {
+            return this->maximumMemoryAccessSize(Avr8MemoryType::FLASH_PAGE);
+        }
+
+        if (memorySegmentDescriptor.type == TargetMemorySegmentType::EEPROM) {
+            return this->maximumMemoryAccessSize(
+                this->programmingModeEnabled && this->session.configVariant == Avr8ConfigVariant::MEGAJTAG
+                    ? Avr8MemoryType::EEPROM_PAGE
+                    : Avr8MemoryType::EEPROM
+            );
+        }
+
+        return this->maximumMemoryAccessSize(Avr8MemoryType::SRAM);
+    }
+
     TargetMemorySize EdbgAvr8Interface::maximumMemoryAccessSize(Avr8MemoryType memoryType) {
         if (
             memoryType == Avr8MemoryType::FLASH_PAGE
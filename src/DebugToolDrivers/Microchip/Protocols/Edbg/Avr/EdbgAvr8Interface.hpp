@@ -19,6 +19,8 @@
 #include "src/Targets/Microchip/Avr8/TargetDescriptionFile.hpp"
 #include "src/Targets/Microchip/Avr8/Family.hpp"
 
+#include "src/Helpers/AdaptivePoller.hpp"
+
 namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
 {
     /**
@@ -132,6 +134,9 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
             Targets::TargetMemoryBufferSpan buffer
         ) override;
 
+        Targets::TargetMemorySize maximumMemoryReadSize(
+            const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        ) override;
         void eraseProgramMemory(
             std::optional<Targets::Microchip::Avr8::ProgramMemorySection> section = std::nullopt
         ) override;
@@ -153,6 +158,26 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
         bool targetAttached = false;
         bool programmingModeEnabled = false;
 
+        AdaptivePoller avrEventPoller = AdaptivePoller{
+            "AVR event",
+            {.minimumDelay = std::chrono::microseconds{250}, .maximumDelay = std::chrono::milliseconds{5}}
+        };
+
+        /**
+         * The time to wait after a reset, before we start polling the tool. See EdbgAvr8Interface::reset().
+         */
+        static constexpr auto POST_RESET_SETTLE_DELAY = std::chrono::milliseconds{250};
+
+        /**
+         * How long we poll the tool for, after the settle delay, before giving up on the target.
+         */
+        static constexpr auto POST_RESET_SETTLE_TIMEOUT = std::chrono::milliseconds{250};
+
+        AdaptivePoller postResetPoller = AdaptivePoller{
+            "post-reset",
+            {.minimumDelay = std::chrono::milliseconds{1}, .maximumDelay = std::chrono::milliseconds{25}}
+        };
+
         /**
          * The TargetController refreshes the relevant program memory cache after inserting/removing software
          * breakpoints. So it expects the insertion/removal operation to take place immediately. But, EDBG tools do
@@ -338,35 +363,35 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
          * @tparam AvrEventType
          *  Type of AVR event to wait for. See AvrEvent class for more.
          *
-         * @param maximumAttempts
-         *  Maximum number of attempts to poll the debug tool for the expected event.
+         * @param timeout
+         *  Maximum amount of time to spend polling the debug tool for the expected event.
          *
          * @return
-         *  If an event is found before maximumAttempts is reached, the event will be returned. Otherwise a nullptr
-         *  will be returned.
+         *  If an event is found before the timeout, the event will be returned. Otherwise a nullptr will be returned.
          */
         template <class AvrEventType>
-        std::unique_ptr<AvrEventType> waitForAvrEvent(int maximumAttempts = 60) {
-            int attemptCount = 0;
-
-            while (attemptCount <= maximumAttempts) {
-                auto genericEvent = this->getAvrEvent();
-
-                if (genericEvent != nullptr) {
-                    // Attempt to downcast event
-                    auto event = std::unique_ptr<AvrEventType>(dynamic_cast<AvrEventType*>(genericEvent.release()));
-
-                    if (event != nullptr) {
-                        return event;
+        std::unique_ptr<AvrEventType> waitForAvrEvent(
+            std::chrono::milliseconds timeout = std::chrono::milliseconds{350}
+        ) {
+            auto event = std::unique_ptr<AvrEventType>{};
+
+            this->avrEventPoller.poll(
+                [this, &event] {
+                    auto genericEvent = this->getAvrEvent();
+
+                    if (genericEvent != nullptr) {
+                        // Attempt to downcast event
+                        event = std::unique_ptr<AvrEventType>(dynamic_cast<AvrEventType*>(genericEvent.release()));
                     }
-                }
 
-                std::this_thread::sleep_for(std::chrono::milliseconds{5});
-                attemptCount++;
-            }
+                    return event != nullptr;
+                },
+                timeout
+            );
 
-            return nullptr;
+            return event;
         }
+
         void waitForStoppedEvent();
     };
 }
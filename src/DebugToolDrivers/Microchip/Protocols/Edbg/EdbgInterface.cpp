@@ -15,19 +15,18 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg
     ::DebugToolDrivers::Protocols::CmsisDap::Response EdbgInterface::sendAvrCommandsAndWaitForResponse(
         const std::vector<Avr::AvrCommand>& avrCommands
     ) {
-        for (const auto& avrCommand : avrCommands) {
-            // Send command to device
-            auto response = this->sendCommandAndWaitForResponse(avrCommand);
-
-            if (&avrCommand == &avrCommands.back()) {
-                return response;
-            }
+        if (avrCommands.empty()) {
+            // This should never happen
+            throw DeviceCommunicationFailure{
+                "Cannot send AVR command frame - failed to generate CMSIS-DAP Vendor (AVR) commands"
+            };
         }
 
-        // This should never happen
-        throw DeviceCommunicationFailure{
-            "Cannot send AVR command frame - failed to generate CMSIS-DAP Vendor (AVR) commands"
-        };
+        /*
+         * The device acknowledges receipt of each fragment, but we only care about the acknowledgement of the final
+         * fragment, so the fragments can be pipelined.
+         */
+        return this->sendCommandsAndWaitForResponses(avrCommands).back();
     }
 
     std::optional<Microchip::Protocols::Edbg::Avr::AvrEvent> EdbgInterface::requestAvrEvent() {
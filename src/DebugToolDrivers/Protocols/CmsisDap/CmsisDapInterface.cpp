@@ -2,6 +2,10 @@
 
 #include <thread>
 
+#include "InfoCommand.hpp"
+
+#include "src/Logger/Logger.hpp"
+
 namespace DebugToolDrivers::Protocols::CmsisDap
 {
     using namespace Exceptions;
@@ -26,4 +30,25 @@ namespace DebugToolDrivers::Protocols::CmsisDap
 
         this->getUsbHidInterface().write(cmsisDapCommand.rawCommand());
     }
+
+    std::uint8_t CmsisDapInterface::fetchPacketCount() {
+        const auto response = this->sendCommandAndWaitForResponse(InfoCommand{InfoId::PACKET_COUNT});
+
+        if (response.data.size() < 2 || response.data[0] != 1) {
+            throw DeviceCommunicationFailure{"Invalid response to CMSIS-DAP packet count request"};
+        }
+
+        return response.data[1];
+    }
+
+    void CmsisDapInterface::discardResponses(std::size_t count) {
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            try {
+                this->getUsbHidInterface().read(std::chrono::milliseconds{500});
+
+            } catch (const Exceptions::Exception& exception) {
+                Logger::debug("Failed to discard CMSIS-DAP response - " + exception.getMessage());
+            }
+        }
+    }
 }
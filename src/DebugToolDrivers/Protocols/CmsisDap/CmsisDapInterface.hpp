@@ -3,6 +3,8 @@
 #include <memory>
 #include <chrono>
 #include <cstdint>
+#include <vector>
+#include <algorithm>
 
 #include "src/DebugToolDrivers/Usb/Hid/HidInterface.hpp"
 
@@ -44,6 +46,17 @@ namespace DebugToolDrivers::Protocols::CmsisDap
             this->commandDelay = commandDelay;
         }
 
+        void setPacketCount(std::uint8_t packetCount) {
+            this->packetCount = std::max(packetCount, std::uint8_t{1});
+        }
+
+        /**
+         * Queries the device for the maximum number of commands it can buffer (via the DAP_Info command).
+         *
+         * @return
+         */
+        std::uint8_t fetchPacketCount();
+
         /**
          * Sends a CMSIS-DAP command to the device.
          *
@@ -106,6 +119,77 @@ namespace DebugToolDrivers::Protocols::CmsisDap
             return response;
         }
 
+        /**
+         * Sends a sequence of CMSIS-DAP commands and waits for their responses.
+         *
+         * Up to CmsisDapInterface::packetCount commands are kept in flight, as opposed to waiting for the response to
+         * each command before sending the next. Responses are returned in the order in which their commands were
+         * sent.
+         *
+         * If a command delay has been set, we assume the device cannot cope with buffered commands, and fall back
+         * to sending one command at a time.
+         *
+         * @param cmsisDapCommands
+         *
+         * @return
+         *  A vector of ExpectedResponseType instances, one for each command.
+         */
+        template<class CommandType>
+        auto sendCommandsAndWaitForResponses(const std::vector<CommandType>& cmsisDapCommands) {
+            static_assert(
+                std::is_base_of<Command, CommandType>::value,
+                "CMSIS Command type must be derived from the Command class."
+            );
+
+            static_assert(
+                std::is_base_of<Response, typename CommandType::ExpectedResponseType>::value,
+                "CMSIS Command type must specify a valid expected response type, derived from the Response class."
+            );
+
+            using ResponseType = typename CommandType::ExpectedResponseType;
+
+            auto responses = std::vector<ResponseType>{};
+            responses.reserve(cmsisDapCommands.size());
+
+            const auto maximumInFlight = this->commandDelay.count() > 0
+                ? std::size_t{1}
+                : static_cast<std::size_t>(this->packetCount);
+
+            auto commandsSent = std::size_t{0};
+            auto responsesReceived = std::size_t{0};
+
+            try {
+                while (responses.size() < cmsisDapCommands.size()) {
+                    while (
+                        commandsSent < cmsisDapCommands.size()
+                        && (commandsSent - responsesReceived) < maximumInFlight
+                    ) {
+                        this->sendCommand(cmsisDapCommands[commandsSent]);
+                        ++commandsSent;
+                    }
+
+                    auto response = this->getResponse<ResponseType>();
+                    ++responsesReceived;
+
+                    if (response.id != cmsisDapCommands[responses.size()].id) {
+                        throw Exceptions::DeviceCommunicationFailure{"Unexpected response to CMSIS-DAP command."};
+                    }
+
+                    responses.push_back(std::move(response));
+                }
+
+            } catch (const Exceptions::DeviceCommunicationFailure&) {
+                /*
+                 * Any responses to the remaining in-flight commands would be mistaken for responses to subsequent
+                 * commands, so we discard them before propagating the failure.
+                 */
+                this->discardResponses(commandsSent - responsesReceived);
+                throw;
+            }
+
+            return responses;
+        }
+
     private:
         /**
          * All CMSIS-DAP devices employ the USB HID interface for communication.
@@ -120,5 +204,20 @@ namespace DebugToolDrivers::Protocols::CmsisDap
          */
         std::chrono::milliseconds commandDelay = std::chrono::milliseconds{0};
         std::int64_t lastCommandSentTimeStamp = 0;
+
+        /**
+         * The maximum number of commands the device can buffer. See
+         * CmsisDapInterface::sendCommandsAndWaitForResponses().
+         *
+         * Defaults to 1 (no pipelining) until the device has been queried via CmsisDapInterface::fetchPacketCount().
+         */
+        std::uint8_t packetCount = 1;
+
+        /**
+         * Reads and discards the given number of responses from the device, ignoring any failures.
+         *
+         * @param count
+         */
+        void discardResponses(std::size_t count);
     };
 }
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Command.hpp"
+
+namespace DebugToolDrivers::Protocols::CmsisDap
+{
+    enum class InfoId: unsigned char
+    {
+        VENDOR_NAME = 0x01,
+        PRODUCT_NAME = 0x02,
+        SERIAL_NUMBER = 0x03,
+        PROTOCOL_VERSION = 0x04,
+        CAPABILITIES = 0xF0,
+        PACKET_COUNT = 0xFE,
+        PACKET_SIZE = 0xFF,
+    };
+
+    /**
+     * The DAP_Info command. Requests information about the CMSIS-DAP debug unit.
+     *
+     * The response data takes the form of a length byte, followed by the requested information.
+     */
+    class InfoCommand: public Command
+    {
+    public:
+        explicit InfoCommand(InfoId infoId)
+            : Command(0x00)
+        {
+            this->data.push_back(static_cast<unsigned char>(infoId));
+        }
+    };
+}
@@ -38,5 +38,6 @@ namespace DebugToolDrivers::Protocols::RiscVDebug::DebugModule
     {
         ABSTRACT_COMMAND,
         PROGRAM_BUFFER,
+        SYSTEM_BUS,
     };
 }
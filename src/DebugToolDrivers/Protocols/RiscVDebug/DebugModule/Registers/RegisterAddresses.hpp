@@ -41,5 +41,8 @@ namespace DebugToolDrivers::Protocols::RiscVDebug::DebugModule::Registers
         PROGRAM_BUFFER_13 = 0x2D,
         PROGRAM_BUFFER_14 = 0x2E,
         PROGRAM_BUFFER_15 = 0x2F,
+        SYSTEM_BUS_ACCESS_CONTROL_STATUS_REGISTER = 0x38,
+        SYSTEM_BUS_ADDRESS_0 = 0x39,
+        SYSTEM_BUS_DATA_0 = 0x3C,
     };
 }
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugModule/DebugModule.hpp"
+
+namespace DebugToolDrivers::Protocols::RiscVDebug::DebugModule::Registers
+{
+    struct SystemBusAccessControlStatusRegister
+    {
+        enum class AccessSize: std::uint8_t
+        {
+            SIZE_8 = 0x00,
+            SIZE_16 = 0x01,
+            SIZE_32 = 0x02,
+            SIZE_64 = 0x03,
+            SIZE_128 = 0x04,
+        };
+
+        enum class Error: std::uint8_t
+        {
+            NONE = 0x00,
+            TIMEOUT = 0x01,
+            BAD_ADDRESS = 0x02,
+            ALIGNMENT = 0x03,
+            UNSUPPORTED_SIZE = 0x04,
+            OTHER = 0x07,
+        };
+
+        bool supports8BitAccess = false;
+        bool supports16BitAccess = false;
+        bool supports32BitAccess = false;
+        bool supports64BitAccess = false;
+        bool supports128BitAccess = false;
+        std::uint8_t addressWidth = 0;
+        Error error = Error::NONE;
+
+        /**
+         * sberror is write-1-to-clear. Setting this clears any error, when writing the register.
+         */
+        bool clearError = false;
+
+        bool readOnData = false;
+        bool autoIncrement = false;
+        AccessSize accessSize = AccessSize::SIZE_32;
+        bool readOnAddress = false;
+        bool busy = false;
+        bool busyError = false;
+        std::uint8_t version = 0;
+
+        static constexpr SystemBusAccessControlStatusRegister fromValue(RegisterValue value) {
+            return {
+                .supports8BitAccess = static_cast<bool>(value & 0x01),
+                .supports16BitAccess = static_cast<bool>(value & (0x01 << 1)),
+                .supports32BitAccess = static_cast<bool>(value & (0x01 << 2)),
+                .supports64BitAccess = static_cast<bool>(value & (0x01 << 3)),
+                .supports128BitAccess = static_cast<bool>(value & (0x01 << 4)),
+                .addressWidth = static_cast<std::uint8_t>((value >> 5) & 0x7F),
+                .error = static_cast<Error>((value >> 12) & 0x07),
+                .readOnData = static_cast<bool>(value & (0x01 << 15)),
+                .autoIncrement = static_cast<bool>(value & (0x01 << 16)),
+                .accessSize = static_cast<AccessSize>((value >> 17) & 0x07),
+                .readOnAddress = static_cast<bool>(value & (0x01 << 20)),
+                .busy = static_cast<bool>(value & (0x01 << 21)),
+                .busyError = static_cast<bool>(value & (0x01 << 22)),
+                .version = static_cast<std::uint8_t>((value >> 29) & 0x07),
+            };
+        }
+
+        [[nodiscard]] constexpr RegisterValue value() const {
+            return RegisterValue{0}
+                | static_cast<RegisterValue>(this->supports8BitAccess)
+                | static_cast<RegisterValue>(this->supports16BitAccess) << 1
+                | static_cast<RegisterValue>(this->supports32BitAccess) << 2
+                | static_cast<RegisterValue>(this->supports64BitAccess) << 3
+                | static_cast<RegisterValue>(this->supports128BitAccess) << 4
+                | static_cast<RegisterValue>(this->addressWidth & 0x7F) << 5
+                | static_cast<RegisterValue>(this->clearError ? 0x07 : static_cast<std::uint8_t>(this->error)) << 12
+                | static_cast<RegisterValue>(this->readOnData) << 15
+                | static_cast<RegisterValue>(this->autoIncrement) << 16
+                | static_cast<RegisterValue>(this->accessSize) << 17
+                | static_cast<RegisterValue>(this->readOnAddress) << 20
+                | static_cast<RegisterValue>(this->busy) << 21
+                | static_cast<RegisterValue>(this->busyError) << 22
+                | static_cast<RegisterValue>(this->version & 0x07) << 29
+            ;
+        }
+    };
+}
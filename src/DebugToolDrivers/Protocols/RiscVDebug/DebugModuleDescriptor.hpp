@@ -22,6 +22,16 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         std::uint8_t abstractDataRegisterCount = 0;
         std::uint8_t programBufferSize = 0;
 
+        /**
+         * Whether the debug module re-executes the abstract command upon data0 access (abstractauto.autoexecdata).
+         */
+        bool abstractCommandAutoExecuteSupported = false;
+
+        /**
+         * Whether the debug module supports aarpostincrement, for register access abstract commands.
+         */
+        bool registerAccessPostIncrementSupported = false;
+
         std::unordered_map<TriggerModule::TriggerIndex, TriggerModule::TriggerDescriptor> triggerDescriptorsByIndex;
     };
 }
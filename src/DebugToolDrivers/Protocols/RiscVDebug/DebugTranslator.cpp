@@ -6,13 +6,14 @@
 #include <limits>
 #include <cassert>
 #include <algorithm>
-#include <thread>
+#include <initializer_list>
 
 #include "Registers/CpuRegisterNumbers.hpp"
 #include "DebugModule/Registers/RegisterAddresses.hpp"
 #include "DebugModule/Registers/RegisterAccessControlField.hpp"
 #include "DebugModule/Registers/MemoryAccessControlField.hpp"
 #include "DebugModule/Registers/AbstractCommandAutoExecuteRegister.hpp"
+#include "DebugModule/Registers/SystemBusAccessControlStatusRegister.hpp"
 
 #include "src/Targets/RiscV/Opcodes/Lb.hpp"
 #include "src/Targets/RiscV/Opcodes/Lw.hpp"
@@ -33,6 +34,7 @@
 #include "src/TargetController/Exceptions/TargetFailure.hpp"
 #include "src/TargetController/Exceptions/TargetOperationFailure.hpp"
 #include "src/Targets/RiscV/Exceptions/IllegalMemoryAccess.hpp"
+#include "Exceptions/DmiBatchInterrupted.hpp"
 
 #include "src/Logger/Logger.hpp"
 
@@ -48,6 +50,7 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
     using DebugModule::Registers::AbstractCommandAutoExecuteRegister;
     using DebugModule::Registers::RegisterAccessControlField;
     using DebugModule::Registers::MemoryAccessControlField;
+    using DebugModule::Registers::SystemBusAccessControlStatusRegister;
     using DebugModule::AbstractCommandError;
     using DebugModule::MemoryAccessStrategy;
 
@@ -64,6 +67,7 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
     using ::Targets::TargetStackPointer;
     using ::Targets::TargetAddressSpaceDescriptor;
     using ::Targets::TargetMemorySegmentDescriptor;
+    using ::Targets::TargetRegisterDescriptor;
     using ::Targets::TargetRegisterDescriptors;
     using ::Targets::TargetRegisterDescriptorAndValuePairs;
 
@@ -78,6 +82,13 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         , targetDescriptionFile(targetDescriptionFile)
         , targetConfig(targetConfig)
         , sysAddressSpaceDescriptor(targetDescriptionFile.getSystemAddressSpaceDescriptor())
+        , haltPoller("halt", this->debugModulePollerConfig())
+        , resumePoller("resume", this->debugModulePollerConfig())
+        , resetPoller("reset", this->debugModulePollerConfig())
+        , debugModuleActivationPoller("debug module activation", this->debugModulePollerConfig())
+        , debugModuleDeactivationPoller("debug module deactivation", this->debugModulePollerConfig())
+        , abstractCommandPoller("abstract command", this->debugModulePollerConfig())
+        , systemBusPoller("system bus access", this->debugModulePollerConfig())
     {}
 
     void DebugTranslator::activate() {
@@ -124,6 +135,43 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         Logger::debug("Data register count: " + std::to_string(this->debugModuleDescriptor.abstractDataRegisterCount));
         Logger::debug("Program buffer size: " + std::to_string(this->debugModuleDescriptor.programBufferSize));
 
+        if (this->debugModuleDescriptor.abstractDataRegisterCount > 0) {
+            /*
+             * The abstractauto register is optional. Unimplemented bits are hardwired to 0, so we can detect support
+             * for auto execution upon data0 access by setting the bit and reading it back.
+             */
+            this->dtmInterface.writeDebugModuleRegister(
+                RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
+                AbstractCommandAutoExecuteRegister{.onData0Access = true}.value()
+            );
+            const auto autoExecuteRegister = AbstractCommandAutoExecuteRegister::fromValue(
+                this->dtmInterface.readDebugModuleRegister(RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER)
+            );
+            this->debugModuleDescriptor.abstractCommandAutoExecuteSupported = autoExecuteRegister.onData0Access;
+            this->dtmInterface.writeDebugModuleRegister(
+                RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
+                AbstractCommandAutoExecuteRegister{}.value()
+            );
+
+            /*
+             * Debug modules that don't support aarpostincrement will report a "not supported" error upon a register
+             * access command with the bit set.
+             */
+            this->debugModuleDescriptor.registerAccessPostIncrementSupported = this->tryReadCpuRegister(
+                CpuRegisterNumber::GPR_X8,
+                {.postIncrement = true}
+            ).hasValue();
+        }
+
+        Logger::debug(
+            "Abstract command auto execution supported: "
+                + std::string{this->debugModuleDescriptor.abstractCommandAutoExecuteSupported ? "yes" : "no"}
+        );
+        Logger::debug(
+            "Register access post-increment supported: "
+                + std::string{this->debugModuleDescriptor.registerAccessPostIncrementSupported ? "yes" : "no"}
+        );
+
         this->clearProgramBuffer();
 
         if (this->debugModuleDescriptor.abstractDataRegisterCount > 0) {
@@ -153,22 +201,54 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             }
         }
 
+        /*
+         * Debug modules that don't implement system bus access will have all sbcs bits hardwired to 0, so the
+         * version check is sufficient to detect support. We only use 32-bit accesses.
+         */
+        const auto systemBusControlStatusRegister = this->readSystemBusAccessControlStatusRegister();
+        if (
+            systemBusControlStatusRegister.version == 1
+            && systemBusControlStatusRegister.supports32BitAccess
+            && systemBusControlStatusRegister.addressWidth >= 32
+        ) {
+            this->debugModuleDescriptor.memoryAccessStrategies.insert(MemoryAccessStrategy::SYSTEM_BUS);
+        }
+
         if (this->debugModuleDescriptor.memoryAccessStrategies.empty()) {
             throw Exceptions::TargetFailure{"Target doesn't support any known memory access strategies"};
         }
 
         this->memoryAccessStrategy = this->determineMemoryAccessStrategy();
+        this->batchAbstractMemoryAccess = true;
         Logger::debug(
             "Selected memory access strategy: " + (
-                this->memoryAccessStrategy == MemoryAccessStrategy::ABSTRACT_COMMAND
-                    ? std::string{"ABSTRACT_COMMAND"}
-                    : std::string{"PROGRAM_BUFFER"}
+                this->memoryAccessStrategy == MemoryAccessStrategy::SYSTEM_BUS
+                    ? std::string{"SYSTEM_BUS"}
+                    : this->memoryAccessStrategy == MemoryAccessStrategy::ABSTRACT_COMMAND
+                        ? std::string{"ABSTRACT_COMMAND"}
+                        : std::string{"PROGRAM_BUFFER"}
             )
         );
     }
 
     void DebugTranslator::deactivate() {
         this->disableDebugModule();
+
+        for (
+            const auto* poller : {
+                &this->haltPoller,
+                &this->resumePoller,
+                &this->resetPoller,
+                &this->debugModuleActivationPoller,
+                &this->debugModuleDeactivationPoller,
+                &this->abstractCommandPoller,
+                &this->systemBusPoller,
+            }
+        ) {
+            if (poller->getHistogram().count() > 0 || poller->getHistogram().timeouts() > 0) {
+                Logger::debug("RISC-V " + poller->name + " latency - " + poller->getHistogram().toString());
+            }
+        }
     }
 
     TargetExecutionState DebugTranslator::getExecutionState() {
@@ -211,17 +291,14 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         };
 
         this->writeDebugModuleControlRegister(controlRegister);
-        auto statusRegister = this->readDebugModuleStatusRegister();
-
-        for (
-            auto attempts = 0;
-            !statusRegister.allHalted
-                && (DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY * attempts) <= this->config.targetResponseTimeout;
-            ++attempts
-        ) {
-            std::this_thread::sleep_for(DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY);
-            statusRegister = this->readDebugModuleStatusRegister();
-        }
+        auto statusRegister = StatusRegister{};
+        this->haltPoller.poll(
+            [this, &statusRegister] {
+                statusRegister = this->readDebugModuleStatusRegister();
+                return statusRegister.allHalted;
+            },
+            this->config.targetResponseTimeout
+        );
 
         controlRegister.haltRequest = false;
         this->writeDebugModuleControlRegister(controlRegister);
@@ -240,17 +317,14 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         };
 
         this->writeDebugModuleControlRegister(controlRegister);
-        auto statusRegister = this->readDebugModuleStatusRegister();
-
-        for (
-            auto attempts = 0;
-            !statusRegister.allResumeAcknowledge
-                && (DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY * attempts) <= this->config.targetResponseTimeout;
-            ++attempts
-        ) {
-            std::this_thread::sleep_for(DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY);
-            statusRegister = this->readDebugModuleStatusRegister();
-        }
+        auto statusRegister = StatusRegister{};
+        this->resumePoller.poll(
+            [this, &statusRegister] {
+                statusRegister = this->readDebugModuleStatusRegister();
+                return statusRegister.allResumeAcknowledge;
+            },
+            this->config.targetResponseTimeout
+        );
 
         controlRegister.resumeRequest = false;
         this->writeDebugModuleControlRegister(controlRegister);
@@ -298,16 +372,14 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             .haltRequest = true,
         });
 
-        auto statusRegister = this->readDebugModuleStatusRegister();
-        for (
-            auto attempts = 0;
-            !statusRegister.allHaveReset
-                && (DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY * attempts) <= this->config.targetResponseTimeout;
-            ++attempts
-        ) {
-            std::this_thread::sleep_for(DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY);
-            statusRegister = this->readDebugModuleStatusRegister();
-        }
+        auto statusRegister = StatusRegister{};
+        this->resetPoller.poll(
+            [this, &statusRegister] {
+                statusRegister = this->readDebugModuleStatusRegister();
+                return statusRegister.allHaveReset;
+            },
+            this->config.targetResponseTimeout
+        );
 
         this->writeDebugModuleControlRegister(ControlRegister{
             .debugModuleActive = true,
@@ -399,12 +471,14 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
     TargetRegisterDescriptorAndValuePairs DebugTranslator::readCpuRegisters(
         const TargetRegisterDescriptors& descriptors
     ) {
+        const auto initialDmiOperationCount = this->dmiOperationCount;
+
         auto output = TargetRegisterDescriptorAndValuePairs{};
+        output.reserve(descriptors.size());
 
-        for (const auto& descriptor : descriptors) {
-            const auto registerValue = this->readCpuRegister(static_cast<RegisterNumber>(descriptor->startAddress));
+        const auto appendValue = [&output] (const TargetRegisterDescriptor& descriptor, RegisterValue registerValue) {
             output.emplace_back(
-                *descriptor,
+                descriptor,
                 TargetMemoryBuffer{
                     static_cast<unsigned char>(registerValue >> 24),
                     static_cast<unsigned char>(registerValue >> 16),
@@ -412,8 +486,70 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
                     static_cast<unsigned char>(registerValue),
                 }
             );
+        };
+
+        const auto streamingSupported = this->debugModuleDescriptor.abstractCommandAutoExecuteSupported
+            && this->debugModuleDescriptor.registerAccessPostIncrementSupported;
+
+        auto index = std::size_t{0};
+        while (index < descriptors.size()) {
+            const auto firstRegisterNumber = static_cast<RegisterNumber>(descriptors[index]->startAddress);
+
+            /*
+             * A run of consecutively numbered registers (such as the GPR file) can be read with a single register
+             * access command, with aarpostincrement, that is re-executed upon each data0 read.
+             */
+            auto runLength = std::size_t{1};
+            while (
+                streamingSupported
+                && (index + runLength) < descriptors.size()
+                && descriptors[index + runLength]->startAddress == (firstRegisterNumber + runLength)
+            ) {
+                ++runLength;
+            }
+
+            if (runLength > 2) {
+                const auto result = this->tryStreamAbstractCommandReads(
+                    AbstractCommandRegister{
+                        .control = RegisterAccessControlField{
+                            .registerNumber = firstRegisterNumber,
+                            .transfer = true,
+                            .flags = {.postIncrement = true},
+                            .size = RegisterAccessControlField::RegisterSize::SIZE_32
+                        }.value(),
+                        .commandType = AbstractCommandRegister::CommandType::REGISTER_ACCESS
+                    },
+                    static_cast<std::uint32_t>(runLength)
+                );
+
+                if (result.hasValue()) {
+                    for (auto i = std::size_t{0}; i < runLength; ++i) {
+                        appendValue(*(descriptors[index + i]), result.value()[i]);
+                    }
+
+                    index += runLength;
+                    continue;
+                }
+
+                Logger::debug(
+                    "Failed to stream CPU register reads - abstract command error: 0x"
+                        + Services::StringService::toHex(result.error()) + " - reading registers individually"
+                );
+            }
+
+            for (const auto end = index + runLength; index < end; ++index) {
+                appendValue(
+                    *(descriptors[index]),
+                    this->readCpuRegister(static_cast<RegisterNumber>(descriptors[index]->startAddress))
+                );
+            }
         }
 
+        Logger::debug(
+            "Read " + std::to_string(descriptors.size()) + " CPU register(s) - "
+                + std::to_string(this->dmiOperationCount - initialDmiOperationCount) + " DMI operation(s)"
+        );
+
         return output;
     }
 
@@ -467,15 +603,34 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             return TargetMemoryBuffer{offset, offset + bytes};
         }
 
-        if (this->memoryAccessStrategy == MemoryAccessStrategy::PROGRAM_BUFFER) {
-            return this->readMemoryViaProgramBuffer(startAddress, bytes);
-        }
+        const auto read = [this, startAddress, bytes] {
+            if (this->memoryAccessStrategy == MemoryAccessStrategy::SYSTEM_BUS) {
+                return this->readMemoryViaSystemBus(startAddress, bytes);
+            }
 
-        if (this->memoryAccessStrategy == MemoryAccessStrategy::ABSTRACT_COMMAND) {
-            return this->readMemoryViaAbstractCommand(startAddress, bytes);
-        }
+            if (this->memoryAccessStrategy == MemoryAccessStrategy::PROGRAM_BUFFER) {
+                return this->readMemoryViaProgramBuffer(startAddress, bytes);
+            }
+
+            if (this->memoryAccessStrategy == MemoryAccessStrategy::ABSTRACT_COMMAND) {
+                return this->readMemoryViaAbstractCommand(startAddress, bytes);
+            }
+
+            throw Exceptions::InternalFatalErrorException{"Unknown selected memory access strategy"};
+        };
 
-        throw Exceptions::InternalFatalErrorException{"Unknown selected memory access strategy"};
+        /*
+         * Some of the DMI batches involved in a memory access can't be re-issued in isolation, following an
+         * interruption (see tryExecuteAbstractCommandBatch()). In that case, we start the whole access over. The
+         * interruption will have disabled DMI pipelining, so this can only happen once.
+         */
+        try {
+            return read();
+
+        } catch (const Exceptions::DmiBatchInterrupted&) {
+            Logger::debug("Restarting memory read following interrupted DMI batch");
+            return read();
+        }
     }
 
     void DebugTranslator::writeMemory(
@@ -546,15 +701,62 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             );
         }
 
-        if (this->memoryAccessStrategy == MemoryAccessStrategy::PROGRAM_BUFFER) {
-            return this->writeMemoryViaProgramBuffer(startAddress, buffer);
+        const auto write = [this, startAddress, buffer] {
+            if (this->memoryAccessStrategy == MemoryAccessStrategy::SYSTEM_BUS) {
+                return this->writeMemoryViaSystemBus(startAddress, buffer);
+            }
+
+            if (this->memoryAccessStrategy == MemoryAccessStrategy::PROGRAM_BUFFER) {
+                return this->writeMemoryViaProgramBuffer(startAddress, buffer);
+            }
+
+            if (this->memoryAccessStrategy == MemoryAccessStrategy::ABSTRACT_COMMAND) {
+                return this->writeMemoryViaAbstractCommand(startAddress, buffer);
+            }
+
+            throw Exceptions::InternalFatalErrorException{"Unknown selected memory access strategy"};
+        };
+
+        // See the comment in DebugTranslator::readMemory(), on restarting interrupted memory accesses.
+        try {
+            write();
+
+        } catch (const Exceptions::DmiBatchInterrupted&) {
+            Logger::debug("Restarting memory write following interrupted DMI batch");
+            write();
         }
+    }
 
-        if (this->memoryAccessStrategy == MemoryAccessStrategy::ABSTRACT_COMMAND) {
-            return this->writeMemoryViaAbstractCommand(startAddress, buffer);
+    TargetMemorySize DebugTranslator::maximumMemoryReadSize() const {
+        switch (this->memoryAccessStrategy) {
+            case MemoryAccessStrategy::ABSTRACT_COMMAND: {
+                // Without batching, each word is read via a separate abstract command
+                return this->batchAbstractMemoryAccess
+                    ? DebugTranslator::MAX_ABSTRACT_COMMAND_BATCH_WORD_COUNT * DebugTranslator::WORD_BYTE_SIZE
+                    : DebugTranslator::WORD_BYTE_SIZE;
+            }
+            case MemoryAccessStrategy::PROGRAM_BUFFER: {
+                /*
+                 * The entire read is performed in a single batch, but each word costs two DMI operations when the
+                 * debug module doesn't support auto execution. We apply the same limit as with abstract commands, to
+                 * keep speculative reads cheap.
+                 */
+                return DebugTranslator::MAX_ABSTRACT_COMMAND_BATCH_WORD_COUNT * DebugTranslator::WORD_BYTE_SIZE;
+            }
+            case MemoryAccessStrategy::SYSTEM_BUS: {
+                /*
+                 * System bus reads are not batched - each word is read via a separate DMI operation, so there's
+                 * nothing to gain from reading more than we need.
+                 */
+                return DebugTranslator::WORD_BYTE_SIZE;
+            }
         }
 
-        throw Exceptions::InternalFatalErrorException{"Unknown selected memory access strategy"};
+        return DebugTranslator::WORD_BYTE_SIZE;
+    }
+
+    bool DebugTranslator::canReadMemoryWhileRunning() const {
+        return this->memoryAccessStrategy == MemoryAccessStrategy::SYSTEM_BUS;
     }
 
     AbstractCommandError DebugTranslator::readAndClearAbstractCommandError() {
@@ -706,6 +908,12 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         );
     }
 
+    SystemBusAccessControlStatusRegister DebugTranslator::readSystemBusAccessControlStatusRegister() {
+        return SystemBusAccessControlStatusRegister::fromValue(
+            this->dtmInterface.readDebugModuleRegister(RegisterAddress::SYSTEM_BUS_ACCESS_CONTROL_STATUS_REGISTER)
+        );
+    }
+
     DebugControlStatusRegister DebugTranslator::readDebugControlStatusRegister() {
         return DebugControlStatusRegister::fromValue(
             this->readCpuRegister(static_cast<RegisterNumber>(CpuRegisterNumber::DEBUG_CONTROL_STATUS_REGISTER))
@@ -719,17 +927,13 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         };
 
         this->writeDebugModuleControlRegister(controlRegister);
-        controlRegister = this->readDebugModuleControlRegister();
-
-        for (
-            auto attempts = 0;
-            !controlRegister.debugModuleActive
-                && (DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY * attempts) <= this->config.targetResponseTimeout;
-            ++attempts
-        ) {
-            std::this_thread::sleep_for(DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY);
-            controlRegister = this->readDebugModuleControlRegister();
-        }
+        this->debugModuleActivationPoller.poll(
+            [this, &controlRegister] {
+                controlRegister = this->readDebugModuleControlRegister();
+                return controlRegister.debugModuleActive;
+            },
+            this->config.targetResponseTimeout
+        );
 
         if (!controlRegister.debugModuleActive) {
             throw Exceptions::TargetOperationFailure{"Took too long to enable debug module"};
@@ -741,17 +945,14 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             ControlRegister{.debugModuleActive = false, .selectedHartIndex = this->selectedHartIndex}
         );
 
-        auto controlRegister = this->readDebugModuleControlRegister();
-
-        for (
-            auto attempts = 0;
-            controlRegister.debugModuleActive
-                && (DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY * attempts) <= this->config.targetResponseTimeout;
-            ++attempts
-        ) {
-            std::this_thread::sleep_for(DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY);
-            controlRegister = this->readDebugModuleControlRegister();
-        }
+        auto controlRegister = ControlRegister{};
+        this->debugModuleDeactivationPoller.poll(
+            [this, &controlRegister] {
+                controlRegister = this->readDebugModuleControlRegister();
+                return !controlRegister.debugModuleActive;
+            },
+            this->config.targetResponseTimeout
+        );
 
         if (controlRegister.debugModuleActive) {
             throw Exceptions::TargetOperationFailure{"Took too long to disable debug module"};
@@ -772,20 +973,28 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         RegisterNumber number,
         const RegisterAccessControlField::Flags& flags
     ) {
-        const auto commandError = this->tryExecuteAbstractCommand(AbstractCommandRegister{
-            .control = RegisterAccessControlField{
-                .registerNumber = number,
-                .transfer = true,
-                .flags = flags,
-                .size = RegisterAccessControlField::RegisterSize::SIZE_32
-            }.value(),
-            .commandType = AbstractCommandRegister::CommandType::REGISTER_ACCESS
-        });
+        /*
+         * Executing the program buffer may have side effects (such as advancing an address held in a GPR), so we
+         * can't re-issue commands that do so (see tryExecuteAbstractCommandBatch()).
+         */
+        const auto commandError = this->tryExecuteAbstractCommand(
+            AbstractCommandRegister{
+                .control = RegisterAccessControlField{
+                    .registerNumber = number,
+                    .transfer = true,
+                    .flags = flags,
+                    .size = RegisterAccessControlField::RegisterSize::SIZE_32
+                }.value(),
+                .commandType = AbstractCommandRegister::CommandType::REGISTER_ACCESS
+            },
+            !flags.postExecute
+        );
 
         if (commandError != AbstractCommandError::NONE) {
             return commandError;
         }
 
+        ++(this->dmiOperationCount);
         return this->dtmInterface.readDebugModuleRegister(RegisterAddress::ABSTRACT_DATA_0);
     }
 
@@ -825,17 +1034,24 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         RegisterValue value,
         const RegisterAccessControlField::Flags& flags
     ) {
-        this->dtmInterface.writeDebugModuleRegister(RegisterAddress::ABSTRACT_DATA_0, value);
-        return this->tryExecuteAbstractCommand(AbstractCommandRegister{
-            .control = RegisterAccessControlField{
-                .registerNumber = number,
-                .write = true,
-                .transfer = true,
-                .flags = flags,
-                .size = RegisterAccessControlField::RegisterSize::SIZE_32
-            }.value(),
-            .commandType = AbstractCommandRegister::CommandType::REGISTER_ACCESS
-        });
+        auto batch = DmiBatch{};
+        batch.write(RegisterAddress::ABSTRACT_DATA_0, value);
+        batch.write(
+            RegisterAddress::ABSTRACT_COMMAND_REGISTER,
+            AbstractCommandRegister{
+                .control = RegisterAccessControlField{
+                    .registerNumber = number,
+                    .write = true,
+                    .transfer = true,
+                    .flags = flags,
+                    .size = RegisterAccessControlField::RegisterSize::SIZE_32
+                }.value(),
+                .commandType = AbstractCommandRegister::CommandType::REGISTER_ACCESS
+            }.value()
+        );
+
+        const auto result = this->tryExecuteAbstractCommandBatch(std::move(batch), !flags.postExecute);
+        return result.hasValue() ? AbstractCommandError::NONE : result.error();
     }
 
     AbstractCommandError DebugTranslator::tryWriteCpuRegister(
@@ -888,46 +1104,265 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
     }
 
     AbstractCommandError DebugTranslator::tryExecuteAbstractCommand(
+        const DebugModule::Registers::AbstractCommandRegister& abstractCommandRegister,
+        bool reissueOnInterruption
+    ) {
+        auto batch = DmiBatch{};
+        batch.write(RegisterAddress::ABSTRACT_COMMAND_REGISTER, abstractCommandRegister.value());
+
+        const auto result = this->tryExecuteAbstractCommandBatch(std::move(batch), reissueOnInterruption);
+        return result.hasValue() ? AbstractCommandError::NONE : result.error();
+    }
+
+    void DebugTranslator::executeAbstractCommand(
         const DebugModule::Registers::AbstractCommandRegister& abstractCommandRegister
     ) {
+        const auto commandError = this->tryExecuteAbstractCommand(abstractCommandRegister);
+        if (commandError != AbstractCommandError::NONE) {
+            throw Exceptions::TargetOperationFailure{
+                "Failed to execute abstract command - error: 0x"
+                    + Services::StringService::toHex(static_cast<std::uint8_t>(commandError))
+            };
+        }
+    }
+
+    std::vector<RegisterValue> DebugTranslator::executeDmiBatch(const DmiBatch& batch) {
+        this->dmiOperationCount += batch.size();
+
+        if (!this->pipelineDmiBatches) {
+            // Bypass the DTM's batch implementation, to issue each operation individually
+            return this->dtmInterface.DebugTransportModuleInterface::executeDmiBatch(batch);
+        }
+
+        return this->dtmInterface.executeDmiBatch(batch);
+    }
+
+    void DebugTranslator::recoverFromInterruptedDmiBatch() {
+        Logger::debug("DMI batch interrupted - recovering debug module and disabling DMI pipelining");
+        this->pipelineDmiBatches = false;
+
+        auto abstractStatusRegister = this->readDebugModuleAbstractControlStatusRegister();
+        if (abstractStatusRegister.busy) {
+            this->abstractCommandPoller.poll(
+                [this, &abstractStatusRegister] {
+                    abstractStatusRegister = this->readDebugModuleAbstractControlStatusRegister();
+                    return !abstractStatusRegister.busy;
+                },
+                this->config.targetResponseTimeout
+            );
+
+            if (abstractStatusRegister.busy) {
+                throw Exceptions::TargetOperationFailure{
+                    "Abstract command took too long to execute, following interrupted DMI batch"
+                };
+            }
+        }
+
+        /*
+         * The interrupted batch may have left auto execution enabled. abstractauto is optional, but writes to
+         * unimplemented debug module registers are ignored.
+         */
         this->dtmInterface.writeDebugModuleRegister(
-            RegisterAddress::ABSTRACT_COMMAND_REGISTER,
-            abstractCommandRegister.value()
+            RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
+            AbstractCommandAutoExecuteRegister{}.value()
         );
+        this->clearAbstractCommandError();
+    }
 
-        auto abstractStatusRegister = this->readDebugModuleAbstractControlStatusRegister();
+    Expected<std::vector<RegisterValue>, AbstractCommandError> DebugTranslator::tryExecuteAbstractCommandBatch(
+        DmiBatch batch,
+        bool reissueOnInterruption
+    ) {
+        /*
+         * The abstractcs read goes in the same batch, so that executing a single abstract command costs one
+         * transaction when the debug module is quick enough to complete the command before we read abstractcs.
+         */
+        batch.read(RegisterAddress::ABSTRACT_CONTROL_STATUS_REGISTER);
 
-        for (
-            auto attempts = 0;
-            abstractStatusRegister.busy
-                && (DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY * attempts) <= this->config.targetResponseTimeout;
-            ++attempts
-        ) {
-            std::this_thread::sleep_for(DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY);
-            abstractStatusRegister = this->readDebugModuleAbstractControlStatusRegister();
+        auto output = std::vector<RegisterValue>{};
+
+        try {
+            output = this->executeDmiBatch(batch);
+
+        } catch (const Exceptions::DmiBatchInterrupted& exception) {
+            Logger::debug(exception.getMessage());
+            this->recoverFromInterruptedDmiBatch();
+
+            if (!reissueOnInterruption) {
+                throw;
+            }
+
+            /*
+             * Pipelining is now disabled, so the batch will be executed one operation at a time, and can't be
+             * interrupted again.
+             */
+            output = this->executeDmiBatch(batch);
         }
 
+        assert(!output.empty());
+
+        auto abstractStatusRegister = AbstractControlStatusRegister::fromValue(output.back());
+        output.pop_back();
+
         if (abstractStatusRegister.busy) {
-            throw Exceptions::TargetOperationFailure{"Abstract command took too long to execute"};
+            this->abstractCommandPoller.poll(
+                [this, &abstractStatusRegister] {
+                    abstractStatusRegister = this->readDebugModuleAbstractControlStatusRegister();
+                    ++(this->dmiOperationCount);
+                    return !abstractStatusRegister.busy;
+                },
+                this->config.targetResponseTimeout
+            );
+
+            if (abstractStatusRegister.busy) {
+                throw Exceptions::TargetOperationFailure{"Abstract command took too long to execute"};
+            }
         }
 
         if (abstractStatusRegister.commandError != AbstractCommandError::NONE) {
             this->clearAbstractCommandError();
+            return abstractStatusRegister.commandError;
         }
 
-        return abstractStatusRegister.commandError;
+        return output;
     }
 
-    void DebugTranslator::executeAbstractCommand(
-        const DebugModule::Registers::AbstractCommandRegister& abstractCommandRegister
+    Expected<std::vector<RegisterValue>, AbstractCommandError> DebugTranslator::tryStreamAbstractCommandReads(
+        const AbstractCommandRegister& command,
+        std::uint32_t count,
+        DmiBatch setupBatch
     ) {
-        const auto commandError = this->tryExecuteAbstractCommand(abstractCommandRegister);
-        if (commandError != AbstractCommandError::NONE) {
-            throw Exceptions::TargetOperationFailure{
-                "Failed to execute abstract command - error: 0x"
-                    + Services::StringService::toHex(static_cast<std::uint8_t>(commandError))
+        assert(count > 0);
+        assert(this->debugModuleDescriptor.abstractCommandAutoExecuteSupported || count == 1);
+
+        // Kept for starting over, should the stream be interrupted
+        auto originalSetupBatch = setupBatch;
+
+        /*
+         * The first execution must complete before we enable auto execution, as writing to abstractauto whilst an
+         * abstract command is in progress will set cmderr to busy. So that goes in its own batch.
+         */
+        setupBatch.write(RegisterAddress::ABSTRACT_COMMAND_REGISTER, command.value());
+
+        const auto setupResult = this->tryExecuteAbstractCommandBatch(std::move(setupBatch));
+        if (!setupResult.hasValue()) {
+            return setupResult.error();
+        }
+
+        if (count == 1) {
+            ++(this->dmiOperationCount);
+            return std::vector<RegisterValue>{
+                this->dtmInterface.readDebugModuleRegister(RegisterAddress::ABSTRACT_DATA_0)
             };
         }
+
+        /*
+         * Each data0 read returns the result of the previous execution and re-executes the command. We disable auto
+         * execution before the last read, to avoid accessing anything beyond what was requested.
+         */
+        auto batch = DmiBatch{};
+        batch.reserve(count + 3);
+        batch.write(
+            RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
+            AbstractCommandAutoExecuteRegister{.onData0Access = true}.value()
+        );
+
+        for (auto i = std::uint32_t{1}; i < count; ++i) {
+            batch.read(RegisterAddress::ABSTRACT_DATA_0);
+        }
+
+        batch.write(
+            RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
+            AbstractCommandAutoExecuteRegister{}.value()
+        );
+        batch.read(RegisterAddress::ABSTRACT_DATA_0);
+
+        auto result = std::optional<Expected<std::vector<RegisterValue>, AbstractCommandError>>{};
+
+        try {
+            // This batch relies on the state left by the setup batch, so it can't be re-issued on its own
+            result = this->tryExecuteAbstractCommandBatch(std::move(batch), false);
+
+        } catch (const Exceptions::DmiBatchInterrupted&) {
+            // The interruption will have disabled DMI pipelining, so this can only happen once
+            return this->tryStreamAbstractCommandReads(command, count, std::move(originalSetupBatch));
+        }
+
+        if (!result->hasValue()) {
+            /*
+             * If the failure occurred before auto execution was disabled, the write to abstractauto would have been
+             * ignored. The error has been cleared by now, so this write will take effect.
+             */
+            this->dtmInterface.writeDebugModuleRegister(
+                RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
+                AbstractCommandAutoExecuteRegister{}.value()
+            );
+            ++(this->dmiOperationCount);
+        }
+
+        return *result;
+    }
+
+    AbstractCommandError DebugTranslator::tryStreamAbstractCommandWrites(
+        const AbstractCommandRegister& command,
+        std::span<const RegisterValue> values,
+        DmiBatch setupBatch
+    ) {
+        assert(!values.empty());
+        assert(this->debugModuleDescriptor.abstractCommandAutoExecuteSupported || values.size() == 1);
+
+        // Kept for starting over, should the stream be interrupted
+        auto originalSetupBatch = setupBatch;
+
+        setupBatch.write(RegisterAddress::ABSTRACT_DATA_0, values.front());
+        setupBatch.write(RegisterAddress::ABSTRACT_COMMAND_REGISTER, command.value());
+
+        const auto setupResult = this->tryExecuteAbstractCommandBatch(std::move(setupBatch));
+        if (!setupResult.hasValue()) {
+            return setupResult.error();
+        }
+
+        if (values.size() == 1) {
+            return AbstractCommandError::NONE;
+        }
+
+        auto batch = DmiBatch{};
+        batch.reserve(values.size() + 2);
+        batch.write(
+            RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
+            AbstractCommandAutoExecuteRegister{.onData0Access = true}.value()
+        );
+
+        for (const auto value : values.subspan(1)) {
+            batch.write(RegisterAddress::ABSTRACT_DATA_0, value);
+        }
+
+        batch.write(
+            RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
+            AbstractCommandAutoExecuteRegister{}.value()
+        );
+
+        auto result = std::optional<Expected<std::vector<RegisterValue>, AbstractCommandError>>{};
+
+        try {
+            // This batch relies on the state left by the setup batch, so it can't be re-issued on its own
+            result = this->tryExecuteAbstractCommandBatch(std::move(batch), false);
+
+        } catch (const Exceptions::DmiBatchInterrupted&) {
+            // The interruption will have disabled DMI pipelining, so this can only happen once
+            return this->tryStreamAbstractCommandWrites(command, values, std::move(originalSetupBatch));
+        }
+
+        if (!result->hasValue()) {
+            this->dtmInterface.writeDebugModuleRegister(
+                RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
+                AbstractCommandAutoExecuteRegister{}.value()
+            );
+            ++(this->dmiOperationCount);
+            return result->error();
+        }
+
+        return AbstractCommandError::NONE;
     }
 
     MemoryAccessStrategy DebugTranslator::determineMemoryAccessStrategy() {
@@ -942,7 +1377,15 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             return *(this->config.preferredMemoryAccessStrategy);
         }
 
-        // Favour the abstract command strategy, as it seems to be faster on the targets currently supported by Bloom.
+        /*
+         * Favour system bus access, as it costs a single DMI operation per word and doesn't involve the hart. After
+         * that, the abstract command strategy, as it seems to be faster than the program buffer strategy on the
+         * targets currently supported by Bloom.
+         */
+        if (this->debugModuleDescriptor.memoryAccessStrategies.contains(MemoryAccessStrategy::SYSTEM_BUS)) {
+            return MemoryAccessStrategy::SYSTEM_BUS;
+        }
+
         return this->debugModuleDescriptor.memoryAccessStrategies.contains(MemoryAccessStrategy::ABSTRACT_COMMAND)
             ? MemoryAccessStrategy::ABSTRACT_COMMAND
             : *(this->debugModuleDescriptor.memoryAccessStrategies.begin());
@@ -956,12 +1399,6 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         assert(startAddress % DebugTranslator::WORD_BYTE_SIZE == 0);
         assert(bytes % DebugTranslator::WORD_BYTE_SIZE == 0);
 
-        /*
-         * We only need to set the address once. No need to update it as we use the post-increment function to
-         * increment the address. See MemoryAccessControlField::postIncrement
-         */
-        this->dtmInterface.writeDebugModuleRegister(RegisterAddress::ABSTRACT_DATA_1, startAddress);
-
         static constexpr auto COMMAND = AbstractCommandRegister{
             .control = MemoryAccessControlField{
                 .postIncrement = true,
@@ -970,29 +1407,99 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             .commandType = AbstractCommandRegister::CommandType::MEMORY_ACCESS
         };
 
+        const auto initialDmiOperationCount = this->dmiOperationCount;
+
         auto output = TargetMemoryBuffer{};
         output.reserve(bytes);
 
-        for (auto address = startAddress; address <= (startAddress + bytes - 1); address += 4) {
-            const auto commandError = this->tryExecuteAbstractCommand(COMMAND);
-            if (commandError != AbstractCommandError::NONE) {
-                if (commandError == AbstractCommandError::EXCEPTION) {
-                    throw Exceptions::IllegalMemoryAccess{};
+        const auto appendWord = [&output] (RegisterValue word) {
+            output.emplace_back(static_cast<unsigned char>(word));
+            output.emplace_back(static_cast<unsigned char>(word >> 8));
+            output.emplace_back(static_cast<unsigned char>(word >> 16));
+            output.emplace_back(static_cast<unsigned char>(word >> 24));
+        };
+
+        const auto throwCommandError = [] (AbstractCommandError commandError) {
+            if (commandError == AbstractCommandError::EXCEPTION) {
+                throw Exceptions::IllegalMemoryAccess{};
+            }
+
+            throw Exceptions::TargetOperationFailure{
+                "Failed to read memory via abstract command - error: 0x"
+                    + Services::StringService::toHex(static_cast<std::uint8_t>(commandError))
+            };
+        };
+
+        constexpr auto maxBatchBytes = DebugTranslator::MAX_ABSTRACT_COMMAND_BATCH_WORD_COUNT
+            * DebugTranslator::WORD_BYTE_SIZE;
+
+        for (auto offset = TargetMemorySize{0}; offset < bytes; offset += maxBatchBytes) {
+            const auto batchStartAddress = startAddress + offset;
+            const auto batchWordCount = std::min(bytes - offset, maxBatchBytes) / DebugTranslator::WORD_BYTE_SIZE;
+
+            if (this->batchAbstractMemoryAccess) {
+                /*
+                 * We only need to set the address once per batch. No need to update it as we use the post-increment
+                 * function to increment the address. See MemoryAccessControlField::postIncrement
+                 */
+                auto batch = DmiBatch{};
+                batch.write(RegisterAddress::ABSTRACT_DATA_1, batchStartAddress);
+
+                auto result = std::optional<Expected<std::vector<RegisterValue>, AbstractCommandError>>{};
+
+                if (this->debugModuleDescriptor.abstractCommandAutoExecuteSupported) {
+                    result = this->tryStreamAbstractCommandReads(COMMAND, batchWordCount, std::move(batch));
+
+                } else {
+                    batch.reserve(batchWordCount * 2 + 2);
+
+                    for (auto i = TargetMemorySize{0}; i < batchWordCount; ++i) {
+                        batch.write(RegisterAddress::ABSTRACT_COMMAND_REGISTER, COMMAND.value());
+                        batch.read(RegisterAddress::ABSTRACT_DATA_0);
+                    }
+
+                    result = this->tryExecuteAbstractCommandBatch(std::move(batch));
                 }
 
-                throw Exceptions::TargetOperationFailure{
-                    "Failed to read memory via abstract command - error: 0x"
-                        + Services::StringService::toHex(static_cast<std::uint8_t>(commandError))
-                };
+                if (result->hasValue()) {
+                    for (const auto word : result->value()) {
+                        appendWord(word);
+                    }
+
+                    continue;
+                }
+
+                if (result->error() != AbstractCommandError::BUSY) {
+                    throwCommandError(result->error());
+                }
+
+                Logger::debug(
+                    "Debug module busy during batched abstract memory access - falling back to polled abstract "
+                        "commands"
+                );
+                this->batchAbstractMemoryAccess = false;
             }
 
-            const auto data = this->dtmInterface.readDebugModuleRegister(RegisterAddress::ABSTRACT_DATA_0);
-            output.emplace_back(static_cast<unsigned char>(data));
-            output.emplace_back(static_cast<unsigned char>(data >> 8));
-            output.emplace_back(static_cast<unsigned char>(data >> 16));
-            output.emplace_back(static_cast<unsigned char>(data >> 24));
+            this->dtmInterface.writeDebugModuleRegister(RegisterAddress::ABSTRACT_DATA_1, batchStartAddress);
+            ++(this->dmiOperationCount);
+
+            for (auto i = TargetMemorySize{0}; i < batchWordCount; ++i) {
+                // The address in data1 is post-incremented, so the command can't be re-issued
+                const auto commandError = this->tryExecuteAbstractCommand(COMMAND, false);
+                if (commandError != AbstractCommandError::NONE) {
+                    throwCommandError(commandError);
+                }
+
+                appendWord(this->dtmInterface.readDebugModuleRegister(RegisterAddress::ABSTRACT_DATA_0));
+                ++(this->dmiOperationCount);
+            }
         }
 
+        Logger::debug(
+            "Read " + std::to_string(bytes) + " byte(s) via abstract command - "
+                + std::to_string(this->dmiOperationCount - initialDmiOperationCount) + " DMI operation(s)"
+        );
+
         return output;
     }
 
@@ -1005,8 +1512,6 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         assert(startAddress % DebugTranslator::WORD_BYTE_SIZE == 0);
         assert(buffer.size() % DebugTranslator::WORD_BYTE_SIZE == 0);
 
-        this->dtmInterface.writeDebugModuleRegister(RegisterAddress::ABSTRACT_DATA_1, startAddress);
-
         static constexpr auto COMMAND = AbstractCommandRegister{
             .control = MemoryAccessControlField{
                 .write = true,
@@ -1016,29 +1521,99 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             .commandType = AbstractCommandRegister::CommandType::MEMORY_ACCESS
         };
 
-        for (auto offset = std::size_t{0}; offset < buffer.size(); offset += 4) {
-            this->dtmInterface.writeDebugModuleRegister(
-                RegisterAddress::ABSTRACT_DATA_0,
-                static_cast<RegisterValue>(
-                    (buffer[offset + 3] << 24)
-                    | (buffer[offset + 2] << 16)
-                    | (buffer[offset + 1] << 8)
-                    | (buffer[offset])
-                )
+        const auto initialDmiOperationCount = this->dmiOperationCount;
+
+        auto words = std::vector<RegisterValue>{};
+        words.reserve(buffer.size() / DebugTranslator::WORD_BYTE_SIZE);
+
+        for (auto offset = std::size_t{0}; offset < buffer.size(); offset += DebugTranslator::WORD_BYTE_SIZE) {
+            words.push_back(static_cast<RegisterValue>(
+                (buffer[offset + 3] << 24)
+                | (buffer[offset + 2] << 16)
+                | (buffer[offset + 1] << 8)
+                | (buffer[offset])
+            ));
+        }
+
+        const auto throwCommandError = [] (AbstractCommandError commandError) {
+            if (commandError == AbstractCommandError::EXCEPTION) {
+                throw Exceptions::IllegalMemoryAccess{};
+            }
+
+            throw Exceptions::TargetOperationFailure{
+                "Failed to write memory via abstract command - error: 0x"
+                    + Services::StringService::toHex(static_cast<std::uint8_t>(commandError))
+            };
+        };
+
+        for (
+            auto batchIndex = std::size_t{0};
+            batchIndex < words.size();
+            batchIndex += DebugTranslator::MAX_ABSTRACT_COMMAND_BATCH_WORD_COUNT
+        ) {
+            const auto batchWords = std::span{words}.subspan(
+                batchIndex,
+                std::min(words.size() - batchIndex, std::size_t{DebugTranslator::MAX_ABSTRACT_COMMAND_BATCH_WORD_COUNT})
+            );
+            const auto batchStartAddress = static_cast<TargetMemoryAddress>(
+                startAddress + batchIndex * DebugTranslator::WORD_BYTE_SIZE
             );
 
-            const auto commandError = this->tryExecuteAbstractCommand(COMMAND);
-            if (commandError != AbstractCommandError::NONE) {
-                if (commandError == AbstractCommandError::EXCEPTION) {
-                    throw Exceptions::IllegalMemoryAccess{};
+            if (this->batchAbstractMemoryAccess) {
+                auto batch = DmiBatch{};
+                batch.write(RegisterAddress::ABSTRACT_DATA_1, batchStartAddress);
+
+                auto commandError = AbstractCommandError::NONE;
+
+                if (this->debugModuleDescriptor.abstractCommandAutoExecuteSupported) {
+                    commandError = this->tryStreamAbstractCommandWrites(COMMAND, batchWords, std::move(batch));
+
+                } else {
+                    batch.reserve(batchWords.size() * 2 + 2);
+
+                    for (const auto word : batchWords) {
+                        batch.write(RegisterAddress::ABSTRACT_DATA_0, word);
+                        batch.write(RegisterAddress::ABSTRACT_COMMAND_REGISTER, COMMAND.value());
+                    }
+
+                    const auto result = this->tryExecuteAbstractCommandBatch(std::move(batch));
+                    commandError = result.hasValue() ? AbstractCommandError::NONE : result.error();
                 }
 
-                throw Exceptions::TargetOperationFailure{
-                    "Failed to write memory via abstract command - error: 0x"
-                        + Services::StringService::toHex(static_cast<std::uint8_t>(commandError))
-                };
+                if (commandError == AbstractCommandError::NONE) {
+                    continue;
+                }
+
+                if (commandError != AbstractCommandError::BUSY) {
+                    throwCommandError(commandError);
+                }
+
+                Logger::debug(
+                    "Debug module busy during batched abstract memory access - falling back to polled abstract "
+                        "commands"
+                );
+                this->batchAbstractMemoryAccess = false;
+            }
+
+            this->dtmInterface.writeDebugModuleRegister(RegisterAddress::ABSTRACT_DATA_1, batchStartAddress);
+            ++(this->dmiOperationCount);
+
+            for (const auto word : batchWords) {
+                this->dtmInterface.writeDebugModuleRegister(RegisterAddress::ABSTRACT_DATA_0, word);
+                ++(this->dmiOperationCount);
+
+                // The address in data1 is post-incremented, so the command can't be re-issued
+                const auto commandError = this->tryExecuteAbstractCommand(COMMAND, false);
+                if (commandError != AbstractCommandError::NONE) {
+                    throwCommandError(commandError);
+                }
             }
         }
+
+        Logger::debug(
+            "Wrote " + std::to_string(buffer.size()) + " byte(s) via abstract command - "
+                + std::to_string(this->dmiOperationCount - initialDmiOperationCount) + " DMI operation(s)"
+        );
     }
 
     Targets::TargetMemoryBuffer DebugTranslator::readMemoryViaProgramBuffer(
@@ -1069,6 +1644,8 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             };
         }
 
+        const auto initialDmiOperationCount = this->dmiOperationCount;
+
         auto preservedX8Register = PreservedCpuRegister{CpuRegisterNumber::GPR_X8, *this};
         auto preservedX9Register = PreservedCpuRegister{CpuRegisterNumber::GPR_X9, *this};
 
@@ -1122,45 +1699,79 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
              * To avoid reading an excess of words (which could result in an out-of-bounds exception), we only enable
              * auto execution if we require more data than what has already been read.
              */
-            const auto autoExecutionEnabled = bytes > (DebugTranslator::WORD_BYTE_SIZE * 2);
-            this->dtmInterface.writeDebugModuleRegister(
-                RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
-                AbstractCommandAutoExecuteRegister{.onData0Access = autoExecutionEnabled}.value()
-            );
+            const auto reexecutionRequired = bytes > (DebugTranslator::WORD_BYTE_SIZE * 2);
+            const auto autoExecutionEnabled = reexecutionRequired
+                && this->debugModuleDescriptor.abstractCommandAutoExecuteSupported;
+
+            /*
+             * All words but the last are read from data0, in a single batch. Any failure along the way is sticky
+             * (cmderr), so we only need to check abstractcs once, at the end of the batch.
+             *
+             * If the debug module doesn't support auto execution, we re-issue the abstract command after each data0
+             * read, instead.
+             */
+            const auto data0ReadCount = (bytes / DebugTranslator::WORD_BYTE_SIZE) - 1;
+            static constexpr auto READ_X9_COMMAND = AbstractCommandRegister{
+                .control = RegisterAccessControlField{
+                    .registerNumber = static_cast<RegisterNumber>(CpuRegisterNumber::GPR_X9),
+                    .transfer = true,
+                    .flags = {.postExecute = true},
+                    .size = RegisterAccessControlField::RegisterSize::SIZE_32
+                }.value(),
+                .commandType = AbstractCommandRegister::CommandType::REGISTER_ACCESS
+            };
+
+            auto batch = DmiBatch{};
+            batch.reserve(data0ReadCount * 2 + 3);
+
+            if (autoExecutionEnabled) {
+                batch.write(
+                    RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
+                    AbstractCommandAutoExecuteRegister{.onData0Access = true}.value()
+                );
+            }
 
-            while (output.size() < (bytes - DebugTranslator::WORD_BYTE_SIZE)) {
-                if (autoExecutionEnabled && output.size() >= (bytes - DebugTranslator::WORD_BYTE_SIZE * 2)) {
+            for (auto i = TargetMemorySize{0}; i < data0ReadCount; ++i) {
+                if (autoExecutionEnabled && i == (data0ReadCount - 1)) {
                     /*
                      * We're on the second to last word, which has already been read and currently resides in data0.
                      * The last word has also been read and currently resides in X9.
                      *
                      * Disable auto execution here to prevent any further reads.
                      */
-                    this->dtmInterface.writeDebugModuleRegister(
+                    batch.write(
                         RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
                         AbstractCommandAutoExecuteRegister{}.value()
                     );
                 }
 
-                const auto word = this->dtmInterface.readDebugModuleRegister(RegisterAddress::ABSTRACT_DATA_0);
-                output.emplace_back(static_cast<unsigned char>(word));
-                output.emplace_back(static_cast<unsigned char>(word >> 8));
-                output.emplace_back(static_cast<unsigned char>(word >> 16));
-                output.emplace_back(static_cast<unsigned char>(word >> 24));
+                batch.read(RegisterAddress::ABSTRACT_DATA_0);
+
+                if (reexecutionRequired && !autoExecutionEnabled && i < (data0ReadCount - 1)) {
+                    batch.write(RegisterAddress::ABSTRACT_COMMAND_REGISTER, READ_X9_COMMAND.value());
+                }
             }
 
-            commandError = this->readAndClearAbstractCommandError();
-            if (commandError != AbstractCommandError::NONE) {
-                if (commandError == AbstractCommandError::EXCEPTION) {
+            // Each execution of the program buffer advances the address in X8, so this batch can't be re-issued
+            const auto result = this->tryExecuteAbstractCommandBatch(std::move(batch), false);
+            if (!result.hasValue()) {
+                if (result.error() == AbstractCommandError::EXCEPTION) {
                     throw Exceptions::IllegalMemoryAccess{};
                 }
 
                 throw Exceptions::TargetOperationFailure{
                     "Program buffer execution failed - abstract command error: 0x"
-                        + Services::StringService::toHex(commandError)
+                        + Services::StringService::toHex(result.error())
                 };
             }
 
+            for (const auto word : result.value()) {
+                output.emplace_back(static_cast<unsigned char>(word));
+                output.emplace_back(static_cast<unsigned char>(word >> 8));
+                output.emplace_back(static_cast<unsigned char>(word >> 16));
+                output.emplace_back(static_cast<unsigned char>(word >> 24));
+            }
+
             const auto lastWord = this->readCpuRegister(CpuRegisterNumber::GPR_X9);
             output.emplace_back(static_cast<unsigned char>(lastWord));
             output.emplace_back(static_cast<unsigned char>(lastWord >> 8));
@@ -1170,6 +1781,11 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             preservedX8Register.restore();
             preservedX9Register.restore();
 
+            Logger::debug(
+                "Read " + std::to_string(bytes) + " byte(s) via program buffer - "
+                    + std::to_string(this->dmiOperationCount - initialDmiOperationCount) + " DMI operation(s)"
+            );
+
             return output;
 
         } catch (const Exceptions::Exception&) {
@@ -1207,6 +1823,8 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             };
         }
 
+        const auto initialDmiOperationCount = this->dmiOperationCount;
+
         auto preservedX8Register = PreservedCpuRegister{CpuRegisterNumber::GPR_X8, *this};
         auto preservedX9Register = PreservedCpuRegister{CpuRegisterNumber::GPR_X9, *this};
 
@@ -1225,17 +1843,38 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
                 {.postExecute = true}
             );
 
-            this->dtmInterface.writeDebugModuleRegister(
-                RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
-                AbstractCommandAutoExecuteRegister{.onData0Access = true}.value()
-            );
+            /*
+             * If the debug module doesn't support auto execution, we re-issue the abstract command after each data0
+             * write.
+             */
+            const auto autoExecutionEnabled = this->debugModuleDescriptor.abstractCommandAutoExecuteSupported;
+            static constexpr auto WRITE_X9_COMMAND = AbstractCommandRegister{
+                .control = RegisterAccessControlField{
+                    .registerNumber = static_cast<RegisterNumber>(CpuRegisterNumber::GPR_X9),
+                    .write = true,
+                    .transfer = true,
+                    .flags = {.postExecute = true},
+                    .size = RegisterAccessControlField::RegisterSize::SIZE_32
+                }.value(),
+                .commandType = AbstractCommandRegister::CommandType::REGISTER_ACCESS
+            };
+
+            auto batch = DmiBatch{};
+            batch.reserve(buffer.size() / DebugTranslator::WORD_BYTE_SIZE * 2 + 2);
+
+            if (autoExecutionEnabled) {
+                batch.write(
+                    RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
+                    AbstractCommandAutoExecuteRegister{.onData0Access = true}.value()
+                );
+            }
 
             for (
                 auto offset = std::size_t{DebugTranslator::WORD_BYTE_SIZE};
                 offset < buffer.size();
                 offset += DebugTranslator::WORD_BYTE_SIZE
             ) {
-                this->dtmInterface.writeDebugModuleRegister(
+                batch.write(
                     RegisterAddress::ABSTRACT_DATA_0,
                     static_cast<RegisterValue>(
                         (buffer[offset + 3] << 24)
@@ -1244,28 +1883,40 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
                         | (buffer[offset])
                     )
                 );
+
+                if (!autoExecutionEnabled) {
+                    batch.write(RegisterAddress::ABSTRACT_COMMAND_REGISTER, WRITE_X9_COMMAND.value());
+                }
             }
 
-            this->dtmInterface.writeDebugModuleRegister(
-                RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
-                AbstractCommandAutoExecuteRegister{}.value()
-            );
+            if (autoExecutionEnabled) {
+                batch.write(
+                    RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER,
+                    AbstractCommandAutoExecuteRegister{}.value()
+                );
+            }
 
-            const auto commandError = this->readAndClearAbstractCommandError();
-            if (commandError != AbstractCommandError::NONE) {
-                if (commandError == AbstractCommandError::EXCEPTION) {
+            // Each execution of the program buffer advances the address in X8, so this batch can't be re-issued
+            const auto result = this->tryExecuteAbstractCommandBatch(std::move(batch), false);
+            if (!result.hasValue()) {
+                if (result.error() == AbstractCommandError::EXCEPTION) {
                     throw Exceptions::IllegalMemoryAccess{};
                 }
 
                 throw Exceptions::TargetOperationFailure{
                     "Program buffer execution failed - abstract command error: 0x"
-                        + Services::StringService::toHex(commandError)
+                        + Services::StringService::toHex(result.error())
                 };
             }
 
             preservedX8Register.restore();
             preservedX9Register.restore();
 
+            Logger::debug(
+                "Wrote " + std::to_string(buffer.size()) + " byte(s) via program buffer - "
+                    + std::to_string(this->dmiOperationCount - initialDmiOperationCount) + " DMI operation(s)"
+            );
+
         } catch (const Exceptions::Exception&) {
             preservedX8Register.restoreOnce();
             preservedX9Register.restoreOnce();
@@ -1273,15 +1924,201 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         }
     }
 
+    Targets::TargetMemoryBuffer DebugTranslator::readMemoryViaSystemBus(
+        Targets::TargetMemoryAddress startAddress,
+        Targets::TargetMemorySize bytes
+    ) {
+        assert(bytes > 0);
+        assert(startAddress % DebugTranslator::WORD_BYTE_SIZE == 0);
+        assert(bytes % DebugTranslator::WORD_BYTE_SIZE == 0);
+
+        const auto wordCount = bytes / DebugTranslator::WORD_BYTE_SIZE;
+
+        /*
+         * With sbreadonaddr enabled, the write to sbaddress0 will trigger the first read. With sbreadondata and
+         * sbautoincrement enabled, each read of sbdata0 will trigger the read of the next word.
+         *
+         * We also clear any left-over errors here (sberror and sbbusyerror are write-1-to-clear).
+         */
+        auto controlStatusRegister = SystemBusAccessControlStatusRegister{
+            .clearError = true,
+            .readOnData = wordCount > 1,
+            .autoIncrement = true,
+            .accessSize = SystemBusAccessControlStatusRegister::AccessSize::SIZE_32,
+            .readOnAddress = true,
+            .busyError = true,
+        };
+
+        for (auto attempt = 0; attempt < 2; ++attempt) {
+            const auto waitForEachAccess = attempt > 0;
+
+            auto output = TargetMemoryBuffer{};
+            output.reserve(bytes);
+
+            this->waitForSystemBus();
+            this->dtmInterface.writeDebugModuleRegister(
+                RegisterAddress::SYSTEM_BUS_ACCESS_CONTROL_STATUS_REGISTER,
+                controlStatusRegister.value()
+            );
+            this->dtmInterface.writeDebugModuleRegister(RegisterAddress::SYSTEM_BUS_ADDRESS_0, startAddress);
+
+            for (auto wordIndex = TargetMemorySize{0}; wordIndex < wordCount; ++wordIndex) {
+                if (waitForEachAccess) {
+                    this->waitForSystemBus();
+                }
+
+                if (wordCount > 1 && wordIndex == (wordCount - 1)) {
+                    /*
+                     * Disable sbreadondata before reading the last word, to prevent the debug module from reading
+                     * beyond the requested range. We mustn't clear any errors here, as we check for them below.
+                     */
+                    auto lastReadControlStatusRegister = controlStatusRegister;
+                    lastReadControlStatusRegister.clearError = false;
+                    lastReadControlStatusRegister.busyError = false;
+                    lastReadControlStatusRegister.readOnData = false;
+
+                    this->dtmInterface.writeDebugModuleRegister(
+                        RegisterAddress::SYSTEM_BUS_ACCESS_CONTROL_STATUS_REGISTER,
+                        lastReadControlStatusRegister.value()
+                    );
+                }
+
+                const auto word = this->dtmInterface.readDebugModuleRegister(RegisterAddress::SYSTEM_BUS_DATA_0);
+                output.emplace_back(static_cast<unsigned char>(word));
+                output.emplace_back(static_cast<unsigned char>(word >> 8));
+                output.emplace_back(static_cast<unsigned char>(word >> 16));
+                output.emplace_back(static_cast<unsigned char>(word >> 24));
+            }
+
+            if (!this->checkAndClearSystemBusErrors(this->waitForSystemBus())) {
+                return output;
+            }
+
+            Logger::debug("System bus busy error during memory read - retrying with waits between accesses");
+        }
+
+        throw Exceptions::TargetOperationFailure{"Failed to read memory via system bus - debug module busy"};
+    }
+
+    void DebugTranslator::writeMemoryViaSystemBus(
+        Targets::TargetMemoryAddress startAddress,
+        Targets::TargetMemoryBufferSpan buffer
+    ) {
+        assert(!buffer.empty());
+        assert(startAddress % DebugTranslator::WORD_BYTE_SIZE == 0);
+        assert(buffer.size() % DebugTranslator::WORD_BYTE_SIZE == 0);
+
+        static constexpr auto CONTROL_STATUS_REGISTER = SystemBusAccessControlStatusRegister{
+            .clearError = true,
+            .autoIncrement = true,
+            .accessSize = SystemBusAccessControlStatusRegister::AccessSize::SIZE_32,
+            .busyError = true,
+        };
+
+        for (auto attempt = 0; attempt < 2; ++attempt) {
+            const auto waitForEachAccess = attempt > 0;
+
+            this->waitForSystemBus();
+            this->dtmInterface.writeDebugModuleRegister(
+                RegisterAddress::SYSTEM_BUS_ACCESS_CONTROL_STATUS_REGISTER,
+                CONTROL_STATUS_REGISTER.value()
+            );
+            this->dtmInterface.writeDebugModuleRegister(RegisterAddress::SYSTEM_BUS_ADDRESS_0, startAddress);
+
+            for (auto offset = std::size_t{0}; offset < buffer.size(); offset += DebugTranslator::WORD_BYTE_SIZE) {
+                if (waitForEachAccess) {
+                    this->waitForSystemBus();
+                }
+
+                this->dtmInterface.writeDebugModuleRegister(
+                    RegisterAddress::SYSTEM_BUS_DATA_0,
+                    static_cast<RegisterValue>(
+                        (buffer[offset + 3] << 24)
+                        | (buffer[offset + 2] << 16)
+                        | (buffer[offset + 1] << 8)
+                        | (buffer[offset])
+                    )
+                );
+            }
+
+            if (!this->checkAndClearSystemBusErrors(this->waitForSystemBus())) {
+                return;
+            }
+
+            Logger::debug("System bus busy error during memory write - retrying with waits between accesses");
+        }
+
+        throw Exceptions::TargetOperationFailure{"Failed to write memory via system bus - debug module busy"};
+    }
+
+    SystemBusAccessControlStatusRegister DebugTranslator::waitForSystemBus() {
+        auto controlStatusRegister = SystemBusAccessControlStatusRegister{};
+        this->systemBusPoller.poll(
+            [this, &controlStatusRegister] {
+                controlStatusRegister = this->readSystemBusAccessControlStatusRegister();
+                return !controlStatusRegister.busy;
+            },
+            this->config.targetResponseTimeout
+        );
+
+        if (controlStatusRegister.busy) {
+            throw Exceptions::TargetOperationFailure{"System bus access took too long to complete"};
+        }
+
+        return controlStatusRegister;
+    }
+
+    bool DebugTranslator::checkAndClearSystemBusErrors(
+        const SystemBusAccessControlStatusRegister& controlStatusRegister
+    ) {
+        using Error = SystemBusAccessControlStatusRegister::Error;
+
+        if (controlStatusRegister.error == Error::NONE && !controlStatusRegister.busyError) {
+            return false;
+        }
+
+        this->dtmInterface.writeDebugModuleRegister(
+            RegisterAddress::SYSTEM_BUS_ACCESS_CONTROL_STATUS_REGISTER,
+            SystemBusAccessControlStatusRegister{.clearError = true, .busyError = true}.value()
+        );
+
+        if (controlStatusRegister.error == Error::BAD_ADDRESS) {
+            throw Exceptions::IllegalMemoryAccess{};
+        }
+
+        if (controlStatusRegister.error != Error::NONE) {
+            throw Exceptions::TargetOperationFailure{
+                "System bus access failed - error: 0x"
+                    + Services::StringService::toHex(static_cast<std::uint8_t>(controlStatusRegister.error))
+            };
+        }
+
+        return true;
+    }
+
     void DebugTranslator::writeProgramBuffer(std::span<const Targets::RiscV::Opcodes::Opcode> opcodes) {
         assert(opcodes.size() <= 16);
         assert(opcodes.size() <= this->debugModuleDescriptor.programBufferSize);
 
+        auto batch = DmiBatch{};
+        batch.reserve(opcodes.size());
+
         auto programBufferAddress = static_cast<DebugModule::RegisterAddress>(RegisterAddress::PROGRAM_BUFFER_0);
         for (const auto& opcode : opcodes) {
-            this->dtmInterface.writeDebugModuleRegister(programBufferAddress, opcode);
+            batch.write(programBufferAddress, opcode);
             ++programBufferAddress;
         }
+
+        try {
+            this->executeDmiBatch(batch);
+
+        } catch (const Exceptions::DmiBatchInterrupted& exception) {
+            Logger::debug(exception.getMessage());
+            this->recoverFromInterruptedDmiBatch();
+
+            // Program buffer writes have no side effects, so we can just start over
+            this->executeDmiBatch(batch);
+        }
     }
 
     std::optional<
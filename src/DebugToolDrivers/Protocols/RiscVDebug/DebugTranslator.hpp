@@ -9,8 +9,10 @@
 #include <unordered_set>
 #include <optional>
 #include <functional>
+#include <span>
 
 #include "DebugTransportModuleInterface.hpp"
+#include "DmiBatch.hpp"
 #include "DebugTranslatorConfig.hpp"
 #include "DebugModuleDescriptor.hpp"
 
@@ -33,11 +35,13 @@
 #include "DebugModule/Registers/AbstractControlStatusRegister.hpp"
 #include "DebugModule/Registers/AbstractCommandRegister.hpp"
 #include "DebugModule/Registers/RegisterAccessControlField.hpp"
+#include "DebugModule/Registers/SystemBusAccessControlStatusRegister.hpp"
 
 #include "TriggerModule/TriggerModule.hpp"
 #include "TriggerModule/TriggerDescriptor.hpp"
 
 #include "src/Helpers/Expected.hpp"
+#include "src/Helpers/AdaptivePoller.hpp"
 
 namespace DebugToolDrivers::Protocols::RiscVDebug
 {
@@ -90,6 +94,22 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             Targets::TargetMemoryBufferSpan buffer
         );
 
+        /**
+         * Returns the maximum number of bytes we can read from memory in a single DMI batch, via the selected memory
+         * access strategy.
+         *
+         * @return
+         */
+        Targets::TargetMemorySize maximumMemoryReadSize() const;
+
+        /**
+         * Memory can only be accessed whilst the hart is running if we're accessing it via the system bus. The other
+         * memory access strategies require the hart to be halted.
+         *
+         * @return
+         */
+        bool canReadMemoryWhileRunning() const;
+
         DebugModule::AbstractCommandError readAndClearAbstractCommandError();
 
         /**
@@ -110,6 +130,11 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         static constexpr auto WORD_BYTE_SIZE = ::Targets::TargetMemorySize{4};
         static constexpr auto MAX_PROGRAM_BUFFER_SIZE = std::uint8_t{16};
 
+        /**
+         * The maximum number of words we access in a single batch, when accessing memory via abstract commands.
+         */
+        static constexpr auto MAX_ABSTRACT_COMMAND_BATCH_WORD_COUNT = ::Targets::TargetMemorySize{64};
+
         DebugTransportModuleInterface& dtmInterface;
         const DebugTranslatorConfig& config;
 
@@ -118,6 +143,18 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
 
         const ::Targets::TargetAddressSpaceDescriptor sysAddressSpaceDescriptor;
 
+        /*
+         * Each operation that waits on the debug module has its own poller, as the backoff adapts to the latencies
+         * observed for the operation.
+         */
+        AdaptivePoller haltPoller;
+        AdaptivePoller resumePoller;
+        AdaptivePoller resetPoller;
+        AdaptivePoller debugModuleActivationPoller;
+        AdaptivePoller debugModuleDeactivationPoller;
+        AdaptivePoller abstractCommandPoller;
+        AdaptivePoller systemBusPoller;
+
         DebugModuleDescriptor debugModuleDescriptor = {};
 
         DebugModule::HartIndex selectedHartIndex = 0;
@@ -125,12 +162,48 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         std::unordered_set<TriggerModule::TriggerIndex> allocatedTriggerIndices;
         std::unordered_map<Targets::TargetMemoryAddress, TriggerModule::TriggerIndex> triggerIndicesByBreakpointAddress;
 
+        /**
+         * Memory access abstract commands are issued back-to-back in DMI batches, without checking abstractcs.busy
+         * between them. If the debug module can't keep up (cmderr is set to busy), we fall back to polling abstractcs
+         * after each command, for the remainder of the session.
+         */
+        bool batchAbstractMemoryAccess = true;
+
+        /**
+         * Whether DMI batches are passed to the DTM as a whole (to be pipelined, where the DTM supports it). Cleared
+         * when the DTM reports an interrupted batch (see DmiBatchInterrupted), after which each operation in a batch
+         * is issued individually, for the remainder of the session.
+         */
+        bool pipelineDmiBatches = true;
+
+        /**
+         * The number of DMI operations issued via tryExecuteAbstractCommandBatch() and the bulk memory and register
+         * access paths. For reporting round trips in debug logs.
+         */
+        std::uint64_t dmiOperationCount = 0;
+
+        /**
+         * Each check involves a round trip to the debug tool, which will usually take longer than the (relatively
+         * small) target response timeout. So we also enforce a minimum number of checks, derived from the timeout and
+         * the minimum delay between checks.
+         */
+        [[nodiscard]] AdaptivePoller::Config debugModulePollerConfig() const {
+            return AdaptivePoller::Config{
+                .minimumDelay = DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY,
+                .maximumDelay = std::chrono::milliseconds{1},
+                .minimumChecks = static_cast<std::uint32_t>(
+                    this->config.targetResponseTimeout / DebugTranslator::DEBUG_MODULE_RESPONSE_DELAY
+                ) + 1,
+            };
+        }
+
         std::vector<DebugModule::HartIndex> discoverHartIndices();
         std::unordered_map<TriggerModule::TriggerIndex, TriggerModule::TriggerDescriptor> discoverTriggers();
 
         DebugModule::Registers::ControlRegister readDebugModuleControlRegister();
         DebugModule::Registers::StatusRegister readDebugModuleStatusRegister();
         DebugModule::Registers::AbstractControlStatusRegister readDebugModuleAbstractControlStatusRegister();
+        DebugModule::Registers::SystemBusAccessControlStatusRegister readSystemBusAccessControlStatusRegister();
         Registers::DebugControlStatusRegister readDebugControlStatusRegister();
 
         void enableDebugModule();
@@ -180,11 +253,109 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         void writeDebugControlStatusRegister(const Registers::DebugControlStatusRegister& controlRegister);
 
         void clearAbstractCommandError();
+
+        /**
+         * Executes the batch via the DTM, or one operation at a time if pipelining has been disabled (see
+         * pipelineDmiBatches).
+         *
+         * @param batch
+         *
+         * @return
+         *
+         * @throws DmiBatchInterrupted
+         *  If the DTM couldn't execute the batch in full. See recoverFromInterruptedDmiBatch().
+         */
+        std::vector<RegisterValue> executeDmiBatch(const DmiBatch& batch);
+
+        /**
+         * Restores the debug module to a known state, following an interrupted DMI batch, and disables DMI
+         * pipelining.
+         *
+         * The operations in the interrupted batch may or may not have been performed, so the caller must start over
+         * from the beginning of whatever the batch was part of (not just the batch itself, if it relies on state set
+         * up by previous batches, such as the abstract command and data1 address used for auto execution).
+         *
+         * Waits for any abstract command in progress to complete, disables abstract command auto execution and
+         * clears abstractcs.cmderr.
+         */
+        void recoverFromInterruptedDmiBatch();
+
+        /**
+         * See tryExecuteAbstractCommandBatch(), for reissueOnInterruption.
+         */
         DebugModule::AbstractCommandError tryExecuteAbstractCommand(
-            const DebugModule::Registers::AbstractCommandRegister& abstractCommandRegister
+            const DebugModule::Registers::AbstractCommandRegister& abstractCommandRegister,
+            bool reissueOnInterruption = true
         );
         void executeAbstractCommand(const DebugModule::Registers::AbstractCommandRegister& abstractCommandRegister);
 
+        /**
+         * Executes a batch of DMI operations that issue abstract commands, followed by a read of abstractcs, to
+         * determine whether any of the commands failed.
+         *
+         * This relies on the sticky nature of abstractcs.cmderr - once an error has occurred, the debug module
+         * ignores all subsequent abstract commands until the error has been cleared. If the last command is still
+         * in progress when abstractcs is read, we poll until it completes. Any error is cleared before returning.
+         *
+         * If the DTM reports an interrupted batch, we recover the debug module (see recoverFromInterruptedDmiBatch())
+         * and re-issue the whole batch, one operation at a time. This is transparent to the caller, but it's only
+         * correct for batches that can be repeated from the start - batches that set up all of the state they rely
+         * on, and whose abstract commands have no cumulative effect.
+         *
+         * Batches that rely on state set up by a previous batch (such as auto execution streams), or that execute
+         * the program buffer, must be issued with reissueOnInterruption set to false. The DmiBatchInterrupted
+         * exception is then rethrown, after recovery, and the caller must start over from the beginning of the
+         * operation.
+         *
+         * @param batch
+         * @param reissueOnInterruption
+         *
+         * @return
+         *  The values of the read operations in the batch, or the abstract command error.
+         *
+         * @throws DmiBatchInterrupted
+         *  If the batch was interrupted and reissueOnInterruption is false.
+         */
+        Expected<std::vector<RegisterValue>, DebugModule::AbstractCommandError> tryExecuteAbstractCommandBatch(
+            DmiBatch batch,
+            bool reissueOnInterruption = true
+        );
+
+        /**
+         * Executes the given abstract command (preceded by the operations in setupBatch), then re-executes it
+         * (count - 1) times via auto execution on data0 reads, so that each subsequent word costs a single DMI read.
+         *
+         * The command must transfer to data0 and post-increment its address or register number.
+         *
+         * @param command
+         * @param count
+         * @param setupBatch
+         *
+         * @return
+         *  The value of data0 after each execution of the command, or the abstract command error.
+         */
+        Expected<std::vector<RegisterValue>, DebugModule::AbstractCommandError> tryStreamAbstractCommandReads(
+            const DebugModule::Registers::AbstractCommandRegister& command,
+            std::uint32_t count,
+            DmiBatch setupBatch = {}
+        );
+
+        /**
+         * Executes the given abstract command once for each value, writing the value to data0 beforehand. After the
+         * first execution, the command is re-executed via auto execution on data0 writes.
+         *
+         * @param command
+         * @param values
+         * @param setupBatch
+         *
+         * @return
+         */
+        DebugModule::AbstractCommandError tryStreamAbstractCommandWrites(
+            const DebugModule::Registers::AbstractCommandRegister& command,
+            std::span<const RegisterValue> values,
+            DmiBatch setupBatch = {}
+        );
+
         DebugModule::MemoryAccessStrategy determineMemoryAccessStrategy();
 
         Targets::TargetMemoryBuffer readMemoryViaAbstractCommand(
@@ -205,6 +376,40 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             Targets::TargetMemoryBufferSpan buffer
         );
 
+        /**
+         * Reads memory via system bus access, with sbautoincrement and sbreadondata enabled, so that each word costs a
+         * single DMI read of sbdata0. The hart is not involved, so this can be used whilst the hart is running.
+         *
+         * If the debug module reports a busy error (we read sbdata0 before the system bus read completed), we clear
+         * the error and retry, waiting for the system bus before each access.
+         */
+        Targets::TargetMemoryBuffer readMemoryViaSystemBus(
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes
+        );
+        void writeMemoryViaSystemBus(
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemoryBufferSpan buffer
+        );
+
+        /**
+         * Waits for any in-progress system bus access to complete.
+         *
+         * @return
+         *  The system bus access control and status register.
+         */
+        DebugModule::Registers::SystemBusAccessControlStatusRegister waitForSystemBus();
+
+        /**
+         * Checks the system bus access control and status register for errors, clearing any that are found.
+         *
+         * @return
+         *  True if a busy error was found (the operation must be retried), false if there were no errors.
+         */
+        bool checkAndClearSystemBusErrors(
+            const DebugModule::Registers::SystemBusAccessControlStatusRegister& controlStatusRegister
+        );
+
         void writeProgramBuffer(std::span<const Targets::RiscV::Opcodes::Opcode> opcodes);
 
         std::optional<std::reference_wrapper<const TriggerModule::TriggerDescriptor>> getAvailableTrigger();
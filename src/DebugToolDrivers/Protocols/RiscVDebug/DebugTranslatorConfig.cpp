@@ -23,6 +23,9 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
             } else if (strategy == "program_buffer") {
                 this->preferredMemoryAccessStrategy = DebugModule::MemoryAccessStrategy::PROGRAM_BUFFER;
 
+            } else if (strategy == "system_bus") {
+                this->preferredMemoryAccessStrategy = DebugModule::MemoryAccessStrategy::SYSTEM_BUS;
+
             } else {
                 Logger::error(
                     "Invalid value (\"" + strategy + "\") provided for RISC-V debug translator config parameter "
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <vector>
+
 #include "Common.hpp"
 #include "DebugModule/DebugModule.hpp"
 #include "DebugModule/Registers/RegisterAddresses.hpp"
+#include "DmiBatch.hpp"
 
 namespace DebugToolDrivers::Protocols::RiscVDebug
 {
@@ -44,5 +47,36 @@ namespace DebugToolDrivers::Protocols::RiscVDebug
         ) {
             return this->writeDebugModuleRegister(static_cast<DebugModule::RegisterAddress>(address), value);
         };
+
+        /**
+         * Executes a batch of DMI operations, in order, and returns the values of the read operations.
+         *
+         * DTM implementations that can pipeline DMI operations should override this, to execute the batch in as few
+         * transport transactions as possible. The default implementation issues each operation individually.
+         *
+         * Implementations must never retry part of a batch without knowing which of its operations were performed.
+         * If that can't be established, they should throw a DmiBatchInterrupted exception.
+         *
+         * @param batch
+         *
+         * @return
+         */
+        virtual std::vector<DebugModule::RegisterValue> executeDmiBatch(const DmiBatch& batch) {
+            auto output = std::vector<DebugModule::RegisterValue>{};
+            output.reserve(batch.readCount());
+
+            for (const auto& operation : batch.operations()) {
+                if (operation.operation == DebugModule::DmiOperation::READ) {
+                    output.push_back(this->readDebugModuleRegister(operation.address));
+                    continue;
+                }
+
+                if (operation.operation == DebugModule::DmiOperation::WRITE) {
+                    this->writeDebugModuleRegister(operation.address, operation.value);
+                }
+            }
+
+            return output;
+        }
     };
 }
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "DebugModule/DebugModule.hpp"
+#include "DebugModule/Registers/RegisterAddresses.hpp"
+
+namespace DebugToolDrivers::Protocols::RiscVDebug
+{
+    struct DmiBatchOperation
+    {
+        DebugModule::DmiOperation operation;
+        DebugModule::RegisterAddress address;
+        DebugModule::RegisterValue value = 0;
+    };
+
+    /**
+     * A sequence of DMI operations, to be executed in order via DebugTransportModuleInterface::executeDmiBatch().
+     *
+     * The values of read operations are returned in the order in which the reads were queued. read() returns the
+     * index of the read value, in the returned vector.
+     *
+     * Operations in a batch are issued without the caller inspecting the outcome of each one, so batches should only
+     * contain sequences whose failure can be detected after the fact (e.g. via the sticky abstractcs.cmderr field).
+     */
+    class DmiBatch
+    {
+    public:
+        std::size_t read(DebugModule::RegisterAddress address) {
+            this->operationList.emplace_back(DmiBatchOperation{
+                .operation = DebugModule::DmiOperation::READ,
+                .address = address
+            });
+
+            return this->reads++;
+        }
+
+        std::size_t read(DebugModule::Registers::RegisterAddress address) {
+            return this->read(static_cast<DebugModule::RegisterAddress>(address));
+        }
+
+        void write(DebugModule::RegisterAddress address, DebugModule::RegisterValue value) {
+            this->operationList.emplace_back(DmiBatchOperation{
+                .operation = DebugModule::DmiOperation::WRITE,
+                .address = address,
+                .value = value
+            });
+        }
+
+        void write(DebugModule::Registers::RegisterAddress address, DebugModule::RegisterValue value) {
+            this->write(static_cast<DebugModule::RegisterAddress>(address), value);
+        }
+
+        void reserve(std::size_t operationCount) {
+            this->operationList.reserve(operationCount);
+        }
+
+        [[nodiscard]] const std::vector<DmiBatchOperation>& operations() const {
+            return this->operationList;
+        }
+
+        [[nodiscard]] std::size_t readCount() const {
+            return this->reads;
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return this->operationList.size();
+        }
+
+        [[nodiscard]] bool empty() const {
+            return this->operationList.empty();
+        }
+
+    private:
+        std::vector<DmiBatchOperation> operationList;
+        std::size_t reads = 0;
+    };
+}
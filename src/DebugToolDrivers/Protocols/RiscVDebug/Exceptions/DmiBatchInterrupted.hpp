@@ -0,0 +1,20 @@
+#pragma once
+
+#include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
+
+namespace Exceptions
+{
+    /**
+     * Thrown by DebugTransportModuleInterface::executeDmiBatch() implementations when a batch was interrupted part
+     * way through, such that it's unknown which of its operations were performed.
+     *
+     * The state of the debug module is unknown after this exception. The caller is responsible for restoring it.
+     */
+    class DmiBatchInterrupted: public DeviceCommunicationFailure
+    {
+    public:
+        explicit DmiBatchInterrupted(const std::string& message)
+            : DeviceCommunicationFailure(message)
+        {}
+    };
+}
@@ -0,0 +1,592 @@
+#include "SimulatedDebugModule.hpp"
+
+#include <algorithm>
+
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugModule/Registers/RegisterAddresses.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugModule/Registers/ControlRegister.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugModule/Registers/StatusRegister.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugModule/Registers/AbstractControlStatusRegister.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugModule/Registers/AbstractCommandRegister.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugModule/Registers/RegisterAccessControlField.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugModule/Registers/MemoryAccessControlField.hpp"
+
+#include "src/Exceptions/InvalidConfig.hpp"
+
+namespace DebugToolDrivers::Protocols::RiscVDebug::Simulator
+{
+    using DebugModule::RegisterValue;
+    using DebugModule::AbstractCommandError;
+    using DebugModule::Registers::RegisterAddress;
+    using DebugModule::Registers::ControlRegister;
+    using DebugModule::Registers::StatusRegister;
+    using DebugModule::Registers::AbstractControlStatusRegister;
+    using DebugModule::Registers::AbstractCommandRegister;
+    using DebugModule::Registers::RegisterAccessControlField;
+    using DebugModule::Registers::MemoryAccessControlField;
+    using DebugModule::Registers::SystemBusAccessControlStatusRegister;
+
+    namespace
+    {
+        constexpr auto registerAddress(RegisterAddress address) {
+            return static_cast<DebugModule::RegisterAddress>(address);
+        }
+
+        static constexpr auto ABSTRACT_DATA_0 = registerAddress(RegisterAddress::ABSTRACT_DATA_0);
+        static constexpr auto PROGRAM_BUFFER_0 = registerAddress(RegisterAddress::PROGRAM_BUFFER_0);
+
+        // Bits 16 to 31 of abstractauto (autoexecprogbuf) correspond to the program buffer registers
+        static constexpr auto PROGRAM_BUFFER_AUTO_EXECUTE_OFFSET = std::uint8_t{16};
+
+        // Debug module spec v1.0
+        static constexpr auto DEBUG_MODULE_VERSION = std::uint8_t{0x03};
+    }
+
+    std::string SimulatedDebugModule::Statistics::toString() const {
+        return "transactions: " + std::to_string(this->transactions())
+            + ", round trips: " + std::to_string(this->roundTrips())
+            + " (reads: " + std::to_string(this->registerReads)
+            + ", writes: " + std::to_string(this->registerWrites) + ")"
+            + ", abstract commands: " + std::to_string(this->abstractCommands)
+            + ", program buffer executions: " + std::to_string(this->programBufferExecutions)
+            + ", system bus accesses: " + std::to_string(this->systemBusAccesses);
+    }
+
+    SimulatedDebugModule::SimulatedDebugModule(const SimulatedDebugModuleConfig& config)
+        : config(config)
+        , memory(config.memoryRegions)
+        , hart(this->memory, config.triggerCount, config.resetVector)
+    {
+        if (this->config.abstractDataRegisterCount > SimulatedDebugModule::MAX_ABSTRACT_DATA_REGISTER_COUNT) {
+            throw Exceptions::InvalidConfig{"Simulated debug module supports at most 12 abstract data registers"};
+        }
+
+        if (this->config.programBufferSize > SimulatedDebugModule::MAX_PROGRAM_BUFFER_SIZE) {
+            throw Exceptions::InvalidConfig{"Simulated debug module supports at most 16 program buffer registers"};
+        }
+
+        this->resetDebugModuleState();
+    }
+
+    RegisterValue SimulatedDebugModule::readDebugModuleRegister(DebugModule::RegisterAddress address) {
+        ++(this->statistics.registerReads);
+        this->advance();
+
+        if (address == registerAddress(RegisterAddress::CONTROL_REGISTER)) {
+            return ControlRegister{
+                .debugModuleActive = this->active,
+                .ndmReset = this->ndmReset,
+                .selectedHartIndex = this->selectedHartIndex,
+            }.value();
+        }
+
+        if (!this->active) {
+            return 0;
+        }
+
+        if (address >= ABSTRACT_DATA_0 && address < (ABSTRACT_DATA_0 + this->config.abstractDataRegisterCount)) {
+            if (this->rejectAccessIfBusy()) {
+                return 0;
+            }
+
+            const auto index = static_cast<std::uint8_t>(address - ABSTRACT_DATA_0);
+            const auto value = this->abstractData[index];
+            this->autoExecute(index);
+            return value;
+        }
+
+        if (address >= PROGRAM_BUFFER_0 && address < (PROGRAM_BUFFER_0 + this->config.programBufferSize)) {
+            if (this->rejectAccessIfBusy()) {
+                return 0;
+            }
+
+            const auto index = static_cast<std::uint8_t>(address - PROGRAM_BUFFER_0);
+            const auto value = this->programBuffer[index];
+            this->autoExecute(static_cast<std::uint8_t>(PROGRAM_BUFFER_AUTO_EXECUTE_OFFSET + index));
+            return value;
+        }
+
+        switch (static_cast<RegisterAddress>(address)) {
+            case RegisterAddress::STATUS_REGISTER: {
+                return this->statusRegisterValue();
+            }
+            case RegisterAddress::ABSTRACT_CONTROL_STATUS_REGISTER: {
+                const auto busy = this->remainingBusyReads > 0;
+                if (busy) {
+                    --(this->remainingBusyReads);
+                }
+
+                return AbstractControlStatusRegister{
+                    .dataRegisterCount = this->config.abstractDataRegisterCount,
+                    .commandError = this->commandError,
+                    .busy = busy,
+                    .programBufferSize = this->config.programBufferSize,
+                }.value();
+            }
+            case RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER: {
+                return this->abstractCommandAutoExecute;
+            }
+            case RegisterAddress::SYSTEM_BUS_ACCESS_CONTROL_STATUS_REGISTER: {
+                return this->config.systemBusAccess ? this->systemBusControlStatus.value() : 0;
+            }
+            case RegisterAddress::SYSTEM_BUS_ADDRESS_0: {
+                return this->config.systemBusAccess ? this->systemBusAddress : 0;
+            }
+            case RegisterAddress::SYSTEM_BUS_DATA_0: {
+                if (!this->config.systemBusAccess) {
+                    return 0;
+                }
+
+                const auto value = this->systemBusData;
+                if (this->systemBusControlStatus.readOnData) {
+                    this->systemBusRead();
+                }
+
+                return value;
+            }
+            default: {
+                // The command register is write-only. Unimplemented registers read as 0.
+                return 0;
+            }
+        }
+    }
+
+    void SimulatedDebugModule::writeDebugModuleRegister(DebugModule::RegisterAddress address, RegisterValue value) {
+        ++(this->statistics.registerWrites);
+        this->advance();
+
+        if (address == registerAddress(RegisterAddress::CONTROL_REGISTER)) {
+            this->writeControlRegister(value);
+            return;
+        }
+
+        if (!this->active) {
+            return;
+        }
+
+        if (address >= ABSTRACT_DATA_0 && address < (ABSTRACT_DATA_0 + this->config.abstractDataRegisterCount)) {
+            if (this->rejectAccessIfBusy()) {
+                return;
+            }
+
+            const auto index = static_cast<std::uint8_t>(address - ABSTRACT_DATA_0);
+            this->abstractData[index] = value;
+            this->autoExecute(index);
+            return;
+        }
+
+        if (address >= PROGRAM_BUFFER_0 && address < (PROGRAM_BUFFER_0 + this->config.programBufferSize)) {
+            if (this->rejectAccessIfBusy()) {
+                return;
+            }
+
+            const auto index = static_cast<std::uint8_t>(address - PROGRAM_BUFFER_0);
+            this->programBuffer[index] = value;
+            this->autoExecute(static_cast<std::uint8_t>(PROGRAM_BUFFER_AUTO_EXECUTE_OFFSET + index));
+            return;
+        }
+
+        switch (static_cast<RegisterAddress>(address)) {
+            case RegisterAddress::ABSTRACT_CONTROL_STATUS_REGISTER: {
+                // cmderr is write-1-to-clear
+                const auto clearBits = AbstractControlStatusRegister::fromValue(value).commandError;
+                this->commandError = static_cast<AbstractCommandError>(
+                    static_cast<std::uint8_t>(this->commandError) & ~static_cast<std::uint8_t>(clearBits)
+                );
+                return;
+            }
+            case RegisterAddress::ABSTRACT_COMMAND_REGISTER: {
+                if (this->rejectAccessIfBusy() || this->commandError != AbstractCommandError::NONE) {
+                    return;
+                }
+
+                this->abstractCommand = value;
+                this->executeAbstractCommand();
+                return;
+            }
+            case RegisterAddress::ABSTRACT_COMMAND_AUTO_EXECUTE_REGISTER: {
+                const auto dataMask = (RegisterValue{0x01} << this->config.abstractDataRegisterCount) - 1;
+                const auto programBufferMask = (
+                    (RegisterValue{0x01} << this->config.programBufferSize) - 1
+                ) << PROGRAM_BUFFER_AUTO_EXECUTE_OFFSET;
+
+                this->abstractCommandAutoExecute = value & (dataMask | programBufferMask);
+                return;
+            }
+            case RegisterAddress::SYSTEM_BUS_ACCESS_CONTROL_STATUS_REGISTER: {
+                if (this->config.systemBusAccess) {
+                    this->writeSystemBusControlStatusRegister(value);
+                }
+                return;
+            }
+            case RegisterAddress::SYSTEM_BUS_ADDRESS_0: {
+                if (!this->config.systemBusAccess) {
+                    return;
+                }
+
+                this->systemBusAddress = value;
+                if (this->systemBusControlStatus.readOnAddress) {
+                    this->systemBusRead();
+                }
+                return;
+            }
+            case RegisterAddress::SYSTEM_BUS_DATA_0: {
+                if (!this->config.systemBusAccess) {
+                    return;
+                }
+
+                this->systemBusData = value;
+                this->systemBusWrite();
+                return;
+            }
+            default: {
+                return;
+            }
+        }
+    }
+
+    std::vector<RegisterValue> SimulatedDebugModule::executeDmiBatch(const DmiBatch& batch) {
+        ++(this->statistics.dmiBatches);
+        this->statistics.batchedOperations += batch.size();
+        return DebugTransportModuleInterface::executeDmiBatch(batch);
+    }
+
+    void SimulatedDebugModule::advance() {
+        if (this->active && !this->ndmReset && !this->hart.halted()) {
+            this->hart.run(this->config.instructionsPerAccess);
+        }
+    }
+
+    void SimulatedDebugModule::resetDebugModuleState() {
+        this->active = false;
+        this->selectedHartIndex = 0;
+        this->ndmReset = false;
+        this->resetHaltRequest = false;
+        this->resumeAcknowledge = false;
+
+        this->abstractData = {};
+        this->programBuffer = {};
+        this->abstractCommand = 0;
+        this->abstractCommandAutoExecute = 0;
+        this->commandError = AbstractCommandError::NONE;
+        this->remainingBusyReads = 0;
+
+        this->systemBusControlStatus = SystemBusAccessControlStatusRegister{
+            .supports8BitAccess = true,
+            .supports16BitAccess = true,
+            .supports32BitAccess = true,
+            .addressWidth = 32,
+            .accessSize = SystemBusAccessControlStatusRegister::AccessSize::SIZE_32,
+            .version = 1,
+        };
+        this->systemBusAddress = 0;
+        this->systemBusData = 0;
+    }
+
+    void SimulatedDebugModule::writeControlRegister(RegisterValue value) {
+        const auto controlRegister = ControlRegister::fromValue(value);
+
+        if (!controlRegister.debugModuleActive) {
+            // Clearing dmactive resets the debug module (but not the harts)
+            this->resetDebugModuleState();
+            return;
+        }
+
+        this->active = true;
+        this->selectedHartIndex = controlRegister.selectedHartIndex & SimulatedDebugModule::HART_SELECT_MASK;
+
+        if (controlRegister.setResetHaltRequest) {
+            this->resetHaltRequest = true;
+
+        } else if (controlRegister.clearResetHaltRequest) {
+            this->resetHaltRequest = false;
+        }
+
+        if (controlRegister.ndmReset || (controlRegister.hartReset && this->hartSelected())) {
+            // The hart is held in reset until ndmreset is deasserted
+            this->hart.reset();
+            this->haveReset = true;
+            this->resumeAcknowledge = false;
+            this->ndmReset = true;
+
+        } else if (this->ndmReset) {
+            this->ndmReset = false;
+
+            if (this->resetHaltRequest) {
+                this->hart.halt(SimulatedHart::DebugModeCause::RESET_HALT_REQUEST);
+            }
+        }
+
+        if (!this->hartSelected()) {
+            return;
+        }
+
+        if (controlRegister.acknowledgeHaveReset) {
+            this->haveReset = false;
+        }
+
+        if (this->ndmReset) {
+            return;
+        }
+
+        if (controlRegister.haltRequest) {
+            if (!this->hart.halted()) {
+                this->hart.halt(SimulatedHart::DebugModeCause::HALT_REQUEST);
+            }
+
+            return;
+        }
+
+        if (controlRegister.resumeRequest && this->hart.halted()) {
+            this->hart.resume();
+            this->resumeAcknowledge = true;
+        }
+    }
+
+    RegisterValue SimulatedDebugModule::statusRegisterValue() const {
+        const auto hartExists = this->hartSelected();
+        const auto halted = hartExists && this->hart.halted();
+        const auto running = hartExists && !this->hart.halted();
+        const auto resumeAcknowledge = hartExists && this->resumeAcknowledge;
+        const auto haveReset = hartExists && this->haveReset;
+
+        return StatusRegister{
+            .version = DEBUG_MODULE_VERSION,
+            .supportsResetHalt = true,
+            .authenticated = true,
+            .anyHalted = halted,
+            .allHalted = halted,
+            .anyRunning = running,
+            .allRunning = running,
+            .anyNonExistent = !hartExists,
+            .allNonExistent = !hartExists,
+            .anyResumeAcknowledge = resumeAcknowledge,
+            .allResumeAcknowledge = resumeAcknowledge,
+            .anyHaveReset = haveReset,
+            .allHaveReset = haveReset,
+        }.value();
+    }
+
+    bool SimulatedDebugModule::rejectAccessIfBusy() {
+        if (this->remainingBusyReads == 0) {
+            return false;
+        }
+
+        if (this->commandError == AbstractCommandError::NONE) {
+            this->commandError = AbstractCommandError::BUSY;
+        }
+
+        return true;
+    }
+
+    void SimulatedDebugModule::autoExecute(std::uint8_t autoExecuteBit) {
+        if (
+            (this->abstractCommandAutoExecute & (RegisterValue{0x01} << autoExecuteBit)) == 0
+            || this->commandError != AbstractCommandError::NONE
+        ) {
+            return;
+        }
+
+        this->executeAbstractCommand();
+    }
+
+    void SimulatedDebugModule::executeAbstractCommand() {
+        ++(this->statistics.abstractCommands);
+        this->remainingBusyReads = this->config.abstractCommandBusyReads;
+
+        if (!this->hartSelected() || !this->hart.halted()) {
+            this->commandError = AbstractCommandError::HALT_RESUME;
+            return;
+        }
+
+        const auto command = AbstractCommandRegister::fromValue(this->abstractCommand);
+
+        switch (command.commandType) {
+            case AbstractCommandRegister::CommandType::REGISTER_ACCESS: {
+                this->commandError = this->executeRegisterAccessCommand(command.control);
+                return;
+            }
+            case AbstractCommandRegister::CommandType::MEMORY_ACCESS: {
+                this->commandError = this->executeMemoryAccessCommand(command.control);
+                return;
+            }
+            default: {
+                this->commandError = AbstractCommandError::NOT_SUPPORTED;
+                return;
+            }
+        }
+    }
+
+    AbstractCommandError SimulatedDebugModule::executeRegisterAccessCommand(std::uint32_t control) {
+        auto accessControl = RegisterAccessControlField::fromValue(control);
+
+        if (accessControl.transfer) {
+            if (
+                accessControl.size != RegisterAccessControlField::RegisterSize::SIZE_32
+                || this->config.abstractDataRegisterCount < 1
+            ) {
+                return AbstractCommandError::NOT_SUPPORTED;
+            }
+
+            if (accessControl.write) {
+                if (!this->hart.writeRegister(accessControl.registerNumber, this->abstractData[0])) {
+                    return AbstractCommandError::EXCEPTION;
+                }
+
+            } else {
+                const auto value = this->hart.readRegister(accessControl.registerNumber);
+                if (!value.has_value()) {
+                    return AbstractCommandError::EXCEPTION;
+                }
+
+                this->abstractData[0] = *value;
+            }
+        }
+
+        if (accessControl.flags.postIncrement) {
+            ++(accessControl.registerNumber);
+            this->abstractCommand = AbstractCommandRegister{
+                .control = accessControl.value(),
+                .commandType = AbstractCommandRegister::CommandType::REGISTER_ACCESS,
+            }.value();
+        }
+
+        if (accessControl.flags.postExecute) {
+            ++(this->statistics.programBufferExecutions);
+
+            if (!this->hart.executeProgramBuffer({this->programBuffer.begin(), this->config.programBufferSize})) {
+                return AbstractCommandError::EXCEPTION;
+            }
+        }
+
+        return AbstractCommandError::NONE;
+    }
+
+    AbstractCommandError SimulatedDebugModule::executeMemoryAccessCommand(std::uint32_t control) {
+        const auto accessControl = MemoryAccessControlField::fromValue(control);
+
+        if (
+            !this->config.abstractMemoryAccess
+            || this->config.abstractDataRegisterCount < 2
+            || accessControl.virtualAddress
+            || accessControl.size > MemoryAccessControlField::MemorySize::SIZE_32
+        ) {
+            return AbstractCommandError::NOT_SUPPORTED;
+        }
+
+        const auto address = this->abstractData[1];
+        const auto size = static_cast<std::uint8_t>(0x01 << static_cast<std::uint8_t>(accessControl.size));
+
+        if (accessControl.write) {
+            if (this->memory.write(address, size, this->abstractData[0]).has_value()) {
+                return AbstractCommandError::EXCEPTION;
+            }
+
+        } else {
+            const auto value = this->memory.read(address, size);
+            if (!value.hasValue()) {
+                return AbstractCommandError::EXCEPTION;
+            }
+
+            this->abstractData[0] = value.value();
+        }
+
+        if (accessControl.postIncrement) {
+            this->abstractData[1] = address + size;
+        }
+
+        return AbstractCommandError::NONE;
+    }
+
+    void SimulatedDebugModule::writeSystemBusControlStatusRegister(RegisterValue value) {
+        using Error = SystemBusAccessControlStatusRegister::Error;
+
+        const auto newValue = SystemBusAccessControlStatusRegister::fromValue(value);
+
+        // sberror and sbbusyerror are write-1-to-clear
+        this->systemBusControlStatus.error = static_cast<Error>(
+            static_cast<std::uint8_t>(this->systemBusControlStatus.error)
+                & ~static_cast<std::uint8_t>(newValue.error)
+        );
+
+        if (newValue.busyError) {
+            this->systemBusControlStatus.busyError = false;
+        }
+
+        this->systemBusControlStatus.readOnData = newValue.readOnData;
+        this->systemBusControlStatus.autoIncrement = newValue.autoIncrement;
+        this->systemBusControlStatus.accessSize = newValue.accessSize;
+        this->systemBusControlStatus.readOnAddress = newValue.readOnAddress;
+    }
+
+    void SimulatedDebugModule::systemBusRead() {
+        using Error = SystemBusAccessControlStatusRegister::Error;
+
+        if (this->systemBusControlStatus.error != Error::NONE) {
+            return;
+        }
+
+        ++(this->statistics.systemBusAccesses);
+
+        if (this->systemBusControlStatus.accessSize > SystemBusAccessControlStatusRegister::AccessSize::SIZE_32) {
+            this->systemBusControlStatus.error = Error::UNSUPPORTED_SIZE;
+            return;
+        }
+
+        const auto size = static_cast<std::uint8_t>(
+            0x01 << static_cast<std::uint8_t>(this->systemBusControlStatus.accessSize)
+        );
+
+        if (this->systemBusAddress % size != 0) {
+            this->systemBusControlStatus.error = Error::ALIGNMENT;
+            return;
+        }
+
+        const auto value = this->memory.read(this->systemBusAddress, size);
+        if (!value.hasValue()) {
+            this->systemBusControlStatus.error = Error::BAD_ADDRESS;
+            return;
+        }
+
+        this->systemBusData = value.value();
+
+        if (this->systemBusControlStatus.autoIncrement) {
+            this->systemBusAddress += size;
+        }
+    }
+
+    void SimulatedDebugModule::systemBusWrite() {
+        using Error = SystemBusAccessControlStatusRegister::Error;
+
+        if (this->systemBusControlStatus.error != Error::NONE) {
+            return;
+        }
+
+        ++(this->statistics.systemBusAccesses);
+
+        if (this->systemBusControlStatus.accessSize > SystemBusAccessControlStatusRegister::AccessSize::SIZE_32) {
+            this->systemBusControlStatus.error = Error::UNSUPPORTED_SIZE;
+            return;
+        }
+
+        const auto size = static_cast<std::uint8_t>(
+            0x01 << static_cast<std::uint8_t>(this->systemBusControlStatus.accessSize)
+        );
+
+        if (this->systemBusAddress % size != 0) {
+            this->systemBusControlStatus.error = Error::ALIGNMENT;
+            return;
+        }
+
+        const auto error = this->memory.write(this->systemBusAddress, size, this->systemBusData);
+        if (error.has_value()) {
+            this->systemBusControlStatus.error = *error == SimulatedMemory::AccessError::READ_ONLY
+                ? Error::OTHER
+                : Error::BAD_ADDRESS;
+            return;
+        }
+
+        if (this->systemBusControlStatus.autoIncrement) {
+            this->systemBusAddress += size;
+        }
+    }
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <string>
+
+#include "SimulatedMemory.hpp"
+#include "SimulatedHart.hpp"
+
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugTransportModuleInterface.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugModule/DebugModule.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugModule/Registers/SystemBusAccessControlStatusRegister.hpp"
+
+#include "src/Targets/RiscV/Opcodes/Opcode.hpp"
+
+namespace DebugToolDrivers::Protocols::RiscVDebug::Simulator
+{
+    struct SimulatedDebugModuleConfig
+    {
+        std::uint8_t abstractDataRegisterCount = 2;
+        std::uint8_t programBufferSize = 8;
+        std::uint8_t triggerCount = 4;
+
+        /**
+         * Whether the debug module supports the memory access abstract command
+         * (MemoryAccessStrategy::ABSTRACT_COMMAND).
+         */
+        bool abstractMemoryAccess = true;
+
+        /**
+         * Whether the debug module implements system bus access (the sbcs, sbaddress0 and sbdata0 registers).
+         */
+        bool systemBusAccess = true;
+
+        /**
+         * The number of abstractcs reads for which the busy bit remains set, following the execution of an abstract
+         * command. For exercising the DebugTranslator's polling.
+         */
+        std::uint32_t abstractCommandBusyReads = 0;
+
+        /**
+         * The number of instructions a running hart executes between debug module register accesses.
+         *
+         * Time is modelled in terms of register accesses, which keeps the simulation deterministic.
+         */
+        std::uint32_t instructionsPerAccess = 1000;
+
+        RegisterValue resetVector = 0x00000000;
+
+        std::vector<SimulatedMemoryRegionConfig> memoryRegions = {
+            {.name = "flash", .startAddress = 0x00000000, .size = 0x4000, .writable = false},
+            {.name = "ram", .startAddress = 0x20000000, .size = 0x0800, .writable = true},
+        };
+    };
+
+    /**
+     * An in-process RISC-V debug module (v1.0), with a single RV32I hart, for running the DebugTranslator without a
+     * debug tool.
+     *
+     * Implements the control, status, abstract command (register and memory access), abstract data, program buffer,
+     * abstract command auto-execution and system bus access registers. Abstract commands complete immediately (see
+     * SimulatedDebugModuleConfig::abstractCommandBusyReads).
+     *
+     * Every register access is counted, so that the number of DMI round trips (and transactions, when operations
+     * are batched) required for a DebugTranslator operation can be measured via getStatistics().
+     *
+     * Only hart index 0 exists. Instances are not thread-safe.
+     */
+    class SimulatedDebugModule: public DebugTransportModuleInterface
+    {
+    public:
+        struct Statistics
+        {
+            std::uint64_t registerReads = 0;
+            std::uint64_t registerWrites = 0;
+            std::uint64_t abstractCommands = 0;
+            std::uint64_t programBufferExecutions = 0;
+            std::uint64_t systemBusAccesses = 0;
+            std::uint64_t dmiBatches = 0;
+            std::uint64_t batchedOperations = 0;
+
+            [[nodiscard]] std::uint64_t roundTrips() const {
+                return this->registerReads + this->registerWrites;
+            }
+
+            /**
+             * The number of transport transactions, assuming a DTM that executes an entire DMI batch in a single
+             * transaction.
+             */
+            [[nodiscard]] std::uint64_t transactions() const {
+                return this->roundTrips() - this->batchedOperations + this->dmiBatches;
+            }
+
+            [[nodiscard]] std::string toString() const;
+        };
+
+        explicit SimulatedDebugModule(const SimulatedDebugModuleConfig& config = {});
+
+        using DebugTransportModuleInterface::readDebugModuleRegister;
+        using DebugTransportModuleInterface::writeDebugModuleRegister;
+
+        DebugModule::RegisterValue readDebugModuleRegister(DebugModule::RegisterAddress address) override;
+        void writeDebugModuleRegister(DebugModule::RegisterAddress address, DebugModule::RegisterValue value) override;
+        std::vector<DebugModule::RegisterValue> executeDmiBatch(const DmiBatch& batch) override;
+
+        [[nodiscard]] SimulatedMemory& getMemory() {
+            return this->memory;
+        }
+
+        [[nodiscard]] SimulatedHart& getHart() {
+            return this->hart;
+        }
+
+        [[nodiscard]] const Statistics& getStatistics() const {
+            return this->statistics;
+        }
+
+        void resetStatistics() {
+            this->statistics = {};
+        }
+
+    private:
+        static constexpr auto MAX_ABSTRACT_DATA_REGISTER_COUNT = std::uint8_t{12};
+        static constexpr auto MAX_PROGRAM_BUFFER_SIZE = std::uint8_t{16};
+
+        /**
+         * We implement 10 hartsel bits (hartsello only).
+         */
+        static constexpr auto HART_SELECT_MASK = DebugModule::HartIndex{0x3FF};
+
+        SimulatedDebugModuleConfig config;
+        SimulatedMemory memory;
+        SimulatedHart hart;
+        Statistics statistics;
+
+        bool active = false;
+        DebugModule::HartIndex selectedHartIndex = 0;
+        bool ndmReset = false;
+        bool resetHaltRequest = false;
+        bool haveReset = true;
+        bool resumeAcknowledge = false;
+
+        std::array<DebugModule::RegisterValue, MAX_ABSTRACT_DATA_REGISTER_COUNT> abstractData = {};
+        std::array<Targets::RiscV::Opcodes::Opcode, MAX_PROGRAM_BUFFER_SIZE> programBuffer = {};
+        DebugModule::RegisterValue abstractCommand = 0;
+        DebugModule::RegisterValue abstractCommandAutoExecute = 0;
+        DebugModule::AbstractCommandError commandError = DebugModule::AbstractCommandError::NONE;
+        std::uint32_t remainingBusyReads = 0;
+
+        DebugModule::Registers::SystemBusAccessControlStatusRegister systemBusControlStatus = {};
+        Targets::TargetMemoryAddress systemBusAddress = 0;
+        DebugModule::RegisterValue systemBusData = 0;
+
+        [[nodiscard]] bool hartSelected() const {
+            return this->selectedHartIndex == 0;
+        }
+
+        /**
+         * Lets the selected hart execute instructions, if it's running.
+         */
+        void advance();
+
+        void resetDebugModuleState();
+        void writeControlRegister(DebugModule::RegisterValue value);
+        [[nodiscard]] DebugModule::RegisterValue statusRegisterValue() const;
+
+        /**
+         * Abstract data and program buffer accesses are rejected whilst an abstract command is in progress.
+         *
+         * @return
+         *  True if the access was rejected.
+         */
+        bool rejectAccessIfBusy();
+
+        void autoExecute(std::uint8_t autoExecuteBit);
+        void executeAbstractCommand();
+        DebugModule::AbstractCommandError executeRegisterAccessCommand(std::uint32_t control);
+        DebugModule::AbstractCommandError executeMemoryAccessCommand(std::uint32_t control);
+
+        void writeSystemBusControlStatusRegister(DebugModule::RegisterValue value);
+        void systemBusRead();
+        void systemBusWrite();
+    };
+}
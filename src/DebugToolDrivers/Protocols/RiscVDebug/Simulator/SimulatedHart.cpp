@@ -0,0 +1,887 @@
+#include "SimulatedHart.hpp"
+
+#include <algorithm>
+
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/TriggerModule/Registers/MatchControl.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/TriggerModule/Registers/TriggerData1.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/TriggerModule/Registers/TriggerInfo.hpp"
+
+namespace DebugToolDrivers::Protocols::RiscVDebug::Simulator
+{
+    using Registers::DebugControlStatusRegister;
+    using TriggerModule::TriggerAction;
+    using TriggerModule::TriggerType;
+    using TriggerModule::Registers::MatchControl;
+    using TriggerModule::Registers::TriggerData1;
+    using TriggerModule::Registers::TriggerInfo;
+    using Targets::RiscV::Opcodes::Opcode;
+    using Targets::TargetMemoryAddress;
+
+    namespace
+    {
+        namespace Csr
+        {
+            static constexpr auto MACHINE_STATUS = RegisterNumber{0x0300};
+            static constexpr auto MACHINE_ISA = RegisterNumber{0x0301};
+            static constexpr auto MACHINE_TRAP_VECTOR = RegisterNumber{0x0305};
+            static constexpr auto MACHINE_SCRATCH = RegisterNumber{0x0340};
+            static constexpr auto MACHINE_EXCEPTION_PC = RegisterNumber{0x0341};
+            static constexpr auto MACHINE_CAUSE = RegisterNumber{0x0342};
+            static constexpr auto MACHINE_TRAP_VALUE = RegisterNumber{0x0343};
+            static constexpr auto TRIGGER_SELECT = RegisterNumber{0x07A0};
+            static constexpr auto TRIGGER_DATA_1 = RegisterNumber{0x07A1};
+            static constexpr auto TRIGGER_DATA_2 = RegisterNumber{0x07A2};
+            static constexpr auto TRIGGER_DATA_3 = RegisterNumber{0x07A3};
+            static constexpr auto TRIGGER_INFO = RegisterNumber{0x07A4};
+            static constexpr auto DEBUG_CONTROL_STATUS = RegisterNumber{0x07B0};
+            static constexpr auto DEBUG_PC = RegisterNumber{0x07B1};
+            static constexpr auto DEBUG_SCRATCH_0 = RegisterNumber{0x07B2};
+            static constexpr auto DEBUG_SCRATCH_1 = RegisterNumber{0x07B3};
+            static constexpr auto MACHINE_CYCLE = RegisterNumber{0x0B00};
+            static constexpr auto MACHINE_INSTRUCTIONS_RETIRED = RegisterNumber{0x0B02};
+            static constexpr auto MACHINE_CYCLE_HIGH = RegisterNumber{0x0B80};
+            static constexpr auto MACHINE_INSTRUCTIONS_RETIRED_HIGH = RegisterNumber{0x0B82};
+            static constexpr auto CYCLE = RegisterNumber{0x0C00};
+            static constexpr auto INSTRUCTIONS_RETIRED = RegisterNumber{0x0C02};
+            static constexpr auto CYCLE_HIGH = RegisterNumber{0x0C80};
+            static constexpr auto INSTRUCTIONS_RETIRED_HIGH = RegisterNumber{0x0C82};
+            static constexpr auto MACHINE_VENDOR_ID = RegisterNumber{0x0F11};
+            static constexpr auto MACHINE_HART_ID = RegisterNumber{0x0F14};
+        }
+
+        namespace ExceptionCause
+        {
+            static constexpr auto INSTRUCTION_ADDRESS_MISALIGNED = RegisterValue{0x00};
+            static constexpr auto INSTRUCTION_ACCESS_FAULT = RegisterValue{0x01};
+            static constexpr auto ILLEGAL_INSTRUCTION = RegisterValue{0x02};
+            static constexpr auto BREAKPOINT = RegisterValue{0x03};
+            static constexpr auto LOAD_ACCESS_FAULT = RegisterValue{0x05};
+            static constexpr auto STORE_ACCESS_FAULT = RegisterValue{0x07};
+            static constexpr auto MACHINE_ENVIRONMENT_CALL = RegisterValue{0x0B};
+        }
+
+        static constexpr auto FIRST_GPR_NUMBER = RegisterNumber{0x1000};
+        static constexpr auto LAST_GPR_NUMBER = RegisterNumber{0x101F};
+
+        // RV32I
+        static constexpr auto MACHINE_ISA_VALUE = RegisterValue{0x40000100};
+
+        static constexpr auto DEBUG_SPEC_VERSION = std::uint8_t{0x04};
+    }
+
+    SimulatedHart::SimulatedHart(SimulatedMemory& memory, std::uint8_t triggerCount, RegisterValue resetVector)
+        : memory(memory)
+        , resetVector(resetVector)
+        , triggers(triggerCount)
+    {
+        this->reset();
+    }
+
+    void SimulatedHart::reset() {
+        this->gprs = {};
+        this->programCounter = this->resetVector;
+        this->inDebugMode = false;
+
+        this->debugControlStatusRegister = DebugControlStatusRegister{
+            .privilegeMode = PrivilegeMode::MACHINE,
+            .debugVersion = DEBUG_SPEC_VERSION,
+        };
+        this->debugProgramCounter = 0;
+        this->debugScratch = {};
+
+        this->machineStatus = 0;
+        this->machineTrapVector = 0;
+        this->machineScratch = 0;
+        this->machineExceptionProgramCounter = 0;
+        this->machineCause = 0;
+        this->machineTrapValue = 0;
+        this->cycleCount = 0;
+
+        std::fill(this->triggers.begin(), this->triggers.end(), Trigger{});
+        this->selectedTriggerIndex = 0;
+    }
+
+    void SimulatedHart::halt(DebugModeCause cause) {
+        this->debugProgramCounter = this->programCounter;
+        this->debugControlStatusRegister.debugModeCause = cause;
+        this->inDebugMode = true;
+    }
+
+    void SimulatedHart::resume() {
+        this->programCounter = this->debugProgramCounter;
+        this->inDebugMode = false;
+    }
+
+    std::optional<RegisterValue> SimulatedHart::readRegister(RegisterNumber number) {
+        if (number >= FIRST_GPR_NUMBER && number <= LAST_GPR_NUMBER) {
+            return this->gprs[number - FIRST_GPR_NUMBER];
+        }
+
+        if (number < FIRST_GPR_NUMBER) {
+            return this->readCsr(number);
+        }
+
+        return std::nullopt;
+    }
+
+    bool SimulatedHart::writeRegister(RegisterNumber number, RegisterValue value) {
+        if (number >= FIRST_GPR_NUMBER && number <= LAST_GPR_NUMBER) {
+            this->writeGpr(static_cast<std::uint8_t>(number - FIRST_GPR_NUMBER), value);
+            return true;
+        }
+
+        if (number < FIRST_GPR_NUMBER) {
+            return this->writeCsr(number, value);
+        }
+
+        return false;
+    }
+
+    bool SimulatedHart::executeProgramBuffer(std::span<const Opcode> programBuffer) {
+        /*
+         * The program buffer is given its own address space, starting at 0. This only affects PC-relative
+         * instructions (AUIPC, JAL and branches), which the DebugTranslator never places in the program buffer.
+         */
+        auto address = RegisterValue{0};
+
+        for (auto i = std::uint32_t{0}; i < SimulatedHart::PROGRAM_BUFFER_INSTRUCTION_LIMIT; ++i) {
+            if ((address / 4) >= programBuffer.size()) {
+                // Implicit EBREAK
+                return true;
+            }
+
+            if (address % 4 != 0) {
+                return false;
+            }
+
+            auto nextAddress = address + 4;
+            const auto outcome = this->execute(programBuffer[address / 4], address, nextAddress);
+            ++(this->instructionsExecuted);
+
+            switch (outcome) {
+                case InstructionOutcome::COMPLETED: {
+                    address = nextAddress;
+                    break;
+                }
+                case InstructionOutcome::BREAKPOINT: {
+                    return true;
+                }
+                case InstructionOutcome::TRIGGER:
+                case InstructionOutcome::EXCEPTION: {
+                    return false;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    void SimulatedHart::run(std::uint64_t instructionCount) {
+        for (auto i = std::uint64_t{0}; i < instructionCount && !this->inDebugMode; ++i) {
+            const auto instructionAddress = this->programCounter;
+            auto nextInstructionAddress = instructionAddress + 4;
+            auto outcome = InstructionOutcome::COMPLETED;
+
+            const auto fetchTriggerAction = this->checkTriggers(AccessType::EXECUTE, instructionAddress);
+
+            if (fetchTriggerAction == TriggerAction::ENTER_DEBUG_MODE) {
+                outcome = InstructionOutcome::TRIGGER;
+
+            } else if (fetchTriggerAction == TriggerAction::RAISE_BREAKPOINT_EXCEPTION) {
+                outcome = this->raiseException(ExceptionCause::BREAKPOINT, instructionAddress);
+
+            } else if (instructionAddress % 4 != 0) {
+                outcome = this->raiseException(ExceptionCause::INSTRUCTION_ADDRESS_MISALIGNED, instructionAddress);
+
+            } else {
+                const auto opcode = this->memory.read(instructionAddress, 4);
+                outcome = opcode.hasValue()
+                    ? this->execute(opcode.value(), instructionAddress, nextInstructionAddress)
+                    : this->raiseException(ExceptionCause::INSTRUCTION_ACCESS_FAULT, instructionAddress);
+            }
+
+            ++(this->cycleCount);
+
+            switch (outcome) {
+                case InstructionOutcome::COMPLETED: {
+                    this->programCounter = nextInstructionAddress;
+                    ++(this->instructionsExecuted);
+                    break;
+                }
+                case InstructionOutcome::BREAKPOINT: {
+                    if (this->debugControlStatusRegister.breakMMode) {
+                        this->halt(DebugModeCause::BREAK);
+                        return;
+                    }
+
+                    this->raiseException(ExceptionCause::BREAKPOINT, instructionAddress);
+                    this->takeTrap(instructionAddress);
+                    break;
+                }
+                case InstructionOutcome::TRIGGER: {
+                    this->halt(DebugModeCause::TRIGGER);
+                    return;
+                }
+                case InstructionOutcome::EXCEPTION: {
+                    this->takeTrap(instructionAddress);
+                    break;
+                }
+            }
+
+            if (this->debugControlStatusRegister.step) {
+                this->halt(DebugModeCause::STEP);
+                return;
+            }
+        }
+    }
+
+    std::optional<RegisterValue> SimulatedHart::readCsr(RegisterNumber number) {
+        switch (number) {
+            case Csr::MACHINE_STATUS: {
+                return this->machineStatus;
+            }
+            case Csr::MACHINE_ISA: {
+                return MACHINE_ISA_VALUE;
+            }
+            case Csr::MACHINE_TRAP_VECTOR: {
+                return this->machineTrapVector;
+            }
+            case Csr::MACHINE_SCRATCH: {
+                return this->machineScratch;
+            }
+            case Csr::MACHINE_EXCEPTION_PC: {
+                return this->machineExceptionProgramCounter;
+            }
+            case Csr::MACHINE_CAUSE: {
+                return this->machineCause;
+            }
+            case Csr::MACHINE_TRAP_VALUE: {
+                return this->machineTrapValue;
+            }
+            case Csr::TRIGGER_SELECT: {
+                if (this->triggers.empty()) {
+                    return std::nullopt;
+                }
+
+                return this->selectedTriggerIndex;
+            }
+            case Csr::TRIGGER_DATA_1: {
+                if (this->triggers.empty()) {
+                    return std::nullopt;
+                }
+
+                auto data1 = TriggerData1::fromValue(this->triggers[this->selectedTriggerIndex].data1);
+                data1.type = static_cast<std::uint8_t>(TriggerType::MATCH_CONTROL);
+                return data1.value();
+            }
+            case Csr::TRIGGER_DATA_2: {
+                if (this->triggers.empty()) {
+                    return std::nullopt;
+                }
+
+                return this->triggers[this->selectedTriggerIndex].data2;
+            }
+            case Csr::TRIGGER_DATA_3: {
+                if (this->triggers.empty()) {
+                    return std::nullopt;
+                }
+
+                return RegisterValue{0};
+            }
+            case Csr::TRIGGER_INFO: {
+                if (this->triggers.empty()) {
+                    return std::nullopt;
+                }
+
+                return TriggerInfo{
+                    .info = static_cast<std::uint16_t>(0x01 << static_cast<std::uint8_t>(TriggerType::MATCH_CONTROL)),
+                    .version = 0,
+                }.value();
+            }
+            case Csr::DEBUG_CONTROL_STATUS: {
+                return this->debugControlStatusRegister.value();
+            }
+            case Csr::DEBUG_PC: {
+                return this->debugProgramCounter;
+            }
+            case Csr::DEBUG_SCRATCH_0: {
+                return this->debugScratch[0];
+            }
+            case Csr::DEBUG_SCRATCH_1: {
+                return this->debugScratch[1];
+            }
+            case Csr::MACHINE_CYCLE:
+            case Csr::CYCLE: {
+                return static_cast<RegisterValue>(this->cycleCount);
+            }
+            case Csr::MACHINE_CYCLE_HIGH:
+            case Csr::CYCLE_HIGH: {
+                return static_cast<RegisterValue>(this->cycleCount >> 32);
+            }
+            case Csr::MACHINE_INSTRUCTIONS_RETIRED:
+            case Csr::INSTRUCTIONS_RETIRED: {
+                return static_cast<RegisterValue>(this->instructionsExecuted);
+            }
+            case Csr::MACHINE_INSTRUCTIONS_RETIRED_HIGH:
+            case Csr::INSTRUCTIONS_RETIRED_HIGH: {
+                return static_cast<RegisterValue>(this->instructionsExecuted >> 32);
+            }
+            default: {
+                if (number >= Csr::MACHINE_VENDOR_ID && number <= Csr::MACHINE_HART_ID) {
+                    return RegisterValue{0};
+                }
+
+                return std::nullopt;
+            }
+        }
+    }
+
+    bool SimulatedHart::writeCsr(RegisterNumber number, RegisterValue value) {
+        switch (number) {
+            case Csr::MACHINE_STATUS: {
+                this->machineStatus = value;
+                return true;
+            }
+            case Csr::MACHINE_ISA: {
+                // WARL - writes are ignored
+                return true;
+            }
+            case Csr::MACHINE_TRAP_VECTOR: {
+                this->machineTrapVector = value & ~RegisterValue{0x03};
+                return true;
+            }
+            case Csr::MACHINE_SCRATCH: {
+                this->machineScratch = value;
+                return true;
+            }
+            case Csr::MACHINE_EXCEPTION_PC: {
+                this->machineExceptionProgramCounter = value & ~RegisterValue{0x03};
+                return true;
+            }
+            case Csr::MACHINE_CAUSE: {
+                this->machineCause = value;
+                return true;
+            }
+            case Csr::MACHINE_TRAP_VALUE: {
+                this->machineTrapValue = value;
+                return true;
+            }
+            case Csr::TRIGGER_SELECT: {
+                if (this->triggers.empty()) {
+                    return false;
+                }
+
+                // Selection of a non-existent trigger is ignored, as per the spec (tselect is WARL)
+                if (value < this->triggers.size()) {
+                    this->selectedTriggerIndex = value;
+                }
+
+                return true;
+            }
+            case Csr::TRIGGER_DATA_1: {
+                if (this->triggers.empty()) {
+                    return false;
+                }
+
+                // Only match control triggers are supported - the type field is hardwired
+                auto data1 = TriggerData1::fromValue(value);
+                data1.type = static_cast<std::uint8_t>(TriggerType::MATCH_CONTROL);
+                this->triggers[this->selectedTriggerIndex].data1 = data1.value();
+                return true;
+            }
+            case Csr::TRIGGER_DATA_2: {
+                if (this->triggers.empty()) {
+                    return false;
+                }
+
+                this->triggers[this->selectedTriggerIndex].data2 = value;
+                return true;
+            }
+            case Csr::TRIGGER_DATA_3: {
+                return !this->triggers.empty();
+            }
+            case Csr::DEBUG_CONTROL_STATUS: {
+                auto newValue = DebugControlStatusRegister::fromValue(value);
+
+                // The cause, version and NMI pending fields are read-only. We only support machine mode.
+                newValue.debugModeCause = this->debugControlStatusRegister.debugModeCause;
+                newValue.debugVersion = this->debugControlStatusRegister.debugVersion;
+                newValue.nmiPending = this->debugControlStatusRegister.nmiPending;
+                newValue.privilegeMode = PrivilegeMode::MACHINE;
+
+                this->debugControlStatusRegister = newValue;
+                return true;
+            }
+            case Csr::DEBUG_PC: {
+                this->debugProgramCounter = value & ~RegisterValue{0x01};
+                return true;
+            }
+            case Csr::DEBUG_SCRATCH_0: {
+                this->debugScratch[0] = value;
+                return true;
+            }
+            case Csr::DEBUG_SCRATCH_1: {
+                this->debugScratch[1] = value;
+                return true;
+            }
+            case Csr::MACHINE_CYCLE: {
+                this->cycleCount = (this->cycleCount & 0xFFFFFFFF00000000) | value;
+                return true;
+            }
+            case Csr::MACHINE_CYCLE_HIGH: {
+                this->cycleCount = (this->cycleCount & 0xFFFFFFFF) | (static_cast<std::uint64_t>(value) << 32);
+                return true;
+            }
+            case Csr::MACHINE_INSTRUCTIONS_RETIRED: {
+                this->instructionsExecuted = (this->instructionsExecuted & 0xFFFFFFFF00000000) | value;
+                return true;
+            }
+            case Csr::MACHINE_INSTRUCTIONS_RETIRED_HIGH: {
+                this->instructionsExecuted = (this->instructionsExecuted & 0xFFFFFFFF)
+                    | (static_cast<std::uint64_t>(value) << 32);
+                return true;
+            }
+            default: {
+                // Non-existent or read-only
+                return false;
+            }
+        }
+    }
+
+    SimulatedHart::InstructionOutcome SimulatedHart::raiseException(RegisterValue cause, RegisterValue value) {
+        this->pendingExceptionCause = cause;
+        this->pendingExceptionValue = value;
+        return InstructionOutcome::EXCEPTION;
+    }
+
+    void SimulatedHart::takeTrap(RegisterValue instructionAddress) {
+        this->machineExceptionProgramCounter = instructionAddress;
+        this->machineCause = this->pendingExceptionCause;
+        this->machineTrapValue = this->pendingExceptionValue;
+        this->programCounter = this->machineTrapVector;
+    }
+
+    std::optional<TriggerAction> SimulatedHart::checkTriggers(AccessType accessType, TargetMemoryAddress address) {
+        if (this->inDebugMode) {
+            return std::nullopt;
+        }
+
+        for (auto& trigger : this->triggers) {
+            auto matchControl = MatchControl::fromValue(trigger.data1);
+
+            const auto accessEnabled = (accessType == AccessType::EXECUTE && matchControl.execute)
+                || (accessType == AccessType::LOAD && matchControl.load)
+                || (accessType == AccessType::STORE && matchControl.store);
+
+            if (!accessEnabled || !matchControl.enabledInMachineMode) {
+                continue;
+            }
+
+            const auto matches = [&matchControl, &trigger, address] {
+                switch (matchControl.matchMode) {
+                    case MatchControl::MatchMode::EQUAL: {
+                        return address == trigger.data2;
+                    }
+                    case MatchControl::MatchMode::NOT_EQUAL: {
+                        return address != trigger.data2;
+                    }
+                    case MatchControl::MatchMode::GREATER_THAN: {
+                        return address >= trigger.data2;
+                    }
+                    case MatchControl::MatchMode::LESS_THAN: {
+                        return address < trigger.data2;
+                    }
+                    case MatchControl::MatchMode::MASK_LOW: {
+                        return ((address & 0xFFFF) & (trigger.data2 >> 16)) == (trigger.data2 & 0xFFFF);
+                    }
+                    case MatchControl::MatchMode::MASK_HIGH: {
+                        return ((address >> 16) & (trigger.data2 >> 16)) == (trigger.data2 & 0xFFFF);
+                    }
+                    default: {
+                        return false;
+                    }
+                }
+            }();
+
+            if (!matches) {
+                continue;
+            }
+
+            matchControl.hit = true;
+            trigger.data1 = (trigger.data1 & 0xF8000000) | (matchControl.value() & 0x07FFFFFF);
+            return matchControl.action;
+        }
+
+        return std::nullopt;
+    }
+
+    SimulatedHart::InstructionOutcome SimulatedHart::execute(
+        Opcode opcode,
+        RegisterValue instructionAddress,
+        RegisterValue& nextInstructionAddress
+    ) {
+        const auto destinationRegister = static_cast<std::uint8_t>((opcode >> 7) & 0x1F);
+        const auto function3 = static_cast<std::uint8_t>((opcode >> 12) & 0x07);
+        const auto sourceRegister1 = static_cast<std::uint8_t>((opcode >> 15) & 0x1F);
+        const auto sourceRegister2 = static_cast<std::uint8_t>((opcode >> 20) & 0x1F);
+        const auto function7 = static_cast<std::uint8_t>(opcode >> 25);
+
+        const auto source1 = this->gprs[sourceRegister1];
+        const auto source2 = this->gprs[sourceRegister2];
+
+        const auto signedOpcode = static_cast<std::int32_t>(opcode);
+        const auto immediateI = static_cast<RegisterValue>(signedOpcode >> 20);
+        const auto immediateS = static_cast<RegisterValue>(((signedOpcode >> 25) << 5) | ((opcode >> 7) & 0x1F));
+        const auto immediateB = static_cast<RegisterValue>(
+            ((signedOpcode >> 31) << 12)
+                | static_cast<std::int32_t>(((opcode >> 7) & 0x01) << 11)
+                | static_cast<std::int32_t>(((opcode >> 25) & 0x3F) << 5)
+                | static_cast<std::int32_t>(((opcode >> 8) & 0x0F) << 1)
+        );
+        const auto immediateU = static_cast<RegisterValue>(opcode & 0xFFFFF000);
+        const auto immediateJ = static_cast<RegisterValue>(
+            ((signedOpcode >> 31) << 20)
+                | static_cast<std::int32_t>(opcode & 0x000FF000)
+                | static_cast<std::int32_t>(((opcode >> 20) & 0x01) << 11)
+                | static_cast<std::int32_t>(((opcode >> 21) & 0x03FF) << 1)
+        );
+
+        const auto illegalInstruction = [this, opcode] {
+            return this->raiseException(ExceptionCause::ILLEGAL_INSTRUCTION, opcode);
+        };
+
+        const auto jump = [this, &nextInstructionAddress] (RegisterValue target) {
+            if (target % 4 != 0) {
+                return this->raiseException(ExceptionCause::INSTRUCTION_ADDRESS_MISALIGNED, target);
+            }
+
+            nextInstructionAddress = target;
+            return InstructionOutcome::COMPLETED;
+        };
+
+        switch (opcode & 0x7F) {
+            case 0x37: {
+                // LUI
+                this->writeGpr(destinationRegister, immediateU);
+                return InstructionOutcome::COMPLETED;
+            }
+            case 0x17: {
+                // AUIPC
+                this->writeGpr(destinationRegister, instructionAddress + immediateU);
+                return InstructionOutcome::COMPLETED;
+            }
+            case 0x6F: {
+                // JAL
+                const auto outcome = jump(instructionAddress + immediateJ);
+                if (outcome == InstructionOutcome::COMPLETED) {
+                    this->writeGpr(destinationRegister, instructionAddress + 4);
+                }
+
+                return outcome;
+            }
+            case 0x67: {
+                // JALR
+                if (function3 != 0x00) {
+                    return illegalInstruction();
+                }
+
+                const auto outcome = jump((source1 + immediateI) & ~RegisterValue{0x01});
+                if (outcome == InstructionOutcome::COMPLETED) {
+                    this->writeGpr(destinationRegister, instructionAddress + 4);
+                }
+
+                return outcome;
+            }
+            case 0x63: {
+                // BEQ, BNE, BLT, BGE, BLTU, BGEU
+                auto taken = false;
+                switch (function3) {
+                    case 0x00: {
+                        taken = source1 == source2;
+                        break;
+                    }
+                    case 0x01: {
+                        taken = source1 != source2;
+                        break;
+                    }
+                    case 0x04: {
+                        taken = static_cast<std::int32_t>(source1) < static_cast<std::int32_t>(source2);
+                        break;
+                    }
+                    case 0x05: {
+                        taken = static_cast<std::int32_t>(source1) >= static_cast<std::int32_t>(source2);
+                        break;
+                    }
+                    case 0x06: {
+                        taken = source1 < source2;
+                        break;
+                    }
+                    case 0x07: {
+                        taken = source1 >= source2;
+                        break;
+                    }
+                    default: {
+                        return illegalInstruction();
+                    }
+                }
+
+                return taken ? jump(instructionAddress + immediateB) : InstructionOutcome::COMPLETED;
+            }
+            case 0x03: {
+                // LB, LH, LW, LBU, LHU
+                if (function3 == 0x03 || function3 > 0x05) {
+                    return illegalInstruction();
+                }
+
+                const auto address = source1 + immediateI;
+                const auto size = static_cast<std::uint8_t>(0x01 << (function3 & 0x03));
+
+                const auto triggerAction = this->checkTriggers(AccessType::LOAD, address);
+                if (triggerAction == TriggerAction::ENTER_DEBUG_MODE) {
+                    return InstructionOutcome::TRIGGER;
+                }
+
+                if (triggerAction == TriggerAction::RAISE_BREAKPOINT_EXCEPTION) {
+                    return this->raiseException(ExceptionCause::BREAKPOINT, address);
+                }
+
+                const auto value = this->memory.read(address, size);
+                if (!value.hasValue()) {
+                    return this->raiseException(ExceptionCause::LOAD_ACCESS_FAULT, address);
+                }
+
+                switch (function3) {
+                    case 0x00: {
+                        this->writeGpr(
+                            destinationRegister,
+                            static_cast<RegisterValue>(static_cast<std::int8_t>(value.value()))
+                        );
+                        break;
+                    }
+                    case 0x01: {
+                        this->writeGpr(
+                            destinationRegister,
+                            static_cast<RegisterValue>(static_cast<std::int16_t>(value.value()))
+                        );
+                        break;
+                    }
+                    default: {
+                        this->writeGpr(destinationRegister, value.value());
+                        break;
+                    }
+                }
+
+                return InstructionOutcome::COMPLETED;
+            }
+            case 0x23: {
+                // SB, SH, SW
+                if (function3 > 0x02) {
+                    return illegalInstruction();
+                }
+
+                const auto address = source1 + immediateS;
+                const auto triggerAction = this->checkTriggers(AccessType::STORE, address);
+                if (triggerAction == TriggerAction::ENTER_DEBUG_MODE) {
+                    return InstructionOutcome::TRIGGER;
+                }
+
+                if (triggerAction == TriggerAction::RAISE_BREAKPOINT_EXCEPTION) {
+                    return this->raiseException(ExceptionCause::BREAKPOINT, address);
+                }
+
+                if (this->memory.write(address, static_cast<std::uint8_t>(0x01 << function3), source2).has_value()) {
+                    return this->raiseException(ExceptionCause::STORE_ACCESS_FAULT, address);
+                }
+
+                return InstructionOutcome::COMPLETED;
+            }
+            case 0x13: {
+                // ADDI, SLTI, SLTIU, XORI, ORI, ANDI, SLLI, SRLI, SRAI
+                const auto shiftAmount = sourceRegister2;
+
+                switch (function3) {
+                    case 0x00: {
+                        this->writeGpr(destinationRegister, source1 + immediateI);
+                        break;
+                    }
+                    case 0x02: {
+                        this->writeGpr(
+                            destinationRegister,
+                            static_cast<std::int32_t>(source1) < static_cast<std::int32_t>(immediateI) ? 1 : 0
+                        );
+                        break;
+                    }
+                    case 0x03: {
+                        this->writeGpr(destinationRegister, source1 < immediateI ? 1 : 0);
+                        break;
+                    }
+                    case 0x04: {
+                        this->writeGpr(destinationRegister, source1 ^ immediateI);
+                        break;
+                    }
+                    case 0x06: {
+                        this->writeGpr(destinationRegister, source1 | immediateI);
+                        break;
+                    }
+                    case 0x07: {
+                        this->writeGpr(destinationRegister, source1 & immediateI);
+                        break;
+                    }
+                    case 0x01: {
+                        if (function7 != 0x00) {
+                            return illegalInstruction();
+                        }
+
+                        this->writeGpr(destinationRegister, source1 << shiftAmount);
+                        break;
+                    }
+                    case 0x05: {
+                        if (function7 == 0x00) {
+                            this->writeGpr(destinationRegister, source1 >> shiftAmount);
+                            break;
+                        }
+
+                        if (function7 == 0x20) {
+                            this->writeGpr(
+                                destinationRegister,
+                                static_cast<RegisterValue>(static_cast<std::int32_t>(source1) >> shiftAmount)
+                            );
+                            break;
+                        }
+
+                        return illegalInstruction();
+                    }
+                }
+
+                return InstructionOutcome::COMPLETED;
+            }
+            case 0x33: {
+                // ADD, SUB, SLL, SLT, SLTU, XOR, SRL, SRA, OR, AND
+                const auto shiftAmount = source2 & 0x1F;
+
+                if (function7 == 0x20) {
+                    if (function3 == 0x00) {
+                        this->writeGpr(destinationRegister, source1 - source2);
+                        return InstructionOutcome::COMPLETED;
+                    }
+
+                    if (function3 == 0x05) {
+                        this->writeGpr(
+                            destinationRegister,
+                            static_cast<RegisterValue>(static_cast<std::int32_t>(source1) >> shiftAmount)
+                        );
+                        return InstructionOutcome::COMPLETED;
+                    }
+
+                    return illegalInstruction();
+                }
+
+                if (function7 != 0x00) {
+                    return illegalInstruction();
+                }
+
+                switch (function3) {
+                    case 0x00: {
+                        this->writeGpr(destinationRegister, source1 + source2);
+                        break;
+                    }
+                    case 0x01: {
+                        this->writeGpr(destinationRegister, source1 << shiftAmount);
+                        break;
+                    }
+                    case 0x02: {
+                        this->writeGpr(
+                            destinationRegister,
+                            static_cast<std::int32_t>(source1) < static_cast<std::int32_t>(source2) ? 1 : 0
+                        );
+                        break;
+                    }
+                    case 0x03: {
+                        this->writeGpr(destinationRegister, source1 < source2 ? 1 : 0);
+                        break;
+                    }
+                    case 0x04: {
+                        this->writeGpr(destinationRegister, source1 ^ source2);
+                        break;
+                    }
+                    case 0x05: {
+                        this->writeGpr(destinationRegister, source1 >> shiftAmount);
+                        break;
+                    }
+                    case 0x06: {
+                        this->writeGpr(destinationRegister, source1 | source2);
+                        break;
+                    }
+                    case 0x07: {
+                        this->writeGpr(destinationRegister, source1 & source2);
+                        break;
+                    }
+                }
+
+                return InstructionOutcome::COMPLETED;
+            }
+            case 0x0F: {
+                // FENCE, FENCE.I - no caches to synchronise
+                return function3 <= 0x01 ? InstructionOutcome::COMPLETED : illegalInstruction();
+            }
+            case 0x73: {
+                if (function3 == 0x00) {
+                    switch (opcode) {
+                        case Targets::RiscV::Opcodes::Ebreak: {
+                            return InstructionOutcome::BREAKPOINT;
+                        }
+                        case 0x00000073: {
+                            // ECALL
+                            return this->raiseException(ExceptionCause::MACHINE_ENVIRONMENT_CALL, 0);
+                        }
+                        case 0x30200073: {
+                            // MRET
+                            nextInstructionAddress = this->machineExceptionProgramCounter;
+                            return InstructionOutcome::COMPLETED;
+                        }
+                        case 0x10500073: {
+                            // WFI - there are no interrupts, so this is a no-op
+                            return InstructionOutcome::COMPLETED;
+                        }
+                        default: {
+                            return illegalInstruction();
+                        }
+                    }
+                }
+
+                if (function3 == 0x04) {
+                    return illegalInstruction();
+                }
+
+                // CSRRW, CSRRS, CSRRC, CSRRWI, CSRRSI, CSRRCI
+                const auto csrNumber = static_cast<RegisterNumber>(opcode >> 20);
+                const auto operand = (function3 & 0x04) ? RegisterValue{sourceRegister1} : source1;
+
+                const auto oldValue = this->readCsr(csrNumber);
+                if (!oldValue.has_value()) {
+                    return illegalInstruction();
+                }
+
+                // CSRRS and CSRRC don't write to the CSR when the source is x0 (or the immediate is 0)
+                const auto operation = function3 & 0x03;
+                if (operation == 0x01 || sourceRegister1 != 0) {
+                    const auto newValue = operation == 0x01
+                        ? operand
+                        : operation == 0x02
+                            ? *oldValue | operand
+                            : *oldValue & ~operand;
+
+                    if (!this->writeCsr(csrNumber, newValue)) {
+                        return illegalInstruction();
+                    }
+                }
+
+                this->writeGpr(destinationRegister, *oldValue);
+                return InstructionOutcome::COMPLETED;
+            }
+            default: {
+                return illegalInstruction();
+            }
+        }
+    }
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <span>
+#include <optional>
+
+#include "SimulatedMemory.hpp"
+
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/Common.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/Registers/DebugControlStatusRegister.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/TriggerModule/TriggerModule.hpp"
+
+#include "src/Targets/RiscV/Opcodes/Opcode.hpp"
+
+namespace DebugToolDrivers::Protocols::RiscVDebug::Simulator
+{
+    /**
+     * A single RV32I hart, with a minimal machine-mode CSR file, debug mode and a set of match control (type 2)
+     * triggers.
+     *
+     * The interpreter implements the RV32I base instruction set, along with the Zicsr instructions. Compressed
+     * instructions are not supported. Misaligned loads and stores are permitted.
+     */
+    class SimulatedHart
+    {
+    public:
+        using DebugModeCause = Registers::DebugControlStatusRegister::DebugModeCause;
+
+        /**
+         * Number of instructions the program buffer may execute before we consider it to be stuck.
+         */
+        static constexpr auto PROGRAM_BUFFER_INSTRUCTION_LIMIT = std::uint32_t{1024};
+
+        std::uint64_t instructionsExecuted = 0;
+
+        SimulatedHart(SimulatedMemory& memory, std::uint8_t triggerCount, RegisterValue resetVector);
+
+        [[nodiscard]] bool halted() const {
+            return this->inDebugMode;
+        }
+
+        /**
+         * Resets the hart. The hart will be running from the reset vector upon return.
+         */
+        void reset();
+
+        /**
+         * Enters debug mode, recording the current PC in the DPC register.
+         *
+         * @param cause
+         */
+        void halt(DebugModeCause cause);
+
+        /**
+         * Leaves debug mode, resuming execution from the DPC.
+         */
+        void resume();
+
+        /**
+         * Reads a register via its abstract command register number (0x0000 - 0x0FFF for CSRs, 0x1000 - 0x101F for
+         * GPRs).
+         *
+         * @param number
+         *
+         * @return
+         *  std::nullopt if the register doesn't exist.
+         */
+        std::optional<RegisterValue> readRegister(RegisterNumber number);
+
+        /**
+         * Writes to a register via its abstract command register number.
+         *
+         * @param number
+         * @param value
+         *
+         * @return
+         *  False if the register doesn't exist or is read-only.
+         */
+        bool writeRegister(RegisterNumber number, RegisterValue value);
+
+        /**
+         * Executes the given program buffer, in debug mode, until an EBREAK is reached or execution falls off the
+         * end of the buffer (implicit EBREAK).
+         *
+         * @param programBuffer
+         *
+         * @return
+         *  False if an exception occurred.
+         */
+        bool executeProgramBuffer(std::span<const Targets::RiscV::Opcodes::Opcode> programBuffer);
+
+        /**
+         * Executes up to the given number of instructions, stopping early if the hart enters debug mode.
+         *
+         * @param instructionCount
+         */
+        void run(std::uint64_t instructionCount);
+
+    private:
+        enum class InstructionOutcome: std::uint8_t
+        {
+            COMPLETED,
+            BREAKPOINT,
+            TRIGGER,
+            EXCEPTION,
+        };
+
+        enum class AccessType: std::uint8_t
+        {
+            EXECUTE,
+            LOAD,
+            STORE,
+        };
+
+        struct Trigger
+        {
+            RegisterValue data1 = 0;
+            RegisterValue data2 = 0;
+        };
+
+        SimulatedMemory& memory;
+        RegisterValue resetVector;
+
+        std::array<RegisterValue, 32> gprs = {};
+        RegisterValue programCounter = 0;
+        bool inDebugMode = false;
+
+        Registers::DebugControlStatusRegister debugControlStatusRegister = {};
+        RegisterValue debugProgramCounter = 0;
+        std::array<RegisterValue, 2> debugScratch = {};
+
+        RegisterValue machineStatus = 0;
+        RegisterValue machineTrapVector = 0;
+        RegisterValue machineScratch = 0;
+        RegisterValue machineExceptionProgramCounter = 0;
+        RegisterValue machineCause = 0;
+        RegisterValue machineTrapValue = 0;
+        std::uint64_t cycleCount = 0;
+
+        std::vector<Trigger> triggers;
+        TriggerModule::TriggerIndex selectedTriggerIndex = 0;
+
+        /**
+         * Exception cause and trap value for the last instruction that resulted in InstructionOutcome::EXCEPTION.
+         */
+        RegisterValue pendingExceptionCause = 0;
+        RegisterValue pendingExceptionValue = 0;
+
+        std::optional<RegisterValue> readCsr(RegisterNumber number);
+        bool writeCsr(RegisterNumber number, RegisterValue value);
+
+        InstructionOutcome raiseException(RegisterValue cause, RegisterValue value);
+        void takeTrap(RegisterValue instructionAddress);
+
+        /**
+         * Checks the enabled triggers against the given access, setting the hit bit on any that match.
+         *
+         * @return
+         *  The action of the first matching trigger, or std::nullopt if no triggers matched. Triggers never fire in
+         *  debug mode.
+         */
+        std::optional<TriggerModule::TriggerAction> checkTriggers(
+            AccessType accessType,
+            Targets::TargetMemoryAddress address
+        );
+
+        InstructionOutcome execute(
+            Targets::RiscV::Opcodes::Opcode opcode,
+            RegisterValue instructionAddress,
+            RegisterValue& nextInstructionAddress
+        );
+
+        void writeGpr(std::uint8_t number, RegisterValue value) {
+            if (number != 0) {
+                this->gprs[number] = value;
+            }
+        }
+    };
+}
@@ -0,0 +1,115 @@
+#include "SimulatedMemory.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "src/Services/StringService.hpp"
+
+#include "src/Exceptions/InternalFatalErrorException.hpp"
+
+namespace DebugToolDrivers::Protocols::RiscVDebug::Simulator
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+    using Targets::TargetMemoryBuffer;
+    using Targets::TargetMemoryBufferSpan;
+
+    using Services::StringService;
+
+    SimulatedMemory::SimulatedMemory(const std::vector<SimulatedMemoryRegionConfig>& regionConfigs) {
+        for (const auto& regionConfig : regionConfigs) {
+            this->regions.emplace_back(Region{
+                .config = regionConfig,
+                .data = TargetMemoryBuffer(regionConfig.size, 0xFF),
+            });
+        }
+    }
+
+    Expected<std::uint32_t, SimulatedMemory::AccessError> SimulatedMemory::read(
+        TargetMemoryAddress address,
+        std::uint8_t size
+    ) const {
+        const auto* region = this->findRegion(address, size);
+        if (region == nullptr) {
+            return AccessError::UNMAPPED;
+        }
+
+        const auto offset = address - region->config.startAddress;
+        auto value = std::uint32_t{0};
+        for (auto i = std::uint8_t{0}; i < size; ++i) {
+            value |= static_cast<std::uint32_t>(region->data[offset + i]) << (i * 8);
+        }
+
+        return value;
+    }
+
+    std::optional<SimulatedMemory::AccessError> SimulatedMemory::write(
+        TargetMemoryAddress address,
+        std::uint8_t size,
+        std::uint32_t value
+    ) {
+        auto* region = this->findRegion(address, size);
+        if (region == nullptr) {
+            return AccessError::UNMAPPED;
+        }
+
+        if (!region->config.writable) {
+            return AccessError::READ_ONLY;
+        }
+
+        const auto offset = address - region->config.startAddress;
+        for (auto i = std::uint8_t{0}; i < size; ++i) {
+            region->data[offset + i] = static_cast<unsigned char>(value >> (i * 8));
+        }
+
+        return std::nullopt;
+    }
+
+    void SimulatedMemory::load(TargetMemoryAddress address, TargetMemoryBufferSpan data) {
+        for (auto offset = std::size_t{0}; offset < data.size(); ++offset) {
+            auto* region = this->findRegion(static_cast<TargetMemoryAddress>(address + offset), 1);
+            if (region == nullptr) {
+                throw Exceptions::InternalFatalErrorException{
+                    "Simulated memory load to unmapped address 0x"
+                        + StringService::toHex(static_cast<TargetMemoryAddress>(address + offset))
+                };
+            }
+
+            region->data[address + offset - region->config.startAddress] = data[offset];
+        }
+    }
+
+    TargetMemoryBuffer SimulatedMemory::dump(TargetMemoryAddress address, TargetMemorySize size) const {
+        auto output = TargetMemoryBuffer{};
+        output.reserve(size);
+
+        for (auto offset = TargetMemorySize{0}; offset < size; ++offset) {
+            const auto* region = this->findRegion(address + offset, 1);
+            if (region == nullptr) {
+                throw Exceptions::InternalFatalErrorException{
+                    "Simulated memory dump from unmapped address 0x" + StringService::toHex(address + offset)
+                };
+            }
+
+            output.emplace_back(region->data[address + offset - region->config.startAddress]);
+        }
+
+        return output;
+    }
+
+    const SimulatedMemory::Region* SimulatedMemory::findRegion(TargetMemoryAddress address, std::uint8_t size) const {
+        const auto regionIt = std::find_if(
+            this->regions.begin(),
+            this->regions.end(),
+            [address, size] (const Region& region) {
+                return region.contains(address, size);
+            }
+        );
+
+        return regionIt != this->regions.end() ? &*regionIt : nullptr;
+    }
+
+    SimulatedMemory::Region* SimulatedMemory::findRegion(TargetMemoryAddress address, std::uint8_t size) {
+        return const_cast<Region*>(std::as_const(*this).findRegion(address, size));
+    }
+}
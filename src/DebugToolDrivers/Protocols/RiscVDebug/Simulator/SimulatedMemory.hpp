@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <span>
+#include <optional>
+
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Helpers/Expected.hpp"
+
+namespace DebugToolDrivers::Protocols::RiscVDebug::Simulator
+{
+    struct SimulatedMemoryRegionConfig
+    {
+        std::string name;
+        Targets::TargetMemoryAddress startAddress = 0;
+        Targets::TargetMemorySize size = 0;
+
+        /**
+         * Whether the region can be written to by the simulated hart (or via the debug module).
+         *
+         * Flash regions should be read-only - on real targets, flash is programmed via a vendor-specific mechanism
+         * (e.g. the WCH-Link's flash programming commands), not via plain stores. The contents of read-only regions
+         * can be populated via SimulatedMemory::load().
+         */
+        bool writable = true;
+    };
+
+    /**
+     * A flat, little-endian system bus model, consisting of a set of non-overlapping memory regions.
+     */
+    class SimulatedMemory
+    {
+    public:
+        enum class AccessError: std::uint8_t
+        {
+            UNMAPPED,
+            READ_ONLY,
+        };
+
+        explicit SimulatedMemory(const std::vector<SimulatedMemoryRegionConfig>& regionConfigs);
+
+        /**
+         * Reads a value of the given size (1, 2 or 4 bytes) from the bus.
+         *
+         * @param address
+         * @param size
+         *
+         * @return
+         */
+        Expected<std::uint32_t, AccessError> read(Targets::TargetMemoryAddress address, std::uint8_t size) const;
+
+        /**
+         * Writes a value of the given size (1, 2 or 4 bytes) to the bus.
+         *
+         * @param address
+         * @param size
+         * @param value
+         *
+         * @return
+         *  std::nullopt on success, otherwise the access error.
+         */
+        std::optional<AccessError> write(
+            Targets::TargetMemoryAddress address,
+            std::uint8_t size,
+            std::uint32_t value
+        );
+
+        /**
+         * Copies data into memory, bypassing write protection. For populating flash with a program image.
+         *
+         * Throws an InternalFatalErrorException if any part of the destination is unmapped.
+         *
+         * @param address
+         * @param data
+         */
+        void load(Targets::TargetMemoryAddress address, Targets::TargetMemoryBufferSpan data);
+
+        /**
+         * Copies data out of memory, without going through the simulated bus (no access counting).
+         *
+         * @param address
+         * @param size
+         *
+         * @return
+         */
+        [[nodiscard]] Targets::TargetMemoryBuffer dump(
+            Targets::TargetMemoryAddress address,
+            Targets::TargetMemorySize size
+        ) const;
+
+    private:
+        struct Region
+        {
+            SimulatedMemoryRegionConfig config;
+            Targets::TargetMemoryBuffer data;
+
+            [[nodiscard]] bool contains(Targets::TargetMemoryAddress address, std::uint8_t size) const {
+                return address >= this->config.startAddress
+                    && (static_cast<std::uint64_t>(address) + size)
+                        <= (static_cast<std::uint64_t>(this->config.startAddress) + this->config.size);
+            }
+        };
+
+        std::vector<Region> regions;
+
+        [[nodiscard]] const Region* findRegion(Targets::TargetMemoryAddress address, std::uint8_t size) const;
+        [[nodiscard]] Region* findRegion(Targets::TargetMemoryAddress address, std::uint8_t size);
+    };
+}
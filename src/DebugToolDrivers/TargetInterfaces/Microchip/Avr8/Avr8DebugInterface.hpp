@@ -121,6 +121,17 @@ namespace DebugToolDrivers::TargetInterfaces::Microchip::Avr8
             Targets::TargetMemoryBufferSpan buffer
         ) = 0;
 
+        /**
+         * Should return the maximum number of bytes that can be read from the given memory segment, in a single
+         * transaction with the debug tool.
+         *
+         * @param memorySegmentDescriptor
+         * @return
+         */
+        virtual Targets::TargetMemorySize maximumMemoryReadSize(
+            const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        ) = 0;
+
         /**
          * Should erase the target's entire program memory, or a specific section where applicable.
          *
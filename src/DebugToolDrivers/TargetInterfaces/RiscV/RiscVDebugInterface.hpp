@@ -60,6 +60,27 @@ namespace DebugToolDrivers::TargetInterfaces::RiscV
             const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor
         ) = 0;
 
+        /**
+         * Should return the maximum number of bytes that can be read from the given memory segment, in a single
+         * transaction with the debug tool.
+         *
+         * @param memorySegmentDescriptor
+         * @return
+         */
+        virtual Targets::TargetMemorySize maximumMemoryReadSize(
+            const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        ) = 0;
+
+        /**
+         * Should determine whether the given memory segment can be read whilst the hart is running.
+         *
+         * @param memorySegmentDescriptor
+         * @return
+         */
+        virtual bool canReadMemoryWhileRunning(
+            const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        ) = 0;
+
         virtual void enableProgrammingMode() = 0;
         virtual void disableProgrammingMode() = 0;
 
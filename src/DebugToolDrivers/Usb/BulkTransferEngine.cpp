@@ -0,0 +1,169 @@
+#include "BulkTransferEngine.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+#include "src/Logger/Logger.hpp"
+
+#include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
+
+namespace Usb
+{
+    using namespace Exceptions;
+
+    BulkTransferEngine::BulkTransferEngine(::libusb_context* libusbContext, ::libusb_device_handle* deviceHandle)
+        : libusbContext(libusbContext)
+        , deviceHandle(deviceHandle)
+        , eventThread(&BulkTransferEngine::handleEvents, this)
+    {}
+
+    BulkTransferEngine::~BulkTransferEngine() {
+        this->stopping = true;
+        ::libusb_interrupt_event_handler(this->libusbContext);
+
+        if (this->eventThread.joinable()) {
+            this->eventThread.join();
+        }
+    }
+
+    void BulkTransferEngine::write(
+        std::uint8_t endpointAddress,
+        std::span<const unsigned char> buffer,
+        std::uint16_t maxPacketSize,
+        std::chrono::milliseconds timeout
+    ) {
+        assert(maxPacketSize > 0);
+
+        if (buffer.empty()) {
+            return;
+        }
+
+        auto operation = WriteOperation{
+            .engine = *this,
+            .endpointAddress = endpointAddress,
+            .buffer = buffer,
+            .transferSize = static_cast<std::size_t>(maxPacketSize) * BulkTransferEngine::PACKETS_PER_TRANSFER,
+            .timeout = static_cast<unsigned int>(timeout.count()),
+        };
+
+        auto lock = std::unique_lock{operation.mutex};
+
+        while (
+            operation.inFlightTransfers.size() < BulkTransferEngine::MAXIMUM_IN_FLIGHT_TRANSFERS
+            && BulkTransferEngine::submitNextTransfer(operation)
+        ) {}
+
+        /*
+         * We must wait for all in-flight transfers to complete (or be cancelled), even if one of them has failed, as
+         * they hold a pointer to the operation.
+         */
+        operation.completed.wait(lock, [&operation] {
+            return operation.inFlightTransfers.empty();
+        });
+
+        if (operation.failure.has_value()) {
+            throw DeviceCommunicationFailure{"Failed to write data to bulk endpoint - " + *(operation.failure)};
+        }
+    }
+
+    bool BulkTransferEngine::submitNextTransfer(WriteOperation& operation) {
+        if (operation.failure.has_value() || operation.nextOffset >= operation.buffer.size()) {
+            return false;
+        }
+
+        auto* transfer = ::libusb_alloc_transfer(0);
+        if (transfer == nullptr) {
+            BulkTransferEngine::recordFailure(operation, "failed to allocate transfer");
+            return false;
+        }
+
+        const auto length = std::min(operation.transferSize, operation.buffer.size() - operation.nextOffset);
+        assert(length <= std::numeric_limits<int>::max());
+
+        ::libusb_fill_bulk_transfer(
+            transfer,
+            operation.engine.deviceHandle,
+            operation.endpointAddress,
+            /*
+             * As with UsbInterface::writeBulk(), we're lying about the constness of the buffer here. libusb won't
+             * write to it, as we're not reading from the device.
+             */
+            const_cast<unsigned char*>(operation.buffer.data()) + operation.nextOffset,
+            static_cast<int>(length),
+            &BulkTransferEngine::onTransferCompleted,
+            &operation,
+            operation.timeout
+        );
+
+        const auto statusCode = ::libusb_submit_transfer(transfer);
+        if (statusCode != 0) {
+            ::libusb_free_transfer(transfer);
+            BulkTransferEngine::recordFailure(
+                operation,
+                "failed to submit transfer - error code: " + std::to_string(statusCode)
+            );
+            return false;
+        }
+
+        operation.nextOffset += length;
+        operation.inFlightTransfers.push_back(transfer);
+        return true;
+    }
+
+    void LIBUSB_CALL BulkTransferEngine::onTransferCompleted(::libusb_transfer* transfer) {
+        auto& operation = *static_cast<WriteOperation*>(transfer->user_data);
+        const auto lock = std::unique_lock{operation.mutex};
+
+        // This transfer must be removed before recording any failure, as it can no longer be cancelled
+        std::erase(operation.inFlightTransfers, transfer);
+
+        if (
+            !operation.failure.has_value()
+            && (transfer->status != ::LIBUSB_TRANSFER_COMPLETED || transfer->actual_length != transfer->length)
+        ) {
+            Logger::debug(
+                "Attempted to write " + std::to_string(transfer->length) + " bytes to USB bulk endpoint. Bytes "
+                    "written: " + std::to_string(transfer->actual_length) + ". Transfer status: "
+                    + std::to_string(transfer->status)
+            );
+            BulkTransferEngine::recordFailure(operation, "transfer status: " + std::to_string(transfer->status));
+        }
+
+        ::libusb_free_transfer(transfer);
+
+        BulkTransferEngine::submitNextTransfer(operation);
+
+        if (operation.inFlightTransfers.empty()) {
+            /*
+             * We notify whilst holding the lock, as the operation object lives on the writing thread's stack, and
+             * it will be destroyed as soon as that thread observes the final completion.
+             */
+            operation.completed.notify_one();
+        }
+    }
+
+    void BulkTransferEngine::recordFailure(WriteOperation& operation, const std::string& failure) {
+        if (operation.failure.has_value()) {
+            return;
+        }
+
+        operation.failure = failure;
+
+        for (auto* transfer : operation.inFlightTransfers) {
+            /*
+             * The cancelled transfers will still complete (with LIBUSB_TRANSFER_CANCELLED status), via
+             * onTransferCompleted(), so write() will continue to wait for them. Transfers that have already completed
+             * but have yet to be reaped will yield LIBUSB_ERROR_NOT_FOUND, which we can ignore.
+             */
+            ::libusb_cancel_transfer(transfer);
+        }
+    }
+
+    void BulkTransferEngine::handleEvents() {
+        while (!this->stopping) {
+            auto timeout = ::timeval{.tv_sec = 0, .tv_usec = 100000};
+            ::libusb_handle_events_timeout_completed(this->libusbContext, &timeout, nullptr);
+        }
+    }
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <optional>
+#include <vector>
+#include <string>
+#include <chrono>
+
+#include <libusb-1.0/libusb.h>
+
+namespace Usb
+{
+    /**
+     * Asynchronous bulk transfer engine, built on libusb's asynchronous API.
+     *
+     * A single write is split into multiple transfers, which are all submitted upfront (up to
+     * BulkTransferEngine::MAXIMUM_IN_FLIGHT_TRANSFERS at a time), so that the host controller always has data queued
+     * for the endpoint. When a transfer completes, the next one is submitted from the completion callback. This
+     * keeps the USB link busy, as opposed to issuing one synchronous transfer at a time and waiting for each to
+     * complete before submitting the next.
+     *
+     * Transfers on the same endpoint are processed in submission order, so the device receives the data in the
+     * same order, and with the same packet boundaries, as it would with synchronous transfers. If a transfer fails,
+     * all other in-flight transfers are cancelled, to prevent any subsequent data from reaching the device.
+     *
+     * libusb events are handled on a dedicated thread, which is started upon construction and stopped upon
+     * destruction.
+     */
+    class BulkTransferEngine
+    {
+    public:
+        /**
+         * The maximum number of transfers that can be in flight at any one time, for a single write.
+         */
+        static constexpr std::size_t MAXIMUM_IN_FLIGHT_TRANSFERS = 8;
+
+        /**
+         * The number of max-sized packets carried by each transfer.
+         */
+        static constexpr std::size_t PACKETS_PER_TRANSFER = 16;
+
+        BulkTransferEngine(::libusb_context* libusbContext, ::libusb_device_handle* deviceHandle);
+        ~BulkTransferEngine();
+
+        BulkTransferEngine(const BulkTransferEngine& other) = delete;
+        BulkTransferEngine& operator = (const BulkTransferEngine& other) = delete;
+
+        BulkTransferEngine(BulkTransferEngine&& other) = delete;
+        BulkTransferEngine& operator = (BulkTransferEngine&& other) = delete;
+
+        /**
+         * Writes the given buffer to a bulk endpoint, blocking until all transfers have completed.
+         *
+         * @param endpointAddress
+         * @param buffer
+         * @param maxPacketSize
+         *  The endpoint's max packet size.
+         *
+         * @param timeout
+         *  The timeout for each individual transfer.
+         */
+        void write(
+            std::uint8_t endpointAddress,
+            std::span<const unsigned char> buffer,
+            std::uint16_t maxPacketSize,
+            std::chrono::milliseconds timeout = std::chrono::milliseconds{5000}
+        );
+
+    private:
+        /**
+         * The state of a single write, shared with the completion callback.
+         */
+        struct WriteOperation
+        {
+            BulkTransferEngine& engine;
+            std::uint8_t endpointAddress;
+            std::span<const unsigned char> buffer;
+            std::size_t transferSize;
+            unsigned int timeout;
+
+            /**
+             * The offset of the next chunk of the buffer to submit.
+             */
+            std::size_t nextOffset = 0;
+
+            /**
+             * The transfers currently in flight. Upon the first failure, these are cancelled, so that no data
+             * beyond the failed transfer reaches the device.
+             */
+            std::vector<::libusb_transfer*> inFlightTransfers;
+            std::optional<std::string> failure = std::nullopt;
+
+            std::mutex mutex;
+            std::condition_variable completed;
+        };
+
+        ::libusb_context* libusbContext;
+        ::libusb_device_handle* deviceHandle;
+
+        std::atomic<bool> stopping = false;
+        std::thread eventThread;
+
+        /**
+         * Submits the next chunk of the operation's buffer, if there is one.
+         *
+         * Must be called with the operation's mutex held.
+         *
+         * @param operation
+         * @return
+         *  True if a transfer was submitted.
+         */
+        static bool submitNextTransfer(WriteOperation& operation);
+
+        /**
+         * Records the first failure of the operation and cancels all of its in-flight transfers. Subsequent failures
+         * (including those of the cancelled transfers) are ignored.
+         *
+         * Must be called with the operation's mutex held.
+         *
+         * @param operation
+         * @param failure
+         */
+        static void recordFailure(WriteOperation& operation, const std::string& failure);
+
+        static void LIBUSB_CALL onTransferCompleted(::libusb_transfer* transfer);
+
+        void handleEvents();
+    };
+}
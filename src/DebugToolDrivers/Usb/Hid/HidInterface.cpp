@@ -1,5 +1,6 @@
 #include "HidInterface.hpp"
 
+#include "src/DebugToolDrivers/Usb/UsbTrace.hpp"
 #include "src/Logger/Logger.hpp"
 
 #include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
@@ -13,34 +14,97 @@ namespace Usb
         std::uint8_t interfaceNumber,
         std::uint16_t inputReportSize,
         std::uint16_t vendorId,
-        std::uint16_t productId
+        std::uint16_t productId,
+        std::optional<std::string> serialNumber
     )
         : interfaceNumber(interfaceNumber)
         , inputReportSize(inputReportSize)
         , vendorId(vendorId)
         , productId(productId)
+        , serialNumber(std::move(serialNumber))
     {}
 
     void HidInterface::init() {
-        ::hid_init();
-        ::hid_device* hidDevice = nullptr;
-
-        const auto hidInterfacePath = this->getHidDevicePath();
-        Logger::debug("HID device path: " + hidInterfacePath);
+        if (UsbTrace::replaying()) {
+            return;
+        }
 
-        if ((hidDevice = ::hid_open_path(hidInterfacePath.c_str())) == nullptr) {
-            throw DeviceInitializationFailure{"Failed to open HID device via hidapi."};
+        if (this->hidDevice) {
+            return;
         }
 
-        this->hidDevice.reset(hidDevice);
+        HidInterface::acquireHidapi();
+
+        try {
+            ::hid_device* hidDevice = nullptr;
+
+            const auto hidInterfacePath = this->getHidDevicePath();
+            Logger::debug("HID device path: " + hidInterfacePath);
+
+            if ((hidDevice = ::hid_open_path(hidInterfacePath.c_str())) == nullptr) {
+                throw DeviceInitializationFailure{"Failed to open HID device via hidapi."};
+            }
+
+            this->hidDevice.reset(hidDevice);
+
+        } catch (...) {
+            HidInterface::releaseHidapi();
+            throw;
+        }
     }
 
     void HidInterface::close() {
+        if (UsbTrace::replaying() || !this->hidDevice) {
+            return;
+        }
+
         this->hidDevice.reset();
-        ::hid_exit();
+        HidInterface::releaseHidapi();
     }
 
     std::vector<unsigned char> HidInterface::read(std::optional<std::chrono::milliseconds> timeout) {
+        return UsbTrace::read(UsbTraceRecordType::HID_READ, this->interfaceNumber, [this, timeout] {
+            return this->readReports(timeout);
+        });
+    }
+
+    void HidInterface::write(std::vector<unsigned char>&& buffer) {
+        if (buffer.size() > this->inputReportSize) {
+            throw DeviceCommunicationFailure{"Cannot send data via HID interface - data exceeds maximum packet size."};
+        }
+
+        if (buffer.size() < this->inputReportSize) {
+            /*
+             * Every report we send via the USB HID interface should be of a fixed size.
+             * In the event of a report being too small, we just fill the buffer vector with 0.
+             */
+            buffer.resize(this->inputReportSize, 0);
+        }
+
+        UsbTrace::write(UsbTraceRecordType::HID_WRITE, this->interfaceNumber, buffer, [this, &buffer] {
+            this->writeReport(buffer);
+        });
+    }
+
+    void HidInterface::acquireHidapi() {
+        const auto lock = std::unique_lock{HidInterface::hidapiMutex};
+
+        if (HidInterface::hidapiReferenceCount == 0 && ::hid_init() != 0) {
+            throw DeviceInitializationFailure{"Failed to initialise hidapi."};
+        }
+
+        ++HidInterface::hidapiReferenceCount;
+    }
+
+    void HidInterface::releaseHidapi() {
+        const auto lock = std::unique_lock{HidInterface::hidapiMutex};
+
+        if (--HidInterface::hidapiReferenceCount == 0) {
+            ::hid_exit();
+        }
+    }
+
+    std::vector<unsigned char> HidInterface::readReports(std::optional<std::chrono::milliseconds> timeout) {
         auto output = std::vector<unsigned char>{};
 
         const auto readSize = this->inputReportSize;
@@ -74,19 +138,7 @@ namespace Usb
         return output;
     }
 
-    void HidInterface::write(std::vector<unsigned char>&& buffer) {
-        if (buffer.size() > this->inputReportSize) {
-            throw DeviceCommunicationFailure{"Cannot send data via HID interface - data exceeds maximum packet size."};
-        }
-
-        if (buffer.size() < this->inputReportSize) {
-            /*
-             * Every report we send via the USB HID interface should be of a fixed size.
-             * In the event of a report being too small, we just fill the buffer vector with 0.
-             */
-            buffer.resize(this->inputReportSize, 0);
-        }
-
+    void HidInterface::writeReport(std::span<unsigned char> buffer) {
         int transferred = 0;
         const auto length = buffer.size();
 
@@ -105,16 +157,27 @@ namespace Usb
             ::hid_free_enumeration
         };
 
+        // Serial numbers are retrieved as ASCII (see UsbDevice::readSerialNumber())
+        const auto serialNumber = this->serialNumber.has_value()
+            ? std::optional<std::wstring>{std::wstring{this->serialNumber->begin(), this->serialNumber->end()}}
+            : std::nullopt;
+
         auto matchedDevice = std::optional<::hid_device_info*>{};
 
         auto* hidDeviceInfo = hidDeviceInfoList.get();
         while (hidDeviceInfo != nullptr) {
-            if (hidDeviceInfo->interface_number == this->interfaceNumber) {
+            if (
+                hidDeviceInfo->interface_number == this->interfaceNumber
+                && (
+                    !serialNumber.has_value()
+                    || (hidDeviceInfo->serial_number != nullptr && *serialNumber == hidDeviceInfo->serial_number)
+                )
+            ) {
                 matchedDevice = hidDeviceInfo;
                 break;
             }
 
-            hidDeviceInfo = hidDeviceInfoList->next;
+            hidDeviceInfo = hidDeviceInfo->next;
         }
 
         if (!matchedDevice.has_value()) {
@@ -6,6 +6,8 @@
 #include <vector>
 #include <optional>
 #include <chrono>
+#include <span>
+#include <mutex>
 
 #include <hidapi/hidapi.h>
 #include <hidapi/hidapi_libusb.h>
@@ -28,7 +30,8 @@ namespace Usb
             std::uint8_t interfaceNumber,
             std::uint16_t inputReportSize,
             std::uint16_t vendorId,
-            std::uint16_t productId
+            std::uint16_t productId,
+            std::optional<std::string> serialNumber = std::nullopt
         );
 
         HidInterface(const HidInterface& other) = delete;
@@ -73,5 +76,27 @@ namespace Usb
 
         std::uint16_t vendorId = 0;
         std::uint16_t productId = 0;
+
+        /**
+         * If set, only the HID interface of the device with this serial number will be matched. See
+         * UsbDevice::serialNumber.
+         */
+        std::optional<std::string> serialNumber;
+
+        /**
+         * hid_init() and hid_exit() act on global state within the HIDAPI library. HID interfaces can be initialised
+         * and closed on multiple TargetController threads, so we reference count them. The library is initialised
+         * upon the first init() and shut down upon the last close().
+         *
+         * An instance holds a reference for as long as it holds an open hid_device.
+         */
+        static inline std::mutex hidapiMutex;
+        static inline std::size_t hidapiReferenceCount = 0;
+
+        static void acquireHidapi();
+        static void releaseHidapi();
+
+        std::vector<unsigned char> readReports(std::optional<std::chrono::milliseconds> timeout);
+        void writeReport(std::span<unsigned char> buffer);
     };
 }
@@ -4,6 +4,8 @@
 #include <array>
 #include <thread>
 
+#include "UsbTrace.hpp"
+
 #include "src/Logger/Logger.hpp"
 #include "src/Services/StringService.hpp"
 
@@ -15,10 +17,17 @@ namespace Usb
 {
     using namespace Exceptions;
 
-    UsbDevice::UsbDevice(std::uint16_t vendorId, std::uint16_t productId)
+    UsbDevice::UsbDevice(
+        std::uint16_t vendorId,
+        std::uint16_t productId,
+        std::optional<std::string> serialNumber
+    )
         : vendorId(vendorId)
         , productId(productId)
+        , serialNumber(std::move(serialNumber))
     {
+        const auto libusbContextLock = std::unique_lock{UsbDevice::libusbContextMutex};
+
         if (!UsbDevice::libusbContext) {
             ::libusb_context* libusbContext = nullptr;
             ::libusb_init(&libusbContext);
@@ -32,23 +41,50 @@ namespace Usb
 
     void UsbDevice::init() {
 //        ::libusb_set_option(this->libusbContext, LIBUSB_OPTION_LOG_LEVEL, LIBUSB_LOG_LEVEL_NONE);
-        auto devices = this->findMatchingDevices(this->vendorId, this->productId);
+        auto devices = std::vector<LibusbDevice>{};
+        const auto deviceCount = UsbTrace::value(UsbTraceRecordType::DEVICE_COUNT, 0, [this, &devices] {
+            devices = this->findMatchingDevices(this->vendorId, this->productId);
+
+            if (this->serialNumber.has_value()) {
+                std::erase_if(devices, [this] (const LibusbDevice& device) {
+                    return UsbDevice::tryReadSerialNumber(device.get()) != this->serialNumber;
+                });
+            }
 
-        if (devices.empty()) {
+            return static_cast<std::uint32_t>(devices.size());
+        });
+
+        if (deviceCount == 0) {
             throw DeviceNotFound{
-                "Failed to find USB device with matching vendor and product ID. Please examine the debug tool's USB "
-                    "connection, as well as the selected environment's debug tool configuration, in bloom.yaml"
+                (
+                    this->serialNumber.has_value()
+                        ? "Failed to find USB device with matching vendor ID, product ID and serial number (\""
+                            + *(this->serialNumber) + "\")."
+                        : std::string{"Failed to find USB device with matching vendor and product ID."}
+                ) + " Please examine the debug tool's USB connection, as well as the selected environment's debug "
+                    "tool configuration, in bloom.yaml"
             };
         }
 
-        if (devices.size() > 1) {
-            // TODO: implement support for multiple devices via serial number matching?
+        if (deviceCount > 1) {
+            if (this->serialNumber.has_value()) {
+                throw DeviceInitializationFailure{
+                    "Numerous devices with serial number \"" + *(this->serialNumber) + "\" found."
+                };
+            }
+
             throw DeviceInitializationFailure{
                 "Numerous devices of matching vendor and product ID found.\n"
-                    "Please ensure that only one debug tool is connected and then try again."
+                    "Please ensure that only one debug tool is connected, or specify the serial number of the debug "
+                    "tool via the \"serial_number\" parameter in the environment's debug tool configuration, and "
+                    "then try again."
             };
         }
 
+        if (UsbTrace::replaying()) {
+            return;
+        }
+
         this->libusbDevice.swap(devices.front());
         ::libusb_device_handle* deviceHandle = nullptr;
 
@@ -64,10 +100,25 @@ namespace Usb
     }
 
     std::string UsbDevice::getSerialNumber() const {
+        const auto serialNumber = UsbTrace::read(UsbTraceRecordType::SERIAL_NUMBER, 0, [this] {
+            return this->readSerialNumber();
+        });
+
+        return {serialNumber.begin(), serialNumber.end()};
+    }
+
+    std::vector<unsigned char> UsbDevice::readSerialNumber() const {
         assert(this->libusbDevice && this->libusbDeviceHandle);
+        return UsbDevice::readSerialNumber(this->libusbDevice.get(), this->libusbDeviceHandle.get());
+    }
+
+    std::vector<unsigned char> UsbDevice::readSerialNumber(
+        ::libusb_device* device,
+        ::libusb_device_handle* deviceHandle
+    ) {
         struct ::libusb_device_descriptor desc = {};
 
-        auto statusCode = ::libusb_get_device_descriptor(this->libusbDevice.get(), &desc);
+        auto statusCode = ::libusb_get_device_descriptor(device, &desc);
         if (statusCode != 0) {
             throw DeviceCommunicationFailure{
                 "Failed to retrieve USB device descriptor - status code: " + std::to_string(statusCode)
@@ -76,7 +127,7 @@ namespace Usb
 
         auto data = std::array<unsigned char, 256>{};
         const auto transferredBytes = ::libusb_get_string_descriptor_ascii(
-            this->libusbDeviceHandle.get(),
+            deviceHandle,
             desc.iSerialNumber,
             data.data(),
             data.size()
@@ -91,7 +142,35 @@ namespace Usb
         return {data.begin(), data.begin() + transferredBytes};
     }
 
+    std::optional<std::string> UsbDevice::tryReadSerialNumber(::libusb_device* device) {
+        ::libusb_device_handle* deviceHandle = nullptr;
+
+        const auto libusbStatusCode = ::libusb_open(device, &deviceHandle);
+        if (libusbStatusCode < 0) {
+            Logger::debug(
+                "Failed to open USB device for serial number matching - error code "
+                    + std::to_string(libusbStatusCode) + " returned."
+            );
+            return std::nullopt;
+        }
+
+        const auto libusbDeviceHandle = LibusbDeviceHandle{deviceHandle, ::libusb_close};
+
+        try {
+            const auto serialNumber = UsbDevice::readSerialNumber(device, libusbDeviceHandle.get());
+            return std::string{serialNumber.begin(), serialNumber.end()};
+
+        } catch (const DeviceCommunicationFailure& exception) {
+            Logger::debug("Failed to read serial number for matching - " + exception.getMessage());
+            return std::nullopt;
+        }
+    }
+
     void UsbDevice::setConfiguration(std::uint8_t configurationIndex) {
+        if (UsbTrace::replaying()) {
+            return;
+        }
+
         const auto configDescriptor = this->getConfigDescriptor(configurationIndex);
 
         const auto libusbStatusCode = ::libusb_set_configuration(
@@ -120,25 +199,48 @@ namespace Usb
     }
 
     bool UsbDevice::devicePresent(std::uint16_t vendorId, std::uint16_t productId) {
-        return !UsbDevice::findMatchingDevices(vendorId, productId).empty();
+        return UsbTrace::value(UsbTraceRecordType::DEVICE_PRESENT, 0, [vendorId, productId] {
+            return static_cast<std::uint32_t>(!UsbDevice::findMatchingDevices(vendorId, productId).empty());
+        }) != 0;
     }
 
     bool UsbDevice::waitForDevice(std::uint16_t vendorId, std::uint16_t productId, std::chrono::milliseconds timeout) {
-        static constexpr auto DELAY = std::chrono::milliseconds{50};
-        for (auto i = 0; (i * DELAY) <= timeout; ++i){
-            if (!UsbDevice::findMatchingDevices(vendorId, productId).empty()) {
-                return true;
-            }
+        return UsbTrace::value(UsbTraceRecordType::DEVICE_PRESENT, 0, [vendorId, productId, timeout] {
+            static constexpr auto DELAY = std::chrono::milliseconds{50};
+            for (auto i = 0; (i * DELAY) <= timeout; ++i){
+                if (!UsbDevice::findMatchingDevices(vendorId, productId).empty()) {
+                    return std::uint32_t{1};
+                }
 
-            std::this_thread::sleep_for(DELAY);
-        }
+                std::this_thread::sleep_for(DELAY);
+            }
 
-        return false;
+            return std::uint32_t{0};
+        }) != 0;
     }
 
     std::uint8_t UsbDevice::getFirstEndpointAddress(
         std::uint8_t interfaceNumber,
         ::libusb_endpoint_direction direction
+    ) {
+        return static_cast<std::uint8_t>(
+            UsbTrace::value(UsbTraceRecordType::ENDPOINT_ADDRESS, interfaceNumber, [this, interfaceNumber, direction] {
+                return static_cast<std::uint32_t>(this->findFirstEndpointAddress(interfaceNumber, direction));
+            })
+        );
+    }
+
+    std::uint16_t UsbDevice::getEndpointMaxPacketSize(std::uint8_t endpointAddress) {
+        return static_cast<std::uint16_t>(
+            UsbTrace::value(UsbTraceRecordType::ENDPOINT_MAX_PACKET_SIZE, endpointAddress, [this, endpointAddress] {
+                return static_cast<std::uint32_t>(this->findEndpointMaxPacketSize(endpointAddress));
+            })
+        );
+    }
+
+    std::uint8_t UsbDevice::findFirstEndpointAddress(
+        std::uint8_t interfaceNumber,
+        ::libusb_endpoint_direction direction
     ) {
         const auto activeConfigDescriptor = this->getConfigDescriptor();
 
@@ -161,7 +263,7 @@ namespace Usb
         throw DeviceInitializationFailure{"Failed to obtain address of USB endpoint"};
     }
 
-    std::uint16_t UsbDevice::getEndpointMaxPacketSize(std::uint8_t endpointAddress) {
+    std::uint16_t UsbDevice::findEndpointMaxPacketSize(std::uint8_t endpointAddress) {
         const auto activeConfigDescriptor = this->getConfigDescriptor();
 
         for (auto interfaceIndex = 0; interfaceIndex < activeConfigDescriptor->bNumInterfaces; ++interfaceIndex) {
@@ -237,6 +339,10 @@ namespace Usb
     }
 
     void UsbDevice::detachKernelDriverFromInterface(std::uint8_t interfaceNumber) {
+        if (UsbTrace::replaying()) {
+            return;
+        }
+
         const auto libusbStatusCode = ::libusb_kernel_driver_active(this->libusbDeviceHandle.get(), interfaceNumber);
 
         if (libusbStatusCode == 1) {
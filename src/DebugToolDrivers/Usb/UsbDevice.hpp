@@ -4,8 +4,10 @@
 #include <memory>
 #include <vector>
 #include <optional>
+#include <string>
 #include <libusb-1.0/libusb.h>
 #include <chrono>
+#include <mutex>
 
 #include "src/DebugToolDrivers/DebugTool.hpp"
 
@@ -27,7 +29,17 @@ namespace Usb
         std::uint16_t vendorId;
         std::uint16_t productId;
 
-        UsbDevice(std::uint16_t vendorId, std::uint16_t productId);
+        /**
+         * If set, init() will only match the device with this serial number. This allows for the use of multiple
+         * devices with the same vendor and product ID.
+         */
+        std::optional<std::string> serialNumber;
+
+        UsbDevice(
+            std::uint16_t vendorId,
+            std::uint16_t productId,
+            std::optional<std::string> serialNumber = std::nullopt
+        );
         virtual ~UsbDevice();
 
         UsbDevice(const UsbDevice& other) = delete;
@@ -74,8 +86,33 @@ namespace Usb
 
     protected:
         static std::vector<LibusbDevice> findMatchingDevices(std::uint16_t vendorId, std::uint16_t productId);
+        std::vector<unsigned char> readSerialNumber() const;
+        static std::vector<unsigned char> readSerialNumber(
+            ::libusb_device* device,
+            ::libusb_device_handle* deviceHandle
+        );
+
+        /**
+         * Opens the given device and retrieves its serial number, for matching against UsbDevice::serialNumber.
+         *
+         * @param device
+         *
+         * @return
+         *  The device's serial number, or std::nullopt if the device could not be opened or the serial number could
+         *  not be retrieved (which will be the case for devices claimed by other processes).
+         */
+        static std::optional<std::string> tryReadSerialNumber(::libusb_device* device);
+        std::uint8_t findFirstEndpointAddress(std::uint8_t interfaceNumber, ::libusb_endpoint_direction direction);
+        std::uint16_t findEndpointMaxPacketSize(std::uint8_t endpointAddress);
         LibusbConfigDescriptor getConfigDescriptor(std::optional<std::uint8_t> configurationIndex = std::nullopt);
         void detachKernelDriverFromInterface(std::uint8_t interfaceNumber);
         void close();
+
+    private:
+        /**
+         * Debug tools can be constructed on multiple TargetController threads concurrently, so initialisation of
+         * the shared libusb context must be synchronised.
+         */
+        static inline std::mutex libusbContextMutex;
     };
 }
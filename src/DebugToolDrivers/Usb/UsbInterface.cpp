@@ -3,6 +3,9 @@
 #include <cassert>
 #include <limits>
 
+#include "UsbDevice.hpp"
+#include "UsbTrace.hpp"
+
 #include "src/Logger/Logger.hpp"
 
 #include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
@@ -25,6 +28,10 @@ namespace Usb
     }
 
     void UsbInterface::init() {
+        if (UsbTrace::replaying()) {
+            return;
+        }
+
         Logger::debug("Claiming USB interface (number: " + std::to_string(this->interfaceNumber) + ")");
 
         const auto statusCode = ::libusb_claim_interface(this->deviceHandle, this->interfaceNumber);
@@ -39,6 +46,9 @@ namespace Usb
     }
 
     void UsbInterface::close() {
+        // The engine must be stopped before the interface is released, as it may still be handling events
+        this->bulkTransferEngine.reset();
+
         if (this->claimed) {
             const auto statusCode = ::libusb_release_interface(this->deviceHandle, this->interfaceNumber);
             if (statusCode != 0 && statusCode != ::LIBUSB_ERROR_NO_DEVICE) {
@@ -55,6 +65,30 @@ namespace Usb
     std::vector<unsigned char> UsbInterface::readBulk(
         std::uint8_t endpointAddress,
         std::optional<std::chrono::milliseconds> timeout
+    ) {
+        return UsbTrace::read(UsbTraceRecordType::BULK_READ, endpointAddress, [this, endpointAddress, timeout] {
+            return this->readBulkTransfers(endpointAddress, timeout);
+        });
+    }
+
+    void UsbInterface::writeBulk(
+        std::uint8_t endpointAddress,
+        std::span<const unsigned char> buffer,
+        std::uint16_t maxPacketSize
+    ) {
+        UsbTrace::write(
+            UsbTraceRecordType::BULK_WRITE,
+            endpointAddress,
+            buffer,
+            [this, endpointAddress, buffer, maxPacketSize] {
+                this->writeBulkTransfers(endpointAddress, buffer, maxPacketSize);
+            }
+        );
+    }
+
+    std::vector<unsigned char> UsbInterface::readBulkTransfers(
+        std::uint8_t endpointAddress,
+        std::optional<std::chrono::milliseconds> timeout
     ) {
         auto output = std::vector<unsigned char>{};
 
@@ -91,13 +125,25 @@ namespace Usb
         return output;
     }
 
-    void UsbInterface::writeBulk(
+    void UsbInterface::writeBulkTransfers(
         std::uint8_t endpointAddress,
         std::span<const unsigned char> buffer,
         std::uint16_t maxPacketSize
     ) {
         assert(buffer.size() <= std::numeric_limits<int>::max());
 
+        if (buffer.size() > maxPacketSize) {
+            if (!this->bulkTransferEngine) {
+                this->bulkTransferEngine = std::make_unique<BulkTransferEngine>(
+                    UsbDevice::libusbContext.get(),
+                    this->deviceHandle
+                );
+            }
+
+            this->bulkTransferEngine->write(endpointAddress, buffer, maxPacketSize);
+            return;
+        }
+
         const auto bufferSize = buffer.size();
         auto totalBytesTransferred = std::size_t{0};
 
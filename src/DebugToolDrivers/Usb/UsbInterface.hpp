@@ -5,9 +5,12 @@
 #include <span>
 #include <optional>
 #include <chrono>
+#include <memory>
 
 #include <libusb-1.0/libusb.h>
 
+#include "BulkTransferEngine.hpp"
+
 namespace Usb
 {
     /**
@@ -46,6 +49,16 @@ namespace Usb
             std::optional<std::chrono::milliseconds> timeout = std::nullopt
         );
 
+        /**
+         * Writes the given buffer to a bulk endpoint.
+         *
+         * Buffers that span more than a single packet are written via the asynchronous BulkTransferEngine, which
+         * keeps multiple transfers in flight. Single packet writes are performed synchronously.
+         *
+         * @param endpointAddress
+         * @param buffer
+         * @param maxPacketSize
+         */
         void writeBulk(
             std::uint8_t endpointAddress,
             std::span<const unsigned char> buffer,
@@ -55,5 +68,21 @@ namespace Usb
     private:
         ::libusb_device_handle* deviceHandle;
         bool claimed = false;
+
+        /**
+         * Constructed upon the first multi-packet write, and destroyed when the interface is released.
+         */
+        std::unique_ptr<BulkTransferEngine> bulkTransferEngine = nullptr;
+
+        std::vector<unsigned char> readBulkTransfers(
+            std::uint8_t endpointAddress,
+            std::optional<std::chrono::milliseconds> timeout
+        );
+
+        void writeBulkTransfers(
+            std::uint8_t endpointAddress,
+            std::span<const unsigned char> buffer,
+            std::uint16_t maxPacketSize
+        );
     };
 }
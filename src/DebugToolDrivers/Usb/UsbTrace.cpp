@@ -0,0 +1,302 @@
+#include "UsbTrace.hpp"
+
+#include <thread>
+#include <algorithm>
+
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/InvalidConfig.hpp"
+#include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
+#include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
+
+namespace Usb
+{
+    using namespace Exceptions;
+
+    using Services::StringService;
+
+    namespace
+    {
+        template <typename IntegerType>
+        void writeInteger(std::fstream& file, IntegerType value) {
+            auto bytes = std::array<char, sizeof(IntegerType)>{};
+            for (auto i = std::size_t{0}; i < sizeof(IntegerType); ++i) {
+                bytes[i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+            }
+
+            file.write(bytes.data(), bytes.size());
+        }
+
+        template <typename IntegerType>
+        IntegerType readInteger(std::fstream& file) {
+            auto bytes = std::array<unsigned char, sizeof(IntegerType)>{};
+            file.read(reinterpret_cast<char*>(bytes.data()), bytes.size());
+
+            auto value = IntegerType{0};
+            for (auto i = std::size_t{0}; i < sizeof(IntegerType); ++i) {
+                value |= static_cast<IntegerType>(bytes[i]) << (i * 8);
+            }
+
+            return value;
+        }
+    }
+
+    UsbTraceConfig::UsbTraceConfig(const YAML::Node& traceNode) {
+        if (!traceNode.IsMap()) {
+            throw InvalidConfig{"Invalid USB trace configuration - node must take the form of a YAML mapping."};
+        }
+
+        if (!traceNode["path"]) {
+            throw InvalidConfig{"No USB trace path found."};
+        }
+
+        this->path = traceNode["path"].as<std::string>();
+
+        if (traceNode["mode"]) {
+            const auto mode = StringService::asciiToLower(traceNode["mode"].as<std::string>());
+
+            if (mode == "record") {
+                this->mode = Mode::RECORD;
+
+            } else if (mode == "replay") {
+                this->mode = Mode::REPLAY;
+
+            } else {
+                throw InvalidConfig{"Invalid USB trace mode (\"" + mode + "\") - expected \"record\" or \"replay\""};
+            }
+        }
+
+        if (traceNode["replay_timing"]) {
+            const auto timing = StringService::asciiToLower(traceNode["replay_timing"].as<std::string>());
+
+            if (timing == "original") {
+                this->replayTiming = ReplayTiming::ORIGINAL;
+
+            } else if (timing == "fast") {
+                this->replayTiming = ReplayTiming::FAST;
+
+            } else {
+                throw InvalidConfig{
+                    "Invalid USB trace replay timing (\"" + timing + "\") - expected \"original\" or \"fast\""
+                };
+            }
+        }
+    }
+
+    void UsbTrace::start(const UsbTraceConfig& config) {
+        UsbTrace::activeTrace = std::make_unique<UsbTrace>(config);
+    }
+
+    void UsbTrace::stop() {
+        UsbTrace::activeTrace.reset();
+    }
+
+    void UsbTrace::write(
+        UsbTraceRecordType type,
+        std::uint8_t channel,
+        std::span<const unsigned char> data,
+        const std::function<void()>& writeFunction
+    ) {
+        ++UsbTrace::transfers;
+        auto* trace = UsbTrace::activeTrace.get();
+
+        if (trace == nullptr) {
+            writeFunction();
+            return;
+        }
+
+        if (trace->config.mode == UsbTraceConfig::Mode::RECORD) {
+            writeFunction();
+            trace->appendRecord(type, channel, data);
+            return;
+        }
+
+        const auto record = trace->nextRecord(type, channel);
+        if (!std::equal(record.payload.begin(), record.payload.end(), data.begin(), data.end())) {
+            throw DeviceCommunicationFailure{
+                "USB trace replay diverged at record " + std::to_string(trace->recordCount)
+                    + " - written data does not match the recorded data"
+            };
+        }
+    }
+
+    std::vector<unsigned char> UsbTrace::read(
+        UsbTraceRecordType type,
+        std::uint8_t channel,
+        const std::function<std::vector<unsigned char>()>& readFunction
+    ) {
+        if (type == UsbTraceRecordType::HID_READ || type == UsbTraceRecordType::BULK_READ) {
+            ++UsbTrace::transfers;
+        }
+
+        auto* trace = UsbTrace::activeTrace.get();
+
+        if (trace == nullptr) {
+            return readFunction();
+        }
+
+        if (trace->config.mode == UsbTraceConfig::Mode::RECORD) {
+            auto data = readFunction();
+            trace->appendRecord(type, channel, data);
+            return data;
+        }
+
+        return trace->nextRecord(type, channel).payload;
+    }
+
+    std::uint32_t UsbTrace::value(
+        UsbTraceRecordType type,
+        std::uint8_t channel,
+        const std::function<std::uint32_t()>& valueFunction
+    ) {
+        const auto data = UsbTrace::read(type, channel, [&valueFunction] {
+            const auto value = valueFunction();
+            return std::vector<unsigned char>{
+                static_cast<unsigned char>(value),
+                static_cast<unsigned char>(value >> 8),
+                static_cast<unsigned char>(value >> 16),
+                static_cast<unsigned char>(value >> 24),
+            };
+        });
+
+        if (data.size() != 4) {
+            throw DeviceCommunicationFailure{"Invalid USB trace value record"};
+        }
+
+        return static_cast<std::uint32_t>(data[0])
+            | static_cast<std::uint32_t>(data[1]) << 8
+            | static_cast<std::uint32_t>(data[2]) << 16
+            | static_cast<std::uint32_t>(data[3]) << 24;
+    }
+
+    UsbTrace::UsbTrace(const UsbTraceConfig& config)
+        : config(config)
+    {
+        if (this->config.mode == UsbTraceConfig::Mode::RECORD) {
+            this->file.open(this->config.path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+            if (!this->file.is_open()) {
+                throw DeviceInitializationFailure{"Failed to open USB trace file for writing: " + this->config.path};
+            }
+
+            this->file.write(UsbTrace::MAGIC.data(), UsbTrace::MAGIC.size());
+            Logger::info("Recording USB trace to " + this->config.path);
+
+        } else {
+            this->file.open(this->config.path, std::ios::in | std::ios::binary);
+
+            if (!this->file.is_open()) {
+                throw DeviceInitializationFailure{"Failed to open USB trace file for reading: " + this->config.path};
+            }
+
+            auto magic = std::array<char, 8>{};
+            this->file.read(magic.data(), magic.size());
+
+            if (!this->file || magic != UsbTrace::MAGIC) {
+                throw DeviceInitializationFailure{"Invalid USB trace file: " + this->config.path};
+            }
+
+            Logger::info("Replaying USB trace from " + this->config.path);
+        }
+
+        this->startTime = std::chrono::steady_clock::now();
+    }
+
+    UsbTrace::~UsbTrace() {
+        if (this->config.mode == UsbTraceConfig::Mode::RECORD) {
+            this->file.flush();
+            Logger::info("USB trace recorded - " + std::to_string(this->recordCount) + " records");
+            return;
+        }
+
+        Logger::info(
+            "USB trace replayed - " + std::to_string(this->recordCount) + " records in "
+                + std::to_string(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - this->startTime
+                    ).count()
+                ) + " ms"
+        );
+    }
+
+    void UsbTrace::appendRecord(
+        UsbTraceRecordType type,
+        std::uint8_t channel,
+        std::span<const unsigned char> payload
+    ) {
+        const auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - this->startTime
+        );
+
+        writeInteger(this->file, static_cast<std::uint8_t>(type));
+        writeInteger(this->file, channel);
+        writeInteger(this->file, static_cast<std::uint64_t>(timestamp.count()));
+        writeInteger(this->file, static_cast<std::uint32_t>(payload.size()));
+        this->file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+
+        if (!this->file) {
+            throw DeviceCommunicationFailure{"Failed to write to USB trace file"};
+        }
+
+        ++(this->recordCount);
+    }
+
+    UsbTrace::Record UsbTrace::nextRecord(UsbTraceRecordType expectedType, std::uint8_t expectedChannel) {
+        const auto type = static_cast<UsbTraceRecordType>(readInteger<std::uint8_t>(this->file));
+        const auto channel = readInteger<std::uint8_t>(this->file);
+        const auto timestamp = std::chrono::microseconds{readInteger<std::uint64_t>(this->file)};
+        const auto payloadSize = readInteger<std::uint32_t>(this->file);
+
+        if (!this->file) {
+            throw DeviceCommunicationFailure{
+                "USB trace replay ended prematurely after " + std::to_string(this->recordCount) + " records"
+            };
+        }
+
+        if (payloadSize > UsbTrace::MAX_PAYLOAD_SIZE) {
+            throw DeviceCommunicationFailure{
+                "Invalid USB trace record " + std::to_string(this->recordCount + 1) + " - payload size ("
+                    + std::to_string(payloadSize) + " bytes) exceeds maximum ("
+                    + std::to_string(UsbTrace::MAX_PAYLOAD_SIZE) + " bytes)"
+            };
+        }
+
+        auto record = Record{
+            .type = type,
+            .channel = channel,
+            .timestamp = timestamp,
+            .payload = std::vector<unsigned char>(payloadSize, 0x00),
+        };
+
+        this->file.read(
+            reinterpret_cast<char*>(record.payload.data()),
+            static_cast<std::streamsize>(record.payload.size())
+        );
+
+        if (!this->file || this->file.gcount() != static_cast<std::streamsize>(record.payload.size())) {
+            throw DeviceCommunicationFailure{
+                "Truncated USB trace record " + std::to_string(this->recordCount + 1) + " - expected "
+                    + std::to_string(record.payload.size()) + " byte payload"
+            };
+        }
+
+        ++(this->recordCount);
+
+        if (record.type != expectedType || record.channel != expectedChannel) {
+            throw DeviceCommunicationFailure{
+                "USB trace replay diverged at record " + std::to_string(this->recordCount) + " - expected record "
+                    "type 0x" + StringService::toHex(static_cast<std::uint8_t>(expectedType)) + " (channel 0x"
+                    + StringService::toHex(expectedChannel) + "), found type 0x"
+                    + StringService::toHex(static_cast<std::uint8_t>(record.type)) + " (channel 0x"
+                    + StringService::toHex(record.channel) + ")"
+            };
+        }
+
+        if (this->config.replayTiming == UsbTraceConfig::ReplayTiming::ORIGINAL) {
+            std::this_thread::sleep_until(this->startTime + record.timestamp);
+        }
+
+        return record;
+    }
+}
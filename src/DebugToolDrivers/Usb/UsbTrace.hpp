@@ -0,0 +1,190 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <span>
+#include <memory>
+#include <array>
+#include <fstream>
+#include <chrono>
+#include <functional>
+#include <yaml-cpp/yaml.h>
+
+namespace Usb
+{
+    enum class UsbTraceRecordType: std::uint8_t
+    {
+        HID_WRITE = 0x01,
+        HID_READ = 0x02,
+        BULK_WRITE = 0x03,
+        BULK_READ = 0x04,
+        DEVICE_COUNT = 0x10,
+        DEVICE_PRESENT = 0x11,
+        SERIAL_NUMBER = 0x12,
+        ENDPOINT_ADDRESS = 0x13,
+        ENDPOINT_MAX_PACKET_SIZE = 0x14,
+    };
+
+    /**
+     * USB trace configuration, extracted from the "usb_trace" node in the debug tool configuration:
+     *
+     *   tool:
+     *     name: atmel_ice
+     *     usb_trace:
+     *       mode: record          # or "replay"
+     *       path: ./session.trace
+     *       replay_timing: fast   # or "original"
+     */
+    struct UsbTraceConfig
+    {
+        enum class Mode: std::uint8_t
+        {
+            RECORD,
+            REPLAY,
+        };
+
+        enum class ReplayTiming: std::uint8_t
+        {
+            /**
+             * Responses are returned at the same points in time (relative to the start of the session) as they
+             * were received during recording.
+             */
+            ORIGINAL,
+
+            /**
+             * Responses are returned immediately.
+             *
+             * Replays with this timing are only deterministic when the recorded operations don't depend on the
+             * passage of time. Operations that poll until a timeout (e.g. the AVR8 post-reset settle poll, or any
+             * AdaptivePoller that timed out during recording) will issue more polls than were recorded, as each
+             * poll completes sooner, and the replay will diverge from the trace. Use ORIGINAL timing for such
+             * sessions.
+             */
+            FAST,
+        };
+
+        Mode mode = Mode::RECORD;
+        std::string path;
+        ReplayTiming replayTiming = ReplayTiming::FAST;
+
+        explicit UsbTraceConfig(const YAML::Node& traceNode);
+    };
+
+    /**
+     * Records USB transport activity to a binary trace file, or replays a previously recorded trace in place of a
+     * physical debug tool.
+     *
+     * The HidInterface, UsbInterface and UsbDevice classes route all device I/O through the static member functions
+     * of this class. When no trace is active, the I/O functions are invoked directly. When recording, the I/O
+     * functions are invoked and their results are appended to the trace. When replaying, the I/O functions are
+     * never invoked - writes are checked against the trace and reads are served from it. This allows the
+     * EDBG, CMSIS-DAP and WCH-Link drivers to run on a machine with no debug tool connected.
+     *
+     * A replay is only valid for the exact sequence of operations that was recorded. Any divergence (a write with
+     * different data, or a different operation altogether) results in a DeviceCommunicationFailure.
+     *
+     * The active trace is thread-local. All of a debug tool's I/O takes place on the thread of the TargetController
+     * that owns it, so each TargetController instance can record or replay its own trace.
+     *
+     * Trace format (all integers are little-endian):
+     *  - 8 byte magic ("BLUSBTR1")
+     *  - Records, each consisting of:
+     *    - Record type (1 byte, see UsbTraceRecordType)
+     *    - Channel (1 byte - interface number or endpoint address, 0 for device-level records)
+     *    - Time since start of recording, in microseconds (8 bytes)
+     *    - Payload size (4 bytes, at most MAX_PAYLOAD_SIZE)
+     *    - Payload
+     */
+    class UsbTrace
+    {
+    public:
+        static void start(const UsbTraceConfig& config);
+        static void stop();
+
+        static bool active() {
+            return UsbTrace::activeTrace != nullptr;
+        }
+
+        static bool replaying() {
+            return UsbTrace::activeTrace != nullptr
+                && UsbTrace::activeTrace->config.mode == UsbTraceConfig::Mode::REPLAY;
+        }
+
+        static void write(
+            UsbTraceRecordType type,
+            std::uint8_t channel,
+            std::span<const unsigned char> data,
+            const std::function<void()>& writeFunction
+        );
+
+        static std::vector<unsigned char> read(
+            UsbTraceRecordType type,
+            std::uint8_t channel,
+            const std::function<std::vector<unsigned char>()>& readFunction
+        );
+
+        static std::uint32_t value(
+            UsbTraceRecordType type,
+            std::uint8_t channel,
+            const std::function<std::uint32_t()>& valueFunction
+        );
+
+        /**
+         * The number of HID and bulk transfers (reads and writes) performed on the calling thread, whether or not
+         * a trace is active. Replayed transfers are included.
+         *
+         * Callers measure the transfers for an operation by taking the difference between two readings.
+         */
+        static std::uint64_t transferCount() {
+            return UsbTrace::transfers;
+        }
+
+        explicit UsbTrace(const UsbTraceConfig& config);
+        ~UsbTrace();
+
+        UsbTrace(const UsbTrace& other) = delete;
+        UsbTrace& operator = (const UsbTrace& other) = delete;
+
+        UsbTrace(UsbTrace&& other) = delete;
+        UsbTrace& operator = (UsbTrace&& other) = delete;
+
+        /**
+         * The largest payload we accept from a trace. This is far beyond the size of any USB transfer issued by
+         * Bloom - it guards against allocating absurd buffers upon reading a corrupt trace.
+         */
+        static constexpr std::uint32_t MAX_PAYLOAD_SIZE = 1024 * 1024;
+
+    private:
+        static constexpr auto MAGIC = std::array<char, 8>{'B', 'L', 'U', 'S', 'B', 'T', 'R', '1'};
+
+        static thread_local inline std::unique_ptr<UsbTrace> activeTrace = nullptr;
+        static thread_local inline std::uint64_t transfers = 0;
+
+        struct Record
+        {
+            UsbTraceRecordType type;
+            std::uint8_t channel;
+            std::chrono::microseconds timestamp;
+            std::vector<unsigned char> payload;
+        };
+
+        UsbTraceConfig config;
+        std::fstream file;
+        std::chrono::steady_clock::time_point startTime;
+        std::size_t recordCount = 0;
+
+        void appendRecord(UsbTraceRecordType type, std::uint8_t channel, std::span<const unsigned char> payload);
+
+        /**
+         * Reads the next record from the trace, checking that it's of the expected type and channel.
+         *
+         * Truncated records, and records with a payload size exceeding MAX_PAYLOAD_SIZE, are rejected with a
+         * DeviceCommunicationFailure.
+         *
+         * If the replay timing is ReplayTiming::ORIGINAL, this function will block until the record's timestamp
+         * has been reached.
+         */
+        Record nextRecord(UsbTraceRecordType expectedType, std::uint8_t expectedChannel);
+    };
+}
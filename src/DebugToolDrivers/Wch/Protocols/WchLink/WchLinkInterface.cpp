@@ -1,7 +1,7 @@
 #include "WchLinkInterface.hpp"
 
 #include <cassert>
-#include <thread>
+#include <algorithm>
 
 #include "Commands/Control/GetDeviceInfo.hpp"
 #include "Commands/Control/AttachTarget.hpp"
@@ -22,6 +22,7 @@
 #include "src/Services/StringService.hpp"
 
 #include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/Exceptions/DmiBatchInterrupted.hpp"
 
 namespace DebugToolDrivers::Wch::Protocols::WchLink
 {
@@ -30,10 +31,15 @@ namespace DebugToolDrivers::Wch::Protocols::WchLink
 
     using DebugModule::DmiOperation;
 
-    WchLinkInterface::WchLinkInterface(Usb::UsbInterface& usbInterface, Usb::UsbDevice& usbDevice)
+    WchLinkInterface::WchLinkInterface(
+        Usb::UsbInterface& usbInterface,
+        Usb::UsbDevice& usbDevice,
+        std::uint8_t dmiPipelineDepth
+    )
         : usbInterface(usbInterface)
         , commandEndpointMaxPacketSize(usbDevice.getEndpointMaxPacketSize(WchLinkInterface::USB_COMMAND_ENDPOINT_OUT))
         , dataEndpointMaxPacketSize(usbDevice.getEndpointMaxPacketSize(WchLinkInterface::USB_DATA_ENDPOINT_OUT))
+        , dmiPipelineDepth(std::max(dmiPipelineDepth, std::uint8_t{1}))
     {}
 
     DeviceInfo WchLinkInterface::getDeviceInfo() {
@@ -78,29 +84,31 @@ namespace DebugToolDrivers::Wch::Protocols::WchLink
     DebugModule::RegisterValue WchLinkInterface::readDebugModuleRegister(DebugModule::RegisterAddress address) {
         using DebugModule::DmiOperationStatus;
 
-        auto attempt = std::uint8_t{0};
-        while (attempt < WchLinkInterface::DMI_OP_MAX_RETRY) {
-            if (attempt > 0) {
-                std::this_thread::sleep_for(this->dmiOpRetryDelay);
-            }
+        auto value = DebugModule::RegisterValue{0};
 
-            const auto response = this->sendCommandAndWaitForResponse(
-                Commands::DebugModuleInterfaceOperation{DmiOperation::READ, address}
-            );
+        const auto completed = this->dmiOpPoller.poll(
+            [this, address, &value] {
+                const auto response = this->sendCommandAndWaitForResponse(
+                    Commands::DebugModuleInterfaceOperation{DmiOperation::READ, address}
+                );
 
-            if (response.operationStatus == DmiOperationStatus::SUCCESS) {
-                return response.value;
-            }
+                if (response.operationStatus == DmiOperationStatus::FAILED) {
+                    throw Exceptions::DeviceCommunicationFailure{"DMI operation failed"};
+                }
 
-            if (response.operationStatus == DmiOperationStatus::FAILED) {
-                throw Exceptions::DeviceCommunicationFailure{"DMI operation failed"};
-            }
+                value = response.value;
 
-            // Busy response...
-            ++attempt;
+                // Busy response if not successful...
+                return response.operationStatus == DmiOperationStatus::SUCCESS;
+            },
+            std::chrono::microseconds{0}
+        );
+
+        if (!completed) {
+            throw Exceptions::DeviceCommunicationFailure{"DMI operation timed out"};
         }
 
-        throw Exceptions::DeviceCommunicationFailure{"DMI operation timed out"};
+        return value;
     }
 
     void WchLinkInterface::writeDebugModuleRegister(
@@ -109,29 +117,95 @@ namespace DebugToolDrivers::Wch::Protocols::WchLink
     ) {
         using DebugModule::DmiOperationStatus;
 
-        auto attempt = std::uint8_t{0};
-        while (attempt < WchLinkInterface::DMI_OP_MAX_RETRY) {
-            if (attempt > 0) {
-                std::this_thread::sleep_for(this->dmiOpRetryDelay);
+        const auto completed = this->dmiOpPoller.poll(
+            [this, address, value] {
+                const auto response = this->sendCommandAndWaitForResponse(
+                    Commands::DebugModuleInterfaceOperation{DmiOperation::WRITE, address, value}
+                );
+
+                if (response.operationStatus == DmiOperationStatus::FAILED) {
+                    throw Exceptions::DeviceCommunicationFailure{"DMI operation failed"};
+                }
+
+                // Busy response if not successful...
+                return response.operationStatus == DmiOperationStatus::SUCCESS;
+            },
+            std::chrono::microseconds{0}
+        );
+
+        if (!completed) {
+            throw Exceptions::DeviceCommunicationFailure{"DMI operation timed out"};
+        }
+    }
+
+    std::vector<DebugModule::RegisterValue> WchLinkInterface::executeDmiBatch(const DmiBatch& batch) {
+        using DebugModule::DmiOperationStatus;
+
+        if (this->dmiPipelineDepth == 1) {
+            return DebugTransportModuleInterface::executeDmiBatch(batch);
+        }
+
+        const auto& operations = batch.operations();
+
+        auto output = std::vector<DebugModule::RegisterValue>{};
+        output.reserve(batch.readCount());
+
+        auto index = std::size_t{0};
+        while (index < operations.size()) {
+            const auto count = std::min(operations.size() - index, static_cast<std::size_t>(this->dmiPipelineDepth));
+
+            auto commands = std::vector<Commands::DebugModuleInterfaceOperation>{};
+            commands.reserve(count);
+
+            for (auto i = index; i < index + count; ++i) {
+                const auto& operation = operations[i];
+                commands.emplace_back(operation.operation, operation.address, operation.value);
+                this->sendCommand(commands.back());
             }
 
-            const auto response = this->sendCommandAndWaitForResponse(
-                Commands::DebugModuleInterfaceOperation{DmiOperation::WRITE, address, value}
-            );
+            /*
+             * We must collect all responses, even after a busy or failed operation, otherwise they'll be mistaken for
+             * responses to subsequent commands.
+             */
+            auto failed = false;
+            auto busy = false;
+
+            for (auto i = std::size_t{0}; i < commands.size(); ++i) {
+                const auto response = this->waitForResponse(commands[i]);
 
-            if (response.operationStatus == DmiOperationStatus::SUCCESS) {
-                return;
+                if (response.operationStatus == DmiOperationStatus::FAILED) {
+                    failed = true;
+                    continue;
+                }
+
+                if (response.operationStatus == DmiOperationStatus::BUSY) {
+                    busy = true;
+                    continue;
+                }
+
+                if (operations[index + i].operation == DmiOperation::READ) {
+                    output.push_back(response.value);
+                }
             }
 
-            if (response.operationStatus == DmiOperationStatus::FAILED) {
+            if (failed) {
                 throw Exceptions::DeviceCommunicationFailure{"DMI operation failed"};
             }
 
-            // Busy response...
-            ++attempt;
+            if (busy) {
+                /*
+                 * The WCH-Link executes each queued operation independently - a busy operation doesn't prevent the
+                 * operations that follow it from being executed. Those operations will have been executed without
+                 * the effect of the busy operation, so their outcome is unknown, and we can't replay the busy
+                 * operation (or anything after it) without making matters worse.
+                 */
+                throw Exceptions::DmiBatchInterrupted{"DMI operation busy in pipelined batch"};
+            }
+
+            index += count;
         }
 
-        throw Exceptions::DeviceCommunicationFailure{"DMI operation timed out"};
+        return output;
     }
 
     void WchLinkInterface::writeFlashPartialBlock(
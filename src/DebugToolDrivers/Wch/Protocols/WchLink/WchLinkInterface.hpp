@@ -20,6 +20,7 @@
 #include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
 
 #include "src/Services/StringService.hpp"
+#include "src/Helpers/AdaptivePoller.hpp"
 
 namespace DebugToolDrivers::Wch::Protocols::WchLink
 {
@@ -32,7 +33,11 @@ namespace DebugToolDrivers::Wch::Protocols::WchLink
     public:
         static constexpr auto MAX_PARTIAL_BLOCK_WRITE_SIZE = Targets::TargetMemorySize{64};
 
-        WchLinkInterface(Usb::UsbInterface& usbInterface, Usb::UsbDevice& usbDevice);
+        WchLinkInterface(
+            Usb::UsbInterface& usbInterface,
+            Usb::UsbDevice& usbDevice,
+            std::uint8_t dmiPipelineDepth = 1
+        );
 
         DeviceInfo getDeviceInfo();
         void setClockSpeed(WchLinkTargetClockSpeed speed, WchTargetId targetId);
@@ -45,6 +50,25 @@ namespace DebugToolDrivers::Wch::Protocols::WchLink
             ::DebugToolDrivers::Protocols::RiscVDebug::DebugModule::RegisterValue value
         ) override;
 
+        /**
+         * Sends up to dmiPipelineDepth DMI operation commands before collecting their responses.
+         *
+         * Unlike a JTAG DTM, the WCH-Link has no sticky busy state - it executes each queued operation independently,
+         * so operations that follow a busy operation in the pipeline are still executed. The state of the debug
+         * module is unknown after a busy operation, so we don't retry anything. We throw a DmiBatchInterrupted
+         * exception instead, and leave recovery to the caller (see DebugTranslator::executeDmiBatch()).
+         *
+         * @param batch
+         *
+         * @return
+         *
+         * @throws DmiBatchInterrupted
+         *  If the WCH-Link reported a busy DMI operation.
+         */
+        std::vector<::DebugToolDrivers::Protocols::RiscVDebug::DebugModule::RegisterValue> executeDmiBatch(
+            const ::DebugToolDrivers::Protocols::RiscVDebug::DmiBatch& batch
+        ) override;
+
         void writeFlashPartialBlock(Targets::TargetMemoryAddress startAddress, Targets::TargetMemoryBufferSpan buffer);
         void writeFlashFullBlock(
             Targets::TargetMemoryAddress startAddress,
@@ -56,7 +80,42 @@ namespace DebugToolDrivers::Wch::Protocols::WchLink
 
         template <class CommandType>
         auto sendCommandAndWaitForResponse(const CommandType& command) {
-            using Services::StringService;
+            this->sendCommand(command);
+            return this->waitForResponse(command);
+        }
+
+    private:
+        static constexpr std::uint8_t USB_COMMAND_ENDPOINT_IN = 0x81;
+        static constexpr std::uint8_t USB_COMMAND_ENDPOINT_OUT = 0x01;
+        static constexpr std::uint8_t USB_DATA_ENDPOINT_IN = 0x82;
+        static constexpr std::uint8_t USB_DATA_ENDPOINT_OUT = 0x02;
+        static constexpr std::uint8_t DMI_OP_MAX_RETRY = 10;
+
+        Usb::UsbInterface& usbInterface;
+
+        std::uint16_t commandEndpointMaxPacketSize = 0;
+        std::uint16_t dataEndpointMaxPacketSize = 0;
+
+        /**
+         * The maximum number of DMI operation commands we send to the WCH-Link before reading any responses. See
+         * WchLinkToolConfig::dmiPipelineDepth.
+         */
+        std::uint8_t dmiPipelineDepth = 1;
+
+        /**
+         * DMI operations are retried upon a busy response, up to DMI_OP_MAX_RETRY times in total.
+         */
+        AdaptivePoller dmiOpPoller = AdaptivePoller{
+            "DMI operation",
+            {
+                .minimumDelay = std::chrono::microseconds{10},
+                .maximumDelay = std::chrono::milliseconds{1},
+                .minimumChecks = WchLinkInterface::DMI_OP_MAX_RETRY,
+            }
+        };
+
+        template <class CommandType>
+        void sendCommand(const CommandType& command) {
             const auto rawCommand = command.getRawCommand();
 
             /*
@@ -74,6 +133,11 @@ namespace DebugToolDrivers::Wch::Protocols::WchLink
                 rawCommand,
                 this->commandEndpointMaxPacketSize
             );
+        }
+
+        template <class CommandType>
+        auto waitForResponse(const CommandType& command) {
+            using Services::StringService;
 
             const auto rawResponse = this->usbInterface.readBulk(WchLinkInterface::USB_COMMAND_ENDPOINT_IN);
 
@@ -107,19 +171,5 @@ namespace DebugToolDrivers::Wch::Protocols::WchLink
                 std::vector<unsigned char>{rawResponse.begin() + 3, rawResponse.end()}
             };
         }
-
-    private:
-        static constexpr std::uint8_t USB_COMMAND_ENDPOINT_IN = 0x81;
-        static constexpr std::uint8_t USB_COMMAND_ENDPOINT_OUT = 0x01;
-        static constexpr std::uint8_t USB_DATA_ENDPOINT_IN = 0x82;
-        static constexpr std::uint8_t USB_DATA_ENDPOINT_OUT = 0x02;
-        static constexpr std::uint8_t DMI_OP_MAX_RETRY = 10;
-
-        Usb::UsbInterface& usbInterface;
-
-        std::uint16_t commandEndpointMaxPacketSize = 0;
-        std::uint16_t dataEndpointMaxPacketSize = 0;
-        // TODO: Move this into a config param
-        std::chrono::microseconds dmiOpRetryDelay = std::chrono::microseconds{10};
     };
 }
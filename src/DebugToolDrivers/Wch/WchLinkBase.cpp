@@ -22,7 +22,7 @@ namespace DebugToolDrivers::Wch
         std::uint16_t iapProductId,
         std::uint8_t wchLinkUsbInterfaceNumber
     )
-        : UsbDevice(vendorId, productId)
+        : UsbDevice(vendorId, productId, toolConfig.serialNumber)
         , toolConfig(WchLinkToolConfig{toolConfig})
         , iapVendorId(iapVendorId)
         , iapProductId(iapProductId)
@@ -60,7 +60,8 @@ namespace DebugToolDrivers::Wch
 
         this->wchLinkInterface = std::make_unique<Protocols::WchLink::WchLinkInterface>(
             *(this->wchLinkUsbInterface),
-            *this
+            *this,
+            this->toolConfig.dmiPipelineDepth
         );
 
         if (this->getDeviceInfo().variant != this->variant) {
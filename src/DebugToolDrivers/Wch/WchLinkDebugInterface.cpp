@@ -305,6 +305,19 @@ namespace DebugToolDrivers::Wch
         throw TargetOperationFailure{"Not supported"};
     }
 
+    TargetMemorySize WchLinkDebugInterface::maximumMemoryReadSize(
+        const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+    ) {
+        // All memory reads go through the RISC-V debug translator, including flash reads
+        return this->riscVTranslator.maximumMemoryReadSize();
+    }
+
+    bool WchLinkDebugInterface::canReadMemoryWhileRunning(
+        const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+    ) {
+        return this->riscVTranslator.canReadMemoryWhileRunning();
+    }
+
     void WchLinkDebugInterface::enableProgrammingMode() {
         // TODO: Move this to target driver. After v2.0.0.
         this->clearAllBreakpoints();
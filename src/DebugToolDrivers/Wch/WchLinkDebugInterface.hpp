@@ -76,6 +76,10 @@ namespace DebugToolDrivers::Wch
             const Targets::TargetAddressSpaceDescriptor& addressSpaceDescriptor,
             const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor
         ) override;
+        Targets::TargetMemorySize maximumMemoryReadSize(
+            const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        ) override;
+        bool canReadMemoryWhileRunning(const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor) override;
 
         void enableProgrammingMode() override;
         void disableProgrammingMode() override;
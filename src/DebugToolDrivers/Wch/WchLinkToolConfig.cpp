@@ -1,5 +1,7 @@
 #include "WchLinkToolConfig.hpp"
 
+#include <algorithm>
+
 namespace DebugToolDrivers::Wch
 {
     WchLinkToolConfig::WchLinkToolConfig(const DebugToolConfig& toolConfig)
@@ -11,6 +13,12 @@ namespace DebugToolDrivers::Wch
             this->exitIapMode = toolNode["exit_iap_mode"].as<bool>(this->exitIapMode);
         }
 
+        if (toolNode["dmi_pipeline_depth"]) {
+            this->dmiPipelineDepth = static_cast<std::uint8_t>(
+                std::clamp(toolNode["dmi_pipeline_depth"].as<int>(this->dmiPipelineDepth), 1, 32)
+            );
+        }
+
         if (toolNode["riscv_debug_translator"]) {
             this->riscVDebugTranslatorConfig = ::DebugToolDrivers::Protocols::RiscVDebug::DebugTranslatorConfig{
                 toolNode["riscv_debug_translator"]
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <yaml-cpp/yaml.h>
 
 #include "src/ProjectConfig.hpp"
@@ -13,6 +14,17 @@ namespace DebugToolDrivers::Wch
     struct WchLinkToolConfig: public DebugToolConfig
     {
         bool exitIapMode = true;
+
+        /**
+         * The number of DMI operation commands to send to the WCH-Link before reading their responses, when
+         * executing a batch of DMI operations ("dmi_pipeline_depth" tool config parameter, 1 - 32).
+         *
+         * Defaults to 1 (no pipelining), as we've not confirmed that all WCH-Link firmware versions queue commands
+         * on the command endpoint. With the default, every DMI operation in a batch costs a full USB round trip, so
+         * the WCH-Link gains nothing from the DebugTranslator's DMI batching until this is raised.
+         */
+        std::uint8_t dmiPipelineDepth = 1;
+
         ::DebugToolDrivers::Protocols::RiscVDebug::DebugTranslatorConfig riscVDebugTranslatorConfig = {};
 
         explicit WchLinkToolConfig(const DebugToolConfig& toolConfig);
@@ -85,6 +85,28 @@ public:
      */
     void registerEvent(Events::SharedGenericEventPointer event);
 
+    /**
+     * Restricts the listener to events from the given environment (and application-wide events).
+     *
+     * This must be called before the listener is registered with the EventManager.
+     *
+     * @param environmentName
+     */
+    void setEnvironmentName(const std::string& environmentName) {
+        this->environmentName = environmentName;
+    }
+
+    /**
+     * Checks if the given event should be delivered to this listener, based on the event's environment.
+     *
+     * @param event
+     *
+     * @return
+     */
+    [[nodiscard]] bool isEventRelevant(const Events::Event& event) const {
+        return !this->environmentName.has_value() || event.relatesToEnvironment(*(this->environmentName));
+    }
+
     void setInterruptEventNotifier(NotifierInterface* interruptEventNotifier) {
         this->interruptEventNotifier = interruptEventNotifier;
     }
@@ -350,6 +372,11 @@ private:
 
     NotifierInterface* interruptEventNotifier = nullptr;
 
+    /**
+     * If set, only events from this environment (and application-wide events) will be delivered to the listener.
+     */
+    std::optional<std::string> environmentName = std::nullopt;
+
     std::vector<Events::SharedGenericEventPointer> getEvents();
 };
 
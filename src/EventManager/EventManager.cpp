@@ -14,7 +14,7 @@ void EventManager::triggerEvent(const std::shared_ptr<const Events::Event>& even
     auto registerListenersLock = std::unique_lock{EventManager::registerListenerMutex};
 
     for (const auto&[listenerId, listener] : EventManager::registeredListeners) {
-        if (listener->isEventTypeRegistered(event->getType())) {
+        if (listener->isEventTypeRegistered(event->getType()) && listener->isEventRelevant(*event)) {
             listener->registerEvent(event);
         }
     }
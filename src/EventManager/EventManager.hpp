@@ -36,6 +36,9 @@ public:
      * Dispatches an event to all registered listeners, if they have registered an interest in the event type.
      * See EventListener::registeredEventTypes for more.
      *
+     * Events that originated from a specific environment are only dispatched to listeners for that environment, and
+     * to listeners that aren't bound to an environment. See EventListener::setEnvironmentName().
+     *
      * @param event
      */
     static void triggerEvent(const Events::SharedGenericEventPointer& event);
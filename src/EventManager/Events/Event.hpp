@@ -39,6 +39,14 @@ namespace Events
         int id = ++(Event::lastEventId);
         QDateTime createdTimestamp = Services::DateTimeService::currentDateTime();
 
+        /**
+         * The name of the environment from which the event originated, or std::nullopt for application-wide events.
+         *
+         * Events are stamped with the environment of the thread that triggered them. The TargetController and
+         * DebugServer threads each serve a single environment. See Event::setThreadEnvironmentName().
+         */
+        std::optional<std::string> environmentName = Event::threadEnvironmentName;
+
         static constexpr EventType type = EventType::GENERIC;
         static const inline std::string name = "GenericEvent";
 
@@ -59,7 +67,28 @@ namespace Events
             return Event::type;
         }
 
+        /**
+         * Checks if the event relates to the given environment. Application-wide events relate to all environments.
+         *
+         * @param environmentName
+         *
+         * @return
+         */
+        [[nodiscard]] bool relatesToEnvironment(const std::string& environmentName) const {
+            return !this->environmentName.has_value() || *(this->environmentName) == environmentName;
+        }
+
+        /**
+         * Sets the environment with which all events triggered from the calling thread will be stamped.
+         *
+         * @param environmentName
+         */
+        static void setThreadEnvironmentName(const std::string& environmentName) {
+            Event::threadEnvironmentName = environmentName;
+        }
+
     private:
         static inline std::atomic<int> lastEventId = 0;
+        static thread_local inline std::optional<std::string> threadEnvironmentName = std::nullopt;
     };
 }
@@ -0,0 +1,68 @@
+#include "AdaptivePoller.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+void LatencyHistogram::record(std::chrono::microseconds latency) {
+    const auto microseconds = static_cast<std::uint64_t>(std::max(latency.count(), std::int64_t{0}));
+    const auto bucketIndex = std::min(
+        static_cast<std::size_t>(std::bit_width(microseconds)),
+        LatencyHistogram::BUCKET_COUNT - 1
+    );
+
+    ++(this->buckets[bucketIndex]);
+    ++(this->sampleCount);
+    this->maximumLatency = std::max(this->maximumLatency, latency);
+}
+
+std::chrono::microseconds LatencyHistogram::percentile(double percentile) const {
+    if (this->sampleCount == 0) {
+        return std::chrono::microseconds{0};
+    }
+
+    const auto threshold = static_cast<std::uint64_t>(
+        std::max(static_cast<double>(this->sampleCount) * std::clamp(percentile, 0.0, 100.0) / 100, 1.0)
+    );
+
+    auto cumulativeCount = std::uint64_t{0};
+    for (auto bucketIndex = std::size_t{0}; bucketIndex < LatencyHistogram::BUCKET_COUNT; ++bucketIndex) {
+        cumulativeCount += this->buckets[bucketIndex];
+
+        if (cumulativeCount >= threshold) {
+            return std::min(
+                std::chrono::microseconds{std::int64_t{1} << bucketIndex},
+                this->maximumLatency
+            );
+        }
+    }
+
+    return this->maximumLatency;
+}
+
+std::string LatencyHistogram::toString() const {
+    return "samples: " + std::to_string(this->sampleCount)
+        + ", p50: " + std::to_string(this->percentile(50).count()) + "us"
+        + ", p90: " + std::to_string(this->percentile(90).count()) + "us"
+        + ", p99: " + std::to_string(this->percentile(99).count()) + "us"
+        + ", max: " + std::to_string(this->maximumLatency.count()) + "us"
+        + ", timeouts: " + std::to_string(this->timeoutCount);
+}
+
+AdaptivePoller::AdaptivePoller(std::string name, Config config)
+    : name(std::move(name))
+    , config(config)
+{}
+
+std::chrono::microseconds AdaptivePoller::initialDelay() const {
+    return std::clamp(this->averageLatency / 4, this->config.minimumDelay, this->config.maximumDelay);
+}
+
+void AdaptivePoller::recordLatency(std::chrono::microseconds latency) {
+    this->histogram.record(latency);
+
+    // Weight of 1/8 for the latest sample
+    this->averageLatency = this->histogram.count() == 1
+        ? latency
+        : this->averageLatency + (latency - this->averageLatency) / 8;
+}
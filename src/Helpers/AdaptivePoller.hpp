@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <concepts>
+#include <algorithm>
+
+/**
+ * Records latencies in power-of-two microsecond buckets.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr std::size_t BUCKET_COUNT = 32;
+
+    void record(std::chrono::microseconds latency);
+
+    /**
+     * Records an operation that didn't complete within its time limit.
+     */
+    void recordTimeout() {
+        ++(this->timeoutCount);
+    }
+
+    [[nodiscard]] std::uint64_t count() const {
+        return this->sampleCount;
+    }
+
+    [[nodiscard]] std::uint64_t timeouts() const {
+        return this->timeoutCount;
+    }
+
+    [[nodiscard]] std::chrono::microseconds maximum() const {
+        return this->maximumLatency;
+    }
+
+    /**
+     * Returns an upper bound for the given percentile, in the form of the upper bound of the bucket in which the
+     * percentile falls.
+     *
+     * @param percentile
+     *  A value between 0 and 100.
+     *
+     * @return
+     */
+    [[nodiscard]] std::chrono::microseconds percentile(double percentile) const;
+
+    [[nodiscard]] std::string toString() const;
+
+private:
+    /**
+     * Bucket i holds latencies in the range [2^(i-1), 2^i) microseconds, with bucket 0 holding latencies under
+     * 1 microsecond. The final bucket holds everything beyond.
+     */
+    std::array<std::uint64_t, BUCKET_COUNT> buckets = {};
+    std::uint64_t sampleCount = 0;
+    std::uint64_t timeoutCount = 0;
+    std::chrono::microseconds maximumLatency = std::chrono::microseconds{0};
+};
+
+/**
+ * Polls a condition until it's satisfied, with adaptive backoff between checks.
+ *
+ * The condition is checked immediately, without any delay. If it isn't satisfied, we back off for an initial delay
+ * that is derived from the latencies observed in previous polls (a quarter of the running average), doubling the
+ * delay upon each subsequent unsuccessful check, up to the maximum delay. This allows fast operations to complete
+ * with minimal overhead, whilst slow operations don't flood the debug tool with status checks.
+ *
+ * Each poller records the time taken for the condition to be satisfied, in a LatencyHistogram. A poller should be
+ * dedicated to a single kind of operation (e.g. halting a target), as the observed latencies drive the backoff.
+ */
+class AdaptivePoller
+{
+public:
+    struct Config
+    {
+        std::chrono::microseconds minimumDelay = std::chrono::microseconds{10};
+        std::chrono::microseconds maximumDelay = std::chrono::milliseconds{5};
+
+        /**
+         * The minimum number of checks to perform before giving up, regardless of the timeout.
+         *
+         * Each check usually involves a round trip to the debug tool, which can take longer than the timeout
+         * itself.
+         */
+        std::uint32_t minimumChecks = 1;
+    };
+
+    std::string name;
+
+    explicit AdaptivePoller(std::string name, Config config);
+
+    /**
+     * Checks the given condition until it's satisfied, or until the timeout has elapsed and the minimum number of
+     * checks have been performed.
+     *
+     * @param condition
+     *  Callable returning true once the condition has been satisfied.
+     *
+     * @param timeout
+     *
+     * @return
+     *  True if the condition was satisfied, false if we gave up.
+     */
+    template <std::predicate ConditionType>
+    bool poll(ConditionType&& condition, std::chrono::microseconds timeout) {
+        using std::chrono::steady_clock;
+
+        const auto startTime = steady_clock::now();
+        const auto deadline = startTime + timeout;
+
+        auto delay = this->initialDelay();
+        auto checks = std::uint32_t{0};
+
+        while (true) {
+            ++checks;
+
+            if (condition()) {
+                this->recordLatency(
+                    std::chrono::duration_cast<std::chrono::microseconds>(steady_clock::now() - startTime)
+                );
+                return true;
+            }
+
+            const auto now = steady_clock::now();
+            if (now >= deadline && checks >= this->config.minimumChecks) {
+                this->histogram.recordTimeout();
+                return false;
+            }
+
+            std::this_thread::sleep_for(
+                now < deadline
+                    ? std::min(delay, std::chrono::duration_cast<std::chrono::microseconds>(deadline - now))
+                    : delay
+            );
+
+            delay = std::min(delay * 2, this->config.maximumDelay);
+        }
+    }
+
+    [[nodiscard]] const LatencyHistogram& getHistogram() const {
+        return this->histogram;
+    }
+
+private:
+    Config config;
+    LatencyHistogram histogram;
+
+    /**
+     * Exponentially weighted moving average of the latencies observed by this poller.
+     */
+    std::chrono::microseconds averageLatency = std::chrono::microseconds{0};
+
+    [[nodiscard]] std::chrono::microseconds initialDelay() const;
+    void recordLatency(std::chrono::microseconds latency);
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+/**
+ * Lock-free, unbounded, multi-producer single-consumer queue.
+ *
+ * This is an implementation of Dmitry Vyukov's non-intrusive MPSC node-based queue. Producers never block each other
+ * or the consumer - a push is a single atomic exchange.
+ *
+ * MpscQueue::push() can be called from any thread. MpscQueue::tryPop() must only ever be called from a single
+ * (consumer) thread.
+ *
+ * NOTE: A push is not visible to the consumer until the producer has linked the new node, which happens immediately
+ * after the exchange. If the consumer attempts a pop in between the two, it will see an empty queue. Producers are
+ * expected to notify the consumer after pushing, so the consumer will always get another chance to pop the value.
+ *
+ * @tparam Type
+ */
+template<typename Type>
+class MpscQueue
+{
+public:
+    MpscQueue()
+        : head(new Node{})
+        , tail(this->head.load())
+    {}
+
+    ~MpscQueue() {
+        while (this->tryPop().has_value()) {}
+        delete this->tail;
+    }
+
+    MpscQueue(const MpscQueue& other) = delete;
+    MpscQueue(MpscQueue&& other) = delete;
+
+    MpscQueue& operator = (const MpscQueue& other) = delete;
+    MpscQueue& operator = (MpscQueue&& other) = delete;
+
+    void push(Type value) {
+        auto* node = new Node{std::move(value)};
+        auto* previousNode = this->head.exchange(node, std::memory_order::acq_rel);
+        previousNode->next.store(node, std::memory_order::release);
+    }
+
+    std::optional<Type> tryPop() {
+        auto* next = this->tail->next.load(std::memory_order::acquire);
+
+        if (next == nullptr) {
+            return std::nullopt;
+        }
+
+        /*
+         * The next node becomes the new stub node. We move its value out and delete the current stub.
+         */
+        auto value = std::move(next->value);
+        next->value.reset();
+
+        delete this->tail;
+        this->tail = next;
+
+        return value;
+    }
+
+private:
+    struct Node
+    {
+        std::optional<Type> value = std::nullopt;
+        std::atomic<Node*> next = nullptr;
+    };
+
+    std::atomic<Node*> head;
+
+    /**
+     * Only accessed by the consumer.
+     */
+    Node* tail;
+};
@@ -16,6 +16,7 @@ using Targets::TargetExecutionState;
 
 Insight::Insight(
     EventListener& eventListener,
+    TargetController::TargetControllerComponent& targetController,
     const ProjectConfig& projectConfig,
     const EnvironmentConfig& environmentConfig,
     const InsightConfig& insightConfig,
@@ -28,6 +29,7 @@ Insight::Insight(
     , environmentConfig(environmentConfig)
     , insightConfig(insightConfig)
     , insightProjectSettings(insightProjectSettings)
+    , targetControllerService(targetController)
     , targetDescriptor(this->targetControllerService.getTargetDescriptor())
     , targetState(this->targetControllerService.getTargetState())
 {
@@ -115,7 +117,7 @@ Insight::Insight(
 
     // Construct and start worker threads
     for (auto i = std::uint8_t{0}; i < Insight::INSIGHT_WORKER_COUNT; ++i) {
-        auto* insightWorker = new InsightWorker{};
+        auto* insightWorker = new InsightWorker{this->targetControllerService};
         auto* workerThread = new QThread{};
 
         workerThread->setObjectName("IW" + QString::number(insightWorker->id));
@@ -176,6 +178,10 @@ void Insight::onInsightWindowDestroyed() {
 }
 
 void Insight::onTargetStateChangedEvent(const Events::TargetStateChanged& event) {
+    if (!event.relatesToEnvironment(this->environmentConfig.name)) {
+        return;
+    }
+
     if (event.previousState.mode != event.newState.mode) {
         if (event.newState.mode == Targets::TargetMode::PROGRAMMING) {
             emit this->insightSignals->programmingModeEnabled();
@@ -190,6 +196,10 @@ void Insight::onTargetStateChangedEvent(const Events::TargetStateChanged& event)
 }
 
 void Insight::onTargetResetEvent(const Events::TargetReset& event) {
+    if (!event.relatesToEnvironment(this->environmentConfig.name)) {
+        return;
+    }
+
     try {
         if (this->targetState.executionState != TargetExecutionState::STOPPED) {
             // Reset event came in too late, target has already resumed execution. Ignore
@@ -204,10 +214,18 @@ void Insight::onTargetResetEvent(const Events::TargetReset& event) {
 }
 
 void Insight::onTargetRegistersWrittenEvent(const Events::RegistersWrittenToTarget& event) {
+    if (!event.relatesToEnvironment(this->environmentConfig.name)) {
+        return;
+    }
+
     emit this->insightSignals->targetRegistersWritten(event.registers, event.createdTimestamp);
 }
 
 void Insight::onTargetMemoryWrittenEvent(const Events::MemoryWrittenToTarget& event) {
+    if (!event.relatesToEnvironment(this->environmentConfig.name)) {
+        return;
+    }
+
     emit this->insightSignals->targetMemoryWritten(
         event.addressSpaceDescriptor,
         event.memorySegmentDescriptor,
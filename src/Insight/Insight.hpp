@@ -43,9 +43,13 @@ public:
      * attribute, as this is required by Qt before creating a QCoreApplication instance.
      *
      * @param eventManager
+     *
+     * @param targetController
+     *  The TargetController serving the given environment. Events from other environments are ignored.
      */
     explicit Insight(
         EventListener& eventListener,
+        TargetController::TargetControllerComponent& targetController,
         const ProjectConfig& projectConfig,
         const EnvironmentConfig& environmentConfig,
         const InsightConfig& insightConfig,
@@ -74,7 +78,7 @@ private:
 
     InsightProjectSettings& insightProjectSettings;
 
-    Services::TargetControllerService targetControllerService = {};
+    Services::TargetControllerService targetControllerService;
 
     const Targets::TargetDescriptor& targetDescriptor;
     const Targets::TargetState& targetState;
@@ -25,7 +25,10 @@ class InsightWorker: public QObject
 public:
     const std::uint8_t id = ++(InsightWorker::lastWorkerId);
 
-    InsightWorker() = default;
+    explicit InsightWorker(const Services::TargetControllerService& targetControllerService)
+        : targetControllerService(targetControllerService)
+    {}
+
     void startup();
     static void queueTask(const QSharedPointer<InsightWorkerTask>& task);
 
@@ -37,7 +40,7 @@ private:
     static inline Synchronised<std::map<InsightWorkerTask::IdType, QSharedPointer<InsightWorkerTask>>> queuedTasksById = {};
     static inline Synchronised<TaskGroups> taskGroupsInExecution = {};
 
-    Services::TargetControllerService targetControllerService = {};
+    Services::TargetControllerService targetControllerService;
 
     void executeTasks();
 };
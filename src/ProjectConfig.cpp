@@ -1,5 +1,7 @@
 #include "ProjectConfig.hpp"
 
+#include <algorithm>
+
 #include "src/Services/StringService.hpp"
 #include "src/Services/PathService.hpp"
 #include "src/Logger/Logger.hpp"
@@ -77,6 +79,36 @@ ProjectConfig::ProjectConfig(const YAML::Node& configNode) {
     if (configNode["debug_logging"]) {
         this->debugLogging = configNode["debug_logging"].as<bool>(this->debugLogging);
     }
+
+    if (configNode["concurrent_environments"]) {
+        const auto& concurrentEnvironmentsNode = configNode["concurrent_environments"];
+
+        if (!concurrentEnvironmentsNode.IsSequence()) {
+            throw Exceptions::InvalidConfig{
+                "Invalid concurrent_environments configuration provided - node must take the form of a YAML sequence."
+            };
+        }
+
+        for (const auto& environmentNameNode : concurrentEnvironmentsNode) {
+            auto environmentName = environmentNameNode.as<std::string>();
+
+            if (std::find(
+                this->concurrentEnvironmentNames.begin(),
+                this->concurrentEnvironmentNames.end(),
+                environmentName
+            ) != this->concurrentEnvironmentNames.end()) {
+                throw Exceptions::InvalidConfig{
+                    "Environment (\"" + environmentName + "\") listed more than once in concurrent_environments."
+                };
+            }
+
+            this->concurrentEnvironmentNames.emplace_back(std::move(environmentName));
+        }
+    }
+
+    if (configNode["insight_environment"]) {
+        this->insightEnvironmentName = configNode["insight_environment"].as<std::string>();
+    }
 }
 
 InsightConfig::InsightConfig(const YAML::Node& insightNode) {
@@ -213,6 +245,18 @@ TargetConfig::TargetConfig(const YAML::Node& targetNode) {
         this->programMemoryCache = targetNode["program_memory_cache"].as<bool>(this->programMemoryCache);
     }
 
+    if (targetNode["halted_state_cache"]) {
+        this->haltedStateCache = targetNode["halted_state_cache"].as<bool>(this->haltedStateCache);
+    }
+
+    if (targetNode["memory_prefetch"]) {
+        this->memoryPrefetch = targetNode["memory_prefetch"].as<bool>(this->memoryPrefetch);
+    }
+
+    if (targetNode["memory_prefetch_max_size"]) {
+        this->memoryPrefetchMaxSize = targetNode["memory_prefetch_max_size"].as<std::uint32_t>();
+    }
+
     if (targetNode["delta_programming"]) {
         this->deltaProgramming = targetNode["delta_programming"].as<bool>(this->deltaProgramming);
     }
@@ -236,6 +280,11 @@ DebugToolConfig::DebugToolConfig(const YAML::Node& toolNode) {
     }
 
     this->name = StringService::asciiToLower(toolNode["name"].as<std::string>());
+
+    if (toolNode["serial_number"]) {
+        this->serialNumber = toolNode["serial_number"].as<std::string>();
+    }
+
     this->toolNode = toolNode;
 }
 
@@ -3,7 +3,9 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 #include <optional>
+#include <cstdint>
 #include <yaml-cpp/yaml.h>
 
 #include "src/Targets/TargetPhysicalInterface.hpp"
@@ -35,6 +37,9 @@ struct TargetConfig
     bool resumeOnStartup = false;
     bool hardwareBreakpoints = true;
     bool programMemoryCache = true;
+    bool haltedStateCache = true;
+    bool memoryPrefetch = true;
+    std::optional<std::uint32_t> memoryPrefetchMaxSize = std::nullopt;
     bool deltaProgramming = true;
     std::optional<bool> reserveSteppingBreakpoint = std::nullopt;
 
@@ -55,6 +60,14 @@ struct DebugToolConfig
 {
     std::string name;
 
+    /**
+     * The serial number of the debug tool to use, for when more than one tool of the same model is connected (e.g.
+     * when serving environments concurrently).
+     *
+     * Extracted from the optional 'serial_number' parameter.
+     */
+    std::optional<std::string> serialNumber;
+
     YAML::Node toolNode;
 
     DebugToolConfig() = default;
@@ -113,5 +126,22 @@ struct ProjectConfig
     InsightConfig insightConfig = {};
     bool debugLogging = false;
 
+    /**
+     * Environments to serve concurrently, from a single Bloom process, when no environment is specified on the
+     * command line. Each environment gets its own TargetController and DebugServer, on dedicated threads, so each
+     * environment must have its own debug tool and its own server configuration (with a distinct port).
+     *
+     * Extracted from the optional 'concurrent_environments' sequence.
+     */
+    std::vector<std::string> concurrentEnvironmentNames;
+
+    /**
+     * The environment that Insight is bound to, when serving environments concurrently. Insight can only serve a
+     * single environment. If this isn't specified, Insight is bound to the first of the concurrent environments.
+     *
+     * Extracted from the optional 'insight_environment' parameter.
+     */
+    std::optional<std::string> insightEnvironmentName;
+
     explicit ProjectConfig(const YAML::Node& configNode);
 };
@@ -27,6 +27,9 @@
 #include "src/TargetController/Commands/Shutdown.hpp"
 #include "src/TargetController/Commands/GetTargetPassthroughHelpText.hpp"
 #include "src/TargetController/Commands/InvokeTargetPassthroughCommand.hpp"
+#include "src/TargetController/Commands/ExecuteCommandBatch.hpp"
+#include "src/TargetController/Commands/GetHaltedStateCacheStats.hpp"
+#include "src/TargetController/Commands/GetProgrammingStats.hpp"
 
 #include "src/Exceptions/Exception.hpp"
 
@@ -58,6 +61,12 @@ namespace Services
     using TargetController::Commands::Shutdown;
     using TargetController::Commands::GetTargetPassthroughHelpText;
     using TargetController::Commands::InvokeTargetPassthroughCommand;
+    using TargetController::Commands::ExecuteCommandBatch;
+    using TargetController::Commands::GetHaltedStateCacheStats;
+    using TargetController::Commands::GetProgrammingStats;
+
+    using TargetController::Responses::CommandBatchResponses;
+    using TargetController::Responses::TargetRegistersRead;
 
     using Targets::TargetDescriptor;
     using Targets::TargetState;
@@ -317,6 +326,36 @@ namespace Services
         );
     }
 
+    std::unique_ptr<CommandBatchResponses> TargetControllerService::executeCommandBatch(
+        std::vector<std::unique_ptr<TargetController::Commands::Command>>&& commands
+    ) const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<ExecuteCommandBatch>(std::move(commands)),
+            this->defaultTimeout,
+            this->activeAtomicSessionId
+        );
+    }
+
+    TargetControllerService::StopContext TargetControllerService::readStopContext(
+        const TargetRegisterDescriptors& registerDescriptors
+    ) const {
+        auto commands = std::vector<std::unique_ptr<TargetController::Commands::Command>>{};
+        commands.emplace_back(std::make_unique<GetTargetStackPointer>());
+
+        if (!registerDescriptors.empty()) {
+            commands.emplace_back(std::make_unique<ReadTargetRegisters>(registerDescriptors));
+        }
+
+        const auto batchResponse = this->executeCommandBatch(std::move(commands));
+
+        return StopContext{
+            .stackPointer = batchResponse->responseAt<TargetController::Responses::TargetStackPointer>(0).stackPointer,
+            .registers = !registerDescriptors.empty()
+                ? batchResponse->responseAt<TargetRegistersRead>(1).registers
+                : TargetRegisterDescriptorAndValuePairs{},
+        };
+    }
+
     void TargetControllerService::resetTarget() const {
         this->commandManager.sendCommandAndWaitForResponse(
             std::make_unique<ResetTarget>(),
@@ -325,6 +364,22 @@ namespace Services
         );
     }
 
+    TargetController::HaltedStateCacheStats TargetControllerService::getHaltedStateCacheStats() const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<GetHaltedStateCacheStats>(),
+            this->defaultTimeout,
+            this->activeAtomicSessionId
+        )->stats;
+    }
+
+    TargetController::ProgrammingStats TargetControllerService::getProgrammingStats() const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<GetProgrammingStats>(),
+            this->defaultTimeout,
+            this->activeAtomicSessionId
+        )->stats;
+    }
+
     void TargetControllerService::enableProgrammingMode() const {
         this->commandManager.sendCommandAndWaitForResponse(
             std::make_unique<EnableProgrammingMode>(),
@@ -5,9 +5,14 @@
 #include <memory>
 #include <optional>
 #include <functional>
+#include <vector>
 
 #include "src/TargetController/CommandManager.hpp"
 #include "src/TargetController/AtomicSession.hpp"
+#include "src/TargetController/HaltedStateCacheStats.hpp"
+#include "src/TargetController/ProgrammingStats.hpp"
+#include "src/TargetController/Commands/Command.hpp"
+#include "src/TargetController/Responses/CommandBatchResponses.hpp"
 
 #include "src/Targets/TargetState.hpp"
 #include "src/Targets/TargetAddressSpaceDescriptor.hpp"
@@ -53,7 +58,25 @@ namespace Services
             TargetController::AtomicSessionIdType sessionId;
         };
 
-        TargetControllerService() = default;
+        /**
+         * A snapshot of the target's state at a stop, obtained via TargetControllerService::readStopContext().
+         *
+         * The program counter is not included, as it's already held in the cached target state (see
+         * Targets::TargetState::programCounter).
+         */
+        struct StopContext
+        {
+            Targets::TargetStackPointer stackPointer;
+            Targets::TargetRegisterDescriptorAndValuePairs registers;
+        };
+
+        /**
+         * @param targetController
+         *  The TargetController to issue commands to. Each environment has its own TargetController instance.
+         */
+        explicit TargetControllerService(TargetController::TargetControllerComponent& targetController)
+            : commandManager(targetController)
+        {}
 
         void setDefaultTimeout(std::chrono::milliseconds timeout) {
             this->defaultTimeout = timeout;
@@ -245,11 +268,51 @@ namespace Services
          */
         void setStackPointer(Targets::TargetStackPointer stackPointer) const;
 
+        /**
+         * Sends the given commands to the TargetController as a single batch, to be executed in one TargetController
+         * iteration.
+         *
+         * If any of the commands fail, the whole batch fails and an exception is thrown.
+         *
+         * @param commands
+         *
+         * @return
+         *  The batch response, holding one response per command, in order. Use
+         *  CommandBatchResponses::responseAt() to access the individual responses.
+         */
+        [[nodiscard]] std::unique_ptr<TargetController::Responses::CommandBatchResponses> executeCommandBatch(
+            std::vector<std::unique_ptr<TargetController::Commands::Command>>&& commands
+        ) const;
+
+        /**
+         * Reads the stack pointer and the given registers from the target, in a single batched TargetController
+         * command.
+         *
+         * @param registerDescriptors
+         *
+         * @return
+         */
+        [[nodiscard]] StopContext readStopContext(const Targets::TargetRegisterDescriptors& registerDescriptors) const;
+
         /**
          * Triggers a reset on the target. The target will be held in a stopped state.
          */
         void resetTarget() const;
 
+        /**
+         * Retrieves the hit/miss counters of the TargetController's halted state cache.
+         *
+         * @return
+         */
+        [[nodiscard]] TargetController::HaltedStateCacheStats getHaltedStateCacheStats() const;
+
+        /**
+         * Retrieves the TargetController's programming throughput figures.
+         *
+         * @return
+         */
+        [[nodiscard]] TargetController::ProgrammingStats getProgrammingStats() const;
+
         /**
          * Enables programming mode on the target.
          *
@@ -284,7 +347,7 @@ namespace Services
         TargetControllerService::AtomicSession makeAtomicSession();
 
     private:
-        TargetController::CommandManager commandManager = TargetController::CommandManager();
+        TargetController::CommandManager commandManager;
 
         std::optional<TargetController::AtomicSessionIdType> activeAtomicSessionId = std::nullopt;
 
@@ -16,9 +16,16 @@
 
 namespace TargetController
 {
+    /**
+     * Issues commands to a TargetControllerComponent instance.
+     */
     class CommandManager
     {
     public:
+        explicit CommandManager(TargetControllerComponent& targetController)
+            : targetController(targetController)
+        {}
+
         template<class CommandType>
             requires
                 std::is_base_of_v<Commands::Command, CommandType>
@@ -35,9 +42,9 @@ namespace TargetController
                 "Issuing " + CommandType::name + " command (ID: " + std::to_string(commandId) + ") to TargetController"
             );
 
-            TargetControllerComponent::registerCommand(std::move(command), atomicSessionId);
+            auto responseFuture = this->targetController.registerCommand(std::move(command), atomicSessionId);
 
-            auto optionalResponse = TargetControllerComponent::waitForResponse(commandId, timeout);
+            auto optionalResponse = TargetControllerComponent::waitForResponse(responseFuture, timeout);
 
             if (!optionalResponse.has_value()) {
                 Logger::debug(
@@ -73,5 +80,8 @@ namespace TargetController
                 return std::move(response);
             }
         }
+
+    private:
+        TargetControllerComponent& targetController;
     };
 }
@@ -33,5 +33,8 @@ namespace TargetController::Commands
         DISABLE_PROGRAMMING_MODE,
         GET_TARGET_PASSTHROUGH_HELP_TEXT,
         INVOKE_TARGET_PASSTHROUGH_COMMAND,
+        EXECUTE_COMMAND_BATCH,
+        GET_HALTED_STATE_CACHE_STATS,
+        GET_PROGRAMMING_STATS,
     };
 }
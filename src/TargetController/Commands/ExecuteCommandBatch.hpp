@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "Command.hpp"
+#include "src/TargetController/Responses/CommandBatchResponses.hpp"
+
+namespace TargetController::Commands
+{
+    /**
+     * Carries a sequence of commands, to be executed by the TargetController in a single iteration, and answered
+     * with a single response.
+     *
+     * The commands are executed in order. If any command fails, the remaining commands will not be executed and the
+     * TargetController will respond to the whole batch with an error.
+     *
+     * Commands that affect the TargetController itself (atomic sessions, shutdown, nested batches) cannot be
+     * batched. See ExecuteCommandBatch::batchable().
+     */
+    class ExecuteCommandBatch: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::CommandBatchResponses;
+
+        static constexpr CommandType type = CommandType::EXECUTE_COMMAND_BATCH;
+        static const inline std::string name = "ExecuteCommandBatch";
+
+        std::vector<std::unique_ptr<Command>> commands;
+
+        explicit ExecuteCommandBatch(std::vector<std::unique_ptr<Command>>&& commands)
+            : commands(std::move(commands))
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return ExecuteCommandBatch::type;
+        }
+
+        /*
+         * Target state and debug mode requirements are checked for each command in the batch, as the batch is
+         * executed. The batch itself has no such requirements.
+         */
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return false;
+        }
+
+        [[nodiscard]] static bool batchable(const Command& command) {
+            switch (command.getType()) {
+                case CommandType::EXECUTE_COMMAND_BATCH:
+                case CommandType::START_ATOMIC_SESSION:
+                case CommandType::END_ATOMIC_SESSION:
+                case CommandType::SHUTDOWN: {
+                    return false;
+                }
+                default: {
+                    return true;
+                }
+            }
+        }
+    };
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Command.hpp"
+#include "src/TargetController/Responses/HaltedStateCacheStatsResponse.hpp"
+
+namespace TargetController::Commands
+{
+    class GetHaltedStateCacheStats: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::HaltedStateCacheStatsResponse;
+        static constexpr CommandType type = CommandType::GET_HALTED_STATE_CACHE_STATS;
+        static const inline std::string name = "GetHaltedStateCacheStats";
+
+        [[nodiscard]] CommandType getType() const override {
+            return GetHaltedStateCacheStats::type;
+        }
+
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return false;
+        }
+    };
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Command.hpp"
+#include "src/TargetController/Responses/ProgrammingStatsResponse.hpp"
+
+namespace TargetController::Commands
+{
+    class GetProgrammingStats: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::ProgrammingStatsResponse;
+        static constexpr CommandType type = CommandType::GET_PROGRAMMING_STATS;
+        static const inline std::string name = "GetProgrammingStats";
+
+        [[nodiscard]] CommandType getType() const override {
+            return GetProgrammingStats::type;
+        }
+
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return false;
+        }
+    };
+}
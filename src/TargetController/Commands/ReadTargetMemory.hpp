@@ -28,7 +28,7 @@ namespace TargetController::Commands
         Targets::TargetMemorySize bytes;
 
         /**
-         * Currently, we only cache program memory. This flag has no effect when reading from other memories.
+         * Bypasses the program memory cache and the halted state cache, if the memory is covered by either.
          */
         bool bypassCache;
 
@@ -54,8 +54,12 @@ namespace TargetController::Commands
             return ReadTargetMemory::type;
         }
 
+        /**
+         * Some targets can service memory reads whilst running - the TargetController checks this when handling the
+         * command. See Targets::Target::canReadMemoryWhileRunning().
+         */
         [[nodiscard]] bool requiresStoppedTargetState() const override {
-            return true;
+            return false;
         }
 
         [[nodiscard]] bool requiresDebugMode() const override {
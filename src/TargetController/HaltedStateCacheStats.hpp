@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+
+namespace TargetController
+{
+    /**
+     * Hit/miss counters for the TargetController's halted state cache.
+     *
+     * See TargetControllerComponent::haltedMemoryCachesBySegmentId and
+     * TargetControllerComponent::haltedRegisterValuesById.
+     */
+    struct HaltedStateCacheStats
+    {
+        std::uint64_t memoryReadHits = 0;
+        std::uint64_t memoryReadMisses = 0;
+        std::uint64_t registerReadHits = 0;
+        std::uint64_t registerReadMisses = 0;
+
+        /**
+         * The number of times the cache has been invalidated (target resumed, stepped, reset, etc).
+         */
+        std::uint64_t invalidations = 0;
+
+        /**
+         * Prefetch counters. These cover the program memory cache as well as the halted state cache.
+         *
+         * See TargetController::MemoryPrefetcher.
+         */
+        std::uint64_t prefetches = 0;
+        std::uint64_t prefetchedBytes = 0;
+
+        /**
+         * The number of reads that were serviced entirely by prefetched data - each one is a round trip to the debug
+         * tool that we didn't have to make.
+         */
+        std::uint64_t prefetchHits = 0;
+    };
+}
@@ -0,0 +1,110 @@
+#include "MemoryPrefetcher.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace TargetController
+{
+    using Targets::TargetAddressSpaceDescriptor;
+    using Targets::TargetMemorySegmentDescriptor;
+    using Targets::TargetMemoryAddressRange;
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+
+    std::optional<TargetMemoryAddressRange> MemoryPrefetcher::recordMiss(
+        const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+        const TargetMemorySegmentDescriptor& memorySegmentDescriptor,
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes,
+        TargetMemorySize maximumSize
+    ) {
+        auto& stream = this->streamsByAddressSpaceId[addressSpaceDescriptor.id];
+
+        const auto stride = static_cast<std::int64_t>(startAddress)
+            - static_cast<std::int64_t>(stream.lastStartAddress);
+
+        if (stride != 0 && stride == stream.stride) {
+            stream.confidence = std::min(
+                static_cast<std::uint8_t>(stream.confidence + 1),
+                MemoryPrefetcher::CONFIDENCE_THRESHOLD
+            );
+
+        } else {
+            stream.stride = stride;
+            stream.confidence = 0;
+        }
+
+        stream.lastStartAddress = startAddress;
+
+        if (
+            stream.confidence < MemoryPrefetcher::CONFIDENCE_THRESHOLD
+            || bytes == 0
+            || maximumSize == 0
+            || static_cast<std::uint64_t>(std::abs(stream.stride)) > maximumSize
+        ) {
+            // No pattern, or the stride is too large for a prefetch to be of any use
+            return std::nullopt;
+        }
+
+        const auto& segmentRange = memorySegmentDescriptor.addressRange;
+        const auto endAddress = static_cast<std::uint64_t>(startAddress) + bytes - 1;
+
+        auto prefetchRange = std::optional<TargetMemoryAddressRange>{};
+
+        if (stream.stride > 0 && endAddress < segmentRange.endAddress) {
+            prefetchRange = TargetMemoryAddressRange{
+                static_cast<TargetMemoryAddress>(endAddress + 1),
+                static_cast<TargetMemoryAddress>(
+                    std::min(endAddress + maximumSize, static_cast<std::uint64_t>(segmentRange.endAddress))
+                )
+            };
+
+        } else if (stream.stride < 0 && startAddress > segmentRange.startAddress) {
+            prefetchRange = TargetMemoryAddressRange{
+                startAddress - std::min(maximumSize, startAddress - segmentRange.startAddress),
+                startAddress - 1
+            };
+        }
+
+        stream.prefetchedRange = prefetchRange;
+        return prefetchRange;
+    }
+
+    bool MemoryPrefetcher::recordHit(
+        const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes
+    ) {
+        const auto streamIt = this->streamsByAddressSpaceId.find(addressSpaceDescriptor.id);
+        if (streamIt == this->streamsByAddressSpaceId.end()) {
+            return false;
+        }
+
+        auto& stream = streamIt->second;
+
+        /*
+         * Reads that are serviced by the cache still form part of the access pattern. If we didn't track them, the
+         * stride would be broken every time a prefetched block was exhausted.
+         */
+        const auto stride = static_cast<std::int64_t>(startAddress)
+            - static_cast<std::int64_t>(stream.lastStartAddress);
+        if (stride != stream.stride) {
+            stream.stride = stride;
+            stream.confidence = 0;
+        }
+
+        stream.lastStartAddress = startAddress;
+
+        return bytes > 0
+            && stream.prefetchedRange.has_value()
+            && stream.prefetchedRange->contains(
+                TargetMemoryAddressRange{startAddress, static_cast<TargetMemoryAddress>(startAddress + bytes - 1)}
+            );
+    }
+
+    void MemoryPrefetcher::clearPrefetchedRanges() {
+        for (auto& [addressSpaceId, stream] : this->streamsByAddressSpaceId) {
+            stream.prefetchedRange = std::nullopt;
+        }
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+
+#include "src/Targets/TargetAddressSpaceDescriptor.hpp"
+#include "src/Targets/TargetMemorySegmentDescriptor.hpp"
+#include "src/Targets/TargetMemoryAddressRange.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+namespace TargetController
+{
+    /**
+     * Detects sequential and strided memory read patterns, and predicts the memory that will be read next.
+     *
+     * GDB tends to read memory in small chunks, in a predictable order. When disassembling, it reads program memory
+     * sequentially. When generating a backtrace, it walks the stack, a few bytes at a time. Each of these reads
+     * costs a round trip to the debug tool.
+     *
+     * The TargetControllerComponent feeds every cacheable read into the prefetcher, which tracks the distance between
+     * consecutive reads in each address space. Once the same distance (stride) has been observed
+     * MemoryPrefetcher::CONFIDENCE_THRESHOLD times in a row, the prefetcher proposes a block of memory
+     * immediately ahead of the read, in the direction of the stride. The TargetControllerComponent reads the block
+     * from the target, along with the requested memory, in a single read operation, and inserts it into the cache.
+     */
+    class MemoryPrefetcher
+    {
+    public:
+        /**
+         * The number of consecutive reads with the same stride required before we begin prefetching.
+         */
+        static constexpr std::uint8_t CONFIDENCE_THRESHOLD = 2;
+
+        /**
+         * Records a read that missed the cache, and proposes a range to prefetch, if a pattern has been detected.
+         *
+         * @param addressSpaceDescriptor
+         * @param memorySegmentDescriptor
+         * @param startAddress
+         * @param bytes
+         * @param maximumSize
+         *  The maximum size of the prefetch range.
+         *
+         * @return
+         *  The range to prefetch, which will be adjacent to the read range and will reside within the memory segment.
+         *  std::nullopt if no pattern has been detected.
+         */
+        std::optional<Targets::TargetMemoryAddressRange> recordMiss(
+            const Targets::TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+            const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes,
+            Targets::TargetMemorySize maximumSize
+        );
+
+        /**
+         * Records a read that was serviced by the cache.
+         *
+         * @param addressSpaceDescriptor
+         * @param startAddress
+         * @param bytes
+         *
+         * @return
+         *  True if the read was serviced by data that was prefetched (meaning the prefetch saved a round trip to the
+         *  debug tool).
+         */
+        bool recordHit(
+            const Targets::TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes
+        );
+
+        /**
+         * Forgets the last prefetched ranges. Should be called when the cache is cleared.
+         *
+         * The detected patterns are kept, as GDB tends to repeat the same access patterns on every stop.
+         */
+        void clearPrefetchedRanges();
+
+    private:
+        struct Stream
+        {
+            Targets::TargetMemoryAddress lastStartAddress = 0;
+            std::int64_t stride = 0;
+            std::uint8_t confidence = 0;
+            std::optional<Targets::TargetMemoryAddressRange> prefetchedRange = std::nullopt;
+        };
+
+        std::map<Targets::TargetAddressSpaceId, Stream> streamsByAddressSpaceId;
+    };
+}
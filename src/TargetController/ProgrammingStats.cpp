@@ -0,0 +1,33 @@
+#include "ProgrammingStats.hpp"
+
+namespace TargetController
+{
+    QJsonObject ProgrammingSessionStats::toJson() const {
+        return QJsonObject{
+            {"requestedBytes", static_cast<qint64>(this->requestedBytes)},
+            {"writtenBytes", static_cast<qint64>(this->writtenBytes)},
+            {"eraseOperations", static_cast<qint64>(this->eraseOperations)},
+            {"writeOperations", static_cast<qint64>(this->writeOperations)},
+            {"eraseDurationUs", static_cast<qint64>(this->eraseDuration.count())},
+            {"writeDurationUs", static_cast<qint64>(this->writeDuration.count())},
+            {"finaliseDurationUs", static_cast<qint64>(this->finaliseDuration.count())},
+            {"totalDurationUs", static_cast<qint64>(this->totalDuration.count())},
+            {"usbTransfers", static_cast<qint64>(this->usbTransfers)},
+            {"bytesPerSecond", this->bytesPerSecond()},
+            {"writeBytesPerSecond", this->writeBytesPerSecond()},
+        };
+    }
+
+    QJsonObject ProgrammingStats::toJson() const {
+        auto output = QJsonObject{
+            {"sessionCount", static_cast<qint64>(this->sessionCount)},
+            {"totals", this->totals.toJson()},
+        };
+
+        if (this->lastSession.has_value()) {
+            output.insert("lastSession", this->lastSession->toJson());
+        }
+
+        return output;
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <chrono>
+#include <optional>
+#include <QJsonObject>
+
+namespace TargetController
+{
+    /**
+     * Throughput figures for a single programming session (the period between enabling and disabling programming
+     * mode, which is typically a single "load" command in GDB).
+     *
+     * Only program memory operations are accounted for.
+     */
+    struct ProgrammingSessionStats
+    {
+        /**
+         * The number of bytes the debug client asked us to write.
+         */
+        std::uint64_t requestedBytes = 0;
+
+        /**
+         * The number of bytes we actually wrote to the target. With delta programming, this can be considerably
+         * smaller than requestedBytes.
+         */
+        std::uint64_t writtenBytes = 0;
+
+        std::uint64_t eraseOperations = 0;
+        std::uint64_t writeOperations = 0;
+
+        std::chrono::microseconds eraseDuration = {};
+        std::chrono::microseconds writeDuration = {};
+
+        /**
+         * Time spent in disabling programming mode, excluding any writes (delta programming session commits are
+         * accounted for in writeDuration). This covers the delta computation, leaving programming mode on the
+         * target and the restoration of breakpoints.
+         */
+        std::chrono::microseconds finaliseDuration = {};
+
+        /**
+         * Time from enabling programming mode to completion of disabling it. This includes any time spent waiting
+         * on the debug client.
+         */
+        std::chrono::microseconds totalDuration = {};
+
+        /**
+         * The number of USB transfers (HID reports and bulk transfers, in either direction) performed over the
+         * session. See Usb::UsbTrace::transferCount().
+         */
+        std::uint64_t usbTransfers = 0;
+
+        /**
+         * Effective throughput - requested bytes over the total duration of the session.
+         */
+        [[nodiscard]] double bytesPerSecond() const {
+            return this->totalDuration.count() > 0
+                ? static_cast<double>(this->requestedBytes) * 1000000 / static_cast<double>(this->totalDuration.count())
+                : 0;
+        }
+
+        /**
+         * Raw write throughput - written bytes over the time spent writing.
+         */
+        [[nodiscard]] double writeBytesPerSecond() const {
+            return this->writeDuration.count() > 0
+                ? static_cast<double>(this->writtenBytes) * 1000000 / static_cast<double>(this->writeDuration.count())
+                : 0;
+        }
+
+        /**
+         * Produces the JSON form of these figures, as used by the "monitor programming machine" GDB command and the
+         * programming benchmark.
+         *
+         * @return
+         */
+        [[nodiscard]] QJsonObject toJson() const;
+
+        ProgrammingSessionStats& operator += (const ProgrammingSessionStats& rhs) {
+            this->requestedBytes += rhs.requestedBytes;
+            this->writtenBytes += rhs.writtenBytes;
+            this->eraseOperations += rhs.eraseOperations;
+            this->writeOperations += rhs.writeOperations;
+            this->eraseDuration += rhs.eraseDuration;
+            this->writeDuration += rhs.writeDuration;
+            this->finaliseDuration += rhs.finaliseDuration;
+            this->totalDuration += rhs.totalDuration;
+            this->usbTransfers += rhs.usbTransfers;
+            return *this;
+        }
+    };
+
+    /**
+     * Programming throughput figures, accumulated over the lifetime of the TargetController.
+     */
+    struct ProgrammingStats
+    {
+        std::uint64_t sessionCount = 0;
+        std::optional<ProgrammingSessionStats> lastSession;
+
+        /**
+         * Sum of all completed sessions.
+         */
+        ProgrammingSessionStats totals;
+
+        [[nodiscard]] QJsonObject toJson() const;
+    };
+}
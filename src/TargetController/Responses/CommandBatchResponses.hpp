@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cassert>
+
+#include "Response.hpp"
+
+namespace TargetController::Responses
+{
+    class CommandBatchResponses: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::COMMAND_BATCH_RESPONSES;
+
+        /**
+         * One response for each command in the batch, in the order in which the commands were given.
+         */
+        std::vector<std::unique_ptr<Response>> responses;
+
+        explicit CommandBatchResponses(std::vector<std::unique_ptr<Response>>&& responses)
+            : responses(std::move(responses))
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return CommandBatchResponses::type;
+        }
+
+        /**
+         * Downcasts the response at the given index.
+         *
+         * @tparam BatchedResponseType
+         * @param index
+         *
+         * @return
+         */
+        template<class BatchedResponseType>
+        [[nodiscard]] const BatchedResponseType& responseAt(std::size_t index) const {
+            const auto& response = this->responses.at(index);
+            assert(response->getType() == BatchedResponseType::type);
+            return dynamic_cast<const BatchedResponseType&>(*response);
+        }
+    };
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Response.hpp"
+
+#include "src/TargetController/HaltedStateCacheStats.hpp"
+
+namespace TargetController::Responses
+{
+    class HaltedStateCacheStatsResponse: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::HALTED_STATE_CACHE_STATS;
+
+        HaltedStateCacheStats stats;
+
+        explicit HaltedStateCacheStatsResponse(const HaltedStateCacheStats& stats)
+            : stats(stats)
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return HaltedStateCacheStatsResponse::type;
+        }
+    };
+}
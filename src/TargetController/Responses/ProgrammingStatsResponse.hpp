@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Response.hpp"
+
+#include "src/TargetController/ProgrammingStats.hpp"
+
+namespace TargetController::Responses
+{
+    class ProgrammingStatsResponse: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::PROGRAMMING_STATS;
+
+        ProgrammingStats stats;
+
+        explicit ProgrammingStatsResponse(const ProgrammingStats& stats)
+            : stats(stats)
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return ProgrammingStatsResponse::type;
+        }
+    };
+}
@@ -19,5 +19,8 @@ namespace TargetController::Responses
         PROGRAM_BREAKPOINT,
         TARGET_PASSTHROUGH_HELP_TEXT,
         TARGET_PASSTHROUGH_RESPONSE,
+        COMMAND_BATCH_RESPONSES,
+        HALTED_STATE_CACHE_STATS,
+        PROGRAMMING_STATS,
     };
 }
@@ -8,6 +8,8 @@
 #include "src/Targets/Microchip/Avr8/TargetDescriptionFile.hpp"
 #include "src/Targets/RiscV/Wch/TargetDescriptionFile.hpp"
 
+#include "src/DebugToolDrivers/Usb/UsbTrace.hpp"
+
 #include "Responses/Error.hpp"
 
 #include "src/Services/TargetService.hpp"
@@ -57,6 +59,9 @@ namespace TargetController
     using Commands::DisableProgrammingMode;
     using Commands::GetTargetPassthroughHelpText;
     using Commands::InvokeTargetPassthroughCommand;
+    using Commands::ExecuteCommandBatch;
+    using Commands::GetHaltedStateCacheStats;
+    using Commands::GetProgrammingStats;
 
     using Responses::Response;
     using Responses::AtomicSessionId;
@@ -68,6 +73,9 @@ namespace TargetController
     using Responses::ProgramBreakpoint;
     using Responses::TargetPassthroughHelpText;
     using Responses::TargetPassthroughResponse;
+    using Responses::CommandBatchResponses;
+    using Responses::HaltedStateCacheStatsResponse;
+    using Responses::ProgrammingStatsResponse;
 
     TargetControllerComponent::TargetControllerComponent(
         const ProjectConfig& projectConfig,
@@ -85,9 +93,7 @@ namespace TargetController
             Logger::debug("TargetController ready");
 
             while (this->getThreadState() == ThreadState::READY) {
-                this->refreshExecutionState();
-
-                TargetControllerComponent::notifier.waitForNotification(std::chrono::milliseconds{60});
+                this->notifier.waitForNotification(this->pollExecutionState());
 
                 this->processQueuedCommands();
                 this->eventListener->dispatchCurrentEvents();
@@ -101,60 +107,46 @@ namespace TargetController
         this->shutdown();
     }
 
-    void TargetControllerComponent::registerCommand(
+    std::future<std::unique_ptr<Response>> TargetControllerComponent::registerCommand(
         std::unique_ptr<Command> command,
         const std::optional<AtomicSessionIdType>& atomicSessionId
     ) {
-        if (TargetControllerComponent::state != TargetControllerState::ACTIVE) {
+        if (this->state != TargetControllerState::ACTIVE) {
             throw Exception{"Command rejected - TargetController not in active state."};
         }
 
-        if (atomicSessionId.has_value()) {
-            // This command is part of an atomic session - put it in the dedicated queue
-            TargetControllerComponent::atomicSessionCommandQueue.accessor()->push(std::move(command));
-            TargetControllerComponent::notifier.notify();
-            return;
-        }
+        auto queuedCommand = QueuedCommand{.command = std::move(command), .responsePromise = {}};
+        auto responseFuture = queuedCommand.responsePromise.get_future();
+
+        // If this command is part of an atomic session, we put it in the dedicated queue
+        auto& queue = atomicSessionId.has_value()
+            ? this->atomicSessionCommandQueue
+            : this->commandQueue;
 
-        TargetControllerComponent::commandQueue.accessor()->push(std::move(command));
-        TargetControllerComponent::notifier.notify();
+        queue.push(std::move(queuedCommand));
+        this->notifier.notify();
+
+        return responseFuture;
     }
 
     std::optional<std::unique_ptr<Responses::Response>> TargetControllerComponent::waitForResponse(
-        CommandIdType commandId,
+        std::future<std::unique_ptr<Response>>& responseFuture,
         std::optional<std::chrono::milliseconds> timeout
     ) {
-        auto response = std::unique_ptr<Response>{};
-
-        const auto predicate = [commandId, &response] {
-            // We will already hold the lock here, so we can use Synchronised::unsafeReference() here.
-            auto& responsesByCommandId = TargetControllerComponent::responsesByCommandId.unsafeReference();
-            auto responseIt = responsesByCommandId.find(commandId);
-
-            if (responseIt != responsesByCommandId.end()) {
-                response.swap(responseIt->second);
-                responsesByCommandId.erase(responseIt);
-
-                return true;
-            }
-
-            return false;
-        };
-
-        auto responsesByCommandIdLock = TargetControllerComponent::responsesByCommandId.lock();
+        if (
+            timeout.has_value()
+            && responseFuture.wait_for(timeout.value()) != std::future_status::ready
+        ) {
+            return std::nullopt;
+        }
 
-        if (timeout.has_value()) {
-            TargetControllerComponent::responsesByCommandIdCv.wait_for(
-                responsesByCommandIdLock,
-                timeout.value(),
-                predicate
-            );
+        try {
+            return responseFuture.get();
 
-        } else {
-            TargetControllerComponent::responsesByCommandIdCv.wait(responsesByCommandIdLock, predicate);
+        } catch (const std::future_error&) {
+            // The TargetController discarded the command without responding
+            return std::nullopt;
         }
-
-        return (response != nullptr) ? std::optional{std::move(response)} : std::nullopt;
     }
 
     void TargetControllerComponent::deregisterCommandHandler(Commands::CommandType commandType) {
@@ -163,10 +155,13 @@ namespace TargetController
 
     void TargetControllerComponent::startup() {
         Logger::setThreadName("TC");
-        Logger::info("Starting TargetController");
+        Logger::info("Starting TargetController for environment \"" + this->environmentConfig.name + "\"");
         this->threadState = ThreadState::STARTING;
         this->blockAllSignals();
-        this->eventListener->setInterruptEventNotifier(&TargetControllerComponent::notifier);
+
+        Events::Event::setThreadEnvironmentName(this->environmentConfig.name);
+        this->eventListener->setEnvironmentName(this->environmentConfig.name);
+        this->eventListener->setInterruptEventNotifier(&this->notifier);
         EventManager::registerListener(this->eventListener);
 
         // Register command handlers
@@ -278,6 +273,18 @@ namespace TargetController
             std::bind(&TargetControllerComponent::handleTargetPassthroughCommand, this, std::placeholders::_1)
         );
 
+        this->registerCommandHandler<ExecuteCommandBatch>(
+            std::bind(&TargetControllerComponent::handleExecuteCommandBatch, this, std::placeholders::_1)
+        );
+
+        this->registerCommandHandler<GetHaltedStateCacheStats>(
+            std::bind(&TargetControllerComponent::handleGetHaltedStateCacheStats, this, std::placeholders::_1)
+        );
+
+        this->registerCommandHandler<GetProgrammingStats>(
+            std::bind(&TargetControllerComponent::handleGetProgrammingStats, this, std::placeholders::_1)
+        );
+
         // Register event handlers
         this->eventListener->registerCallbackForEventType<Events::ShutdownTargetController>(
             std::bind(&TargetControllerComponent::onShutdownTargetControllerEvent, this, std::placeholders::_1)
@@ -468,46 +475,26 @@ namespace TargetController
     }
 
     void TargetControllerComponent::processQueuedCommands() {
-        auto commands = std::queue<std::unique_ptr<Command>>{};
+        auto commands = std::queue<QueuedCommand>{};
 
-        commands.swap(
-            this->activeAtomicSession.has_value()
-                ? *(TargetControllerComponent::atomicSessionCommandQueue.accessor())
-                : *(TargetControllerComponent::commandQueue.accessor())
-        );
+        auto& queue = this->activeAtomicSession.has_value()
+            ? this->atomicSessionCommandQueue
+            : this->commandQueue;
+
+        while (auto queuedCommand = queue.tryPop()) {
+            commands.push(std::move(*queuedCommand));
+        }
 
         while (!commands.empty()) {
-            const auto& command = commands.front();
+            auto& queuedCommand = commands.front();
+            const auto& command = queuedCommand.command;
 
             try {
-                const auto commandHandlerIt = this->commandHandlersByCommandType.find(command->getType());
-
-                if (commandHandlerIt == this->commandHandlersByCommandType.end()) {
-                    throw Exception{"No handler registered for this command"};
-                }
-
-                if (this->state != TargetControllerState::ACTIVE) {
-                    throw Exception{"Command rejected - TargetController not in active state"};
-                }
-
-                if (
-                    command->requiresStoppedTargetState()
-                    && this->targetState->executionState != TargetExecutionState::STOPPED
-                ) {
-                    throw Exception{"Command rejected - command requires target execution to be stopped"};
-                }
-
-                if (this->target->programmingModeEnabled() && command->requiresDebugMode()) {
-                    throw Exception{
-                        "Command rejected - command cannot be serviced whilst the target is in programming mode"
-                    };
-                }
-
-                this->registerCommandResponse(command->id, commandHandlerIt->second(*(command.get())));
+                this->registerCommandResponse(queuedCommand, this->handleCommand(*(command.get())));
 
             } catch (const FatalErrorException& exception) {
                 this->registerCommandResponse(
-                    command->id,
+                    queuedCommand,
                     std::make_unique<Responses::Error>(exception.getMessage())
                 );
 
@@ -522,7 +509,7 @@ namespace TargetController
                 }
 
                 this->registerCommandResponse(
-                    command->id,
+                    queuedCommand,
                     std::make_unique<Responses::Error>(exception.getMessage())
                 );
             }
@@ -531,19 +518,45 @@ namespace TargetController
         }
     }
 
+    std::unique_ptr<Response> TargetControllerComponent::handleCommand(Command& command) {
+        const auto commandHandlerIt = this->commandHandlersByCommandType.find(command.getType());
+
+        if (commandHandlerIt == this->commandHandlersByCommandType.end()) {
+            throw Exception{"No handler registered for this command"};
+        }
+
+        if (this->state != TargetControllerState::ACTIVE) {
+            throw Exception{"Command rejected - TargetController not in active state"};
+        }
+
+        if (
+            command.requiresStoppedTargetState()
+            && this->targetState->executionState != TargetExecutionState::STOPPED
+        ) {
+            throw Exception{"Command rejected - command requires target execution to be stopped"};
+        }
+
+        if (this->target->programmingModeEnabled() && command.requiresDebugMode()) {
+            throw Exception{
+                "Command rejected - command cannot be serviced whilst the target is in programming mode"
+            };
+        }
+
+        return commandHandlerIt->second(command);
+    }
+
     void TargetControllerComponent::registerCommandResponse(
-        CommandIdType commandId,
+        QueuedCommand& queuedCommand,
         std::unique_ptr<Response> response
     ) {
-        TargetControllerComponent::responsesByCommandId.accessor()->emplace(commandId, std::move(response));
-        TargetControllerComponent::responsesByCommandIdCv.notify_all();
+        queuedCommand.responsePromise.set_value(std::move(response));
     }
 
     void TargetControllerComponent::acquireHardware() {
         const auto& debugToolName = this->environmentConfig.debugToolConfig.name;
         const auto& targetName = this->environmentConfig.targetConfig.name;
 
-        static const auto supportedDebugTools = this->getSupportedDebugTools();
+        const auto supportedDebugTools = this->getSupportedDebugTools();
 
         const auto debugToolIt = supportedDebugTools.find(debugToolName);
         const auto briefTargetDescriptor = Services::TargetService::briefDescriptor(targetName);
@@ -560,6 +573,11 @@ namespace TargetController
             };
         }
 
+        const auto& debugToolNode = this->environmentConfig.debugToolConfig.toolNode;
+        if (debugToolNode["usb_trace"]) {
+            Usb::UsbTrace::start(Usb::UsbTraceConfig{debugToolNode["usb_trace"]});
+        }
+
         this->debugTool = debugToolIt->second();
 
         Logger::info("Connecting to debug tool");
@@ -586,7 +604,9 @@ namespace TargetController
         this->target->activate();
         Logger::info("Target activated");
 
-        this->targetDescriptor = std::make_unique<const TargetDescriptor>(this->target->targetDescriptor());
+        auto targetDescriptor = this->target->targetDescriptor();
+        targetDescriptor.buildRegisterGroupIndex();
+        this->targetDescriptor = std::make_unique<const TargetDescriptor>(std::move(targetDescriptor));
         Logger::info("Target name: " + this->targetDescriptor->name);
 
         this->target->postActivate();
@@ -611,6 +631,8 @@ namespace TargetController
             Logger::info("Closing debug tool");
             debugTool->close();
         }
+
+        Usb::UsbTrace::stop();
     }
 
     void TargetControllerComponent::startAtomicSession() {
@@ -626,14 +648,16 @@ namespace TargetController
             return;
         }
 
-        {
-            auto commandQueue = TargetControllerComponent::atomicSessionCommandQueue.accessor();
-            auto empty = std::queue<std::unique_ptr<Commands::Command>>{};
-            commandQueue->swap(empty);
+        // Reject any commands that were issued for the session, but not processed before it ended
+        while (auto queuedCommand = this->atomicSessionCommandQueue.tryPop()) {
+            this->registerCommandResponse(
+                *queuedCommand,
+                std::make_unique<Responses::Error>("Command rejected - atomic session ended")
+            );
         }
 
         this->activeAtomicSession.reset();
-        TargetControllerComponent::notifier.notify();
+        this->notifier.notify();
     }
 
     void TargetControllerComponent::refreshExecutionState(bool forceUpdate) {
@@ -654,11 +678,54 @@ namespace TargetController
         const auto previousState = *(this->targetState);
         *(this->targetState) = newState;
 
+        if (
+            newState.executionState != previousState.executionState
+            || newState.mode != previousState.mode
+        ) {
+            this->invalidateHaltedStateCache();
+        }
+
+        if (newState.executionState != previousState.executionState) {
+            /*
+             * The execution state has changed, so we reset the poll interval. If the target has just been resumed
+             * or stepped, we want to know about the next stop as soon as possible.
+             */
+            this->executionStatePollInterval = newState.executionState == TargetExecutionState::STOPPED
+                ? TargetControllerComponent::EXECUTION_STATE_POLL_INTERVAL_STOPPED
+                : TargetControllerComponent::EXECUTION_STATE_POLL_INTERVAL_MIN;
+            this->lastExecutionStatePoll = std::chrono::steady_clock::now();
+        }
+
         if (newState != previousState) {
             EventManager::triggerEvent(std::make_shared<TargetStateChanged>(*(this->targetState), previousState));
         }
     }
 
+    std::chrono::milliseconds TargetControllerComponent::pollExecutionState() {
+        const auto now = std::chrono::steady_clock::now();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            now - this->lastExecutionStatePoll
+        );
+
+        if (elapsed < this->executionStatePollInterval) {
+            return this->executionStatePollInterval - elapsed;
+        }
+
+        this->lastExecutionStatePoll = now;
+
+        if (this->targetState->executionState != TargetExecutionState::STOPPED) {
+            this->executionStatePollInterval = std::min(
+                this->executionStatePollInterval * 2,
+                TargetControllerComponent::EXECUTION_STATE_POLL_INTERVAL_MAX
+            );
+        }
+
+        // This may reset the poll interval, if the execution state has changed. See updateTargetState()
+        this->refreshExecutionState();
+
+        return this->executionStatePollInterval;
+    }
+
     void TargetControllerComponent::stopTarget() {
         if (this->target->getExecutionState() != TargetExecutionState::STOPPED) {
             this->target->stop();
@@ -692,17 +759,88 @@ namespace TargetController
 
     void TargetControllerComponent::resetTarget() {
         this->target->reset();
+        this->invalidateHaltedStateCache();
         EventManager::triggerEvent(std::make_shared<Events::TargetReset>());
     }
 
     TargetRegisterDescriptorAndValuePairs TargetControllerComponent::readTargetRegisters(
         const TargetRegisterDescriptors& descriptors
     ) {
-        return this->target->readRegisters(descriptors);
+        if (!this->haltedStateCacheActive()) {
+            return this->target->readRegisters(descriptors);
+        }
+
+        auto& cachedValuesById = this->haltedRegisterValuesById;
+        auto& stats = this->haltedStateCacheStats;
+
+        auto descriptorsToRead = TargetRegisterDescriptors{};
+        for (const auto* descriptor : descriptors) {
+            if (!TargetControllerComponent::haltedStateCacheable(*descriptor)) {
+                descriptorsToRead.push_back(descriptor);
+                continue;
+            }
+
+            if (cachedValuesById.contains(descriptor->id)) {
+                ++(stats.registerReadHits);
+                continue;
+            }
+
+            ++(stats.registerReadMisses);
+            descriptorsToRead.push_back(descriptor);
+        }
+
+        if (descriptorsToRead.empty()) {
+            auto output = TargetRegisterDescriptorAndValuePairs{};
+            output.reserve(descriptors.size());
+
+            for (const auto* descriptor : descriptors) {
+                output.emplace_back(*descriptor, cachedValuesById.at(descriptor->id));
+            }
+
+            return output;
+        }
+
+        auto readValuesById = std::map<TargetRegisterId, TargetMemoryBuffer>{};
+        for (auto& [descriptor, value] : this->target->readRegisters(descriptorsToRead)) {
+            if (TargetControllerComponent::haltedStateCacheable(descriptor)) {
+                cachedValuesById[descriptor.id] = value;
+            }
+
+            readValuesById.emplace(descriptor.id, std::move(value));
+        }
+
+        // Preserve the order of the given descriptors
+        auto output = TargetRegisterDescriptorAndValuePairs{};
+        output.reserve(descriptors.size());
+
+        for (const auto* descriptor : descriptors) {
+            const auto readValueIt = readValuesById.find(descriptor->id);
+            output.emplace_back(
+                *descriptor,
+                readValueIt != readValuesById.end() ? readValueIt->second : cachedValuesById.at(descriptor->id)
+            );
+        }
+
+        return output;
     }
 
     void TargetControllerComponent::writeTargetRegisters(const TargetRegisterDescriptorAndValuePairs& registers) {
         this->target->writeRegisters(registers);
+
+        if (this->haltedStateCacheActive()) {
+            /*
+             * Some registers are mapped to memory (e.g. the GPRs on AVR targets), so we can't keep any cached memory
+             * after a register write.
+             */
+            this->haltedMemoryCachesBySegmentId.clear();
+
+            for (const auto& [descriptor, value] : registers) {
+                if (TargetControllerComponent::haltedStateCacheable(descriptor)) {
+                    this->haltedRegisterValuesById[descriptor.id] = value;
+                }
+            }
+        }
+
         EventManager::triggerEvent(std::make_shared<Events::RegistersWrittenToTarget>(registers));
     }
 
@@ -721,33 +859,42 @@ namespace TargetController
         ) {
             auto& cache = this->getProgramMemoryCache(memorySegmentDescriptor);
 
-            if (!cache.contains(startAddress, bytes)) {
-                Logger::debug(
-                    "Program memory cache miss at 0x" + Services::StringService::toHex(startAddress) + ", "
-                        + std::to_string(bytes) + " bytes"
-                );
+            this->populateMemoryCache(
+                cache,
+                addressSpaceDescriptor,
+                startAddress,
+                bytes,
+                excludedAddressRanges,
+                memorySegmentDescriptor.pageSize.value_or(1)
+            );
 
-                /*
-                 * TODO: We're currently ignoring excludedAddressRanges when populating the program
-                 *       memory cache. This isn't a big deal, so I'll sort it later.
-                 */
-                cache.insert(
-                    startAddress,
-                    this->target->readMemory(
-                        addressSpaceDescriptor,
-                        memorySegmentDescriptor,
-                        startAddress,
-                        std::max(
-                            bytes,
-                            memorySegmentDescriptor.pageSize.value_or(0)
-                        ),
-                        {}
-                    )
-                );
+            return cache.fetch(startAddress, bytes, excludedAddressRanges);
+        }
+
+        if (
+            !bypassCache
+            && this->haltedStateCacheActive()
+            && TargetControllerComponent::haltedStateCacheable(memorySegmentDescriptor)
+        ) {
+            auto& cache = this->getHaltedMemoryCache(memorySegmentDescriptor);
+
+            const auto targetReads = this->populateMemoryCache(
+                cache,
+                addressSpaceDescriptor,
+                startAddress,
+                bytes,
+                excludedAddressRanges,
+                1
+            );
+
+            if (targetReads > 0) {
+                ++(this->haltedStateCacheStats.memoryReadMisses);
+
+            } else {
+                ++(this->haltedStateCacheStats.memoryReadHits);
             }
 
-            const auto cachedData = cache.fetch(startAddress, bytes);
-            return TargetMemoryBuffer{cachedData.begin(), cachedData.end()};
+            return cache.fetch(startAddress, bytes, excludedAddressRanges);
         }
 
         return this->target->readMemory(
@@ -759,6 +906,114 @@ namespace TargetController
         );
     }
 
+    std::size_t TargetControllerComponent::populateMemoryCache(
+        TargetMemoryCache& cache,
+        const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges,
+        TargetMemorySize alignTo
+    ) {
+        using Services::AlignmentService;
+
+        const auto& memorySegmentDescriptor = cache.memorySegmentDescriptor;
+        const auto& segmentRange = memorySegmentDescriptor.addressRange;
+        const auto prefetchEnabled = this->environmentConfig.targetConfig.memoryPrefetch;
+        auto missingRanges = cache.missingRanges(startAddress, bytes, excludedAddressRanges);
+
+        if (missingRanges.empty()) {
+            if (prefetchEnabled && this->memoryPrefetcher.recordHit(addressSpaceDescriptor, startAddress, bytes)) {
+                ++(this->haltedStateCacheStats.prefetchHits);
+            }
+
+            return 0;
+        }
+
+        if (prefetchEnabled) {
+            const auto prefetchRange = this->memoryPrefetcher.recordMiss(
+                addressSpaceDescriptor,
+                memorySegmentDescriptor,
+                startAddress,
+                bytes,
+                this->memoryPrefetchSize(addressSpaceDescriptor, memorySegmentDescriptor)
+            );
+
+            if (prefetchRange.has_value()) {
+                // The prefetch range is adjacent to the requested range, so we can read both in one operation
+                const auto extendedStartAddress = std::min(startAddress, prefetchRange->startAddress);
+                const auto extendedEndAddress = std::max(
+                    static_cast<TargetMemoryAddress>(startAddress + bytes - 1),
+                    prefetchRange->endAddress
+                );
+
+                missingRanges = cache.missingRanges(
+                    extendedStartAddress,
+                    extendedEndAddress - extendedStartAddress + 1,
+                    excludedAddressRanges
+                );
+
+                ++(this->haltedStateCacheStats.prefetches);
+                this->haltedStateCacheStats.prefetchedBytes += prefetchRange->size();
+            }
+        }
+
+        auto readRange = std::optional<TargetMemoryAddressRange>{};
+        auto targetReads = std::size_t{0};
+
+        const auto commitReadRange = [&] {
+            Logger::debug(
+                "Memory cache miss at 0x" + Services::StringService::toHex(readRange->startAddress) + ", "
+                    + std::to_string(readRange->size()) + " bytes"
+            );
+
+            cache.insert(
+                readRange->startAddress,
+                this->target->readMemory(
+                    addressSpaceDescriptor,
+                    memorySegmentDescriptor,
+                    readRange->startAddress,
+                    readRange->size(),
+                    excludedAddressRanges
+                ),
+                excludedAddressRanges
+            );
+
+            ++targetReads;
+        };
+
+        for (const auto& missingRange : missingRanges) {
+            /*
+             * We align the missing range to the given boundary, within the segment. Neighbouring ranges that
+             * touch or overlap after alignment are combined into a single read.
+             */
+            auto alignedRange = alignTo > 1
+                ? AlignmentService::alignAddressRange(missingRange, alignTo)
+                : missingRange;
+            alignedRange.startAddress = std::max(alignedRange.startAddress, segmentRange.startAddress);
+            alignedRange.endAddress = std::min(alignedRange.endAddress, segmentRange.endAddress);
+
+            if (
+                readRange.has_value()
+                && static_cast<std::uint64_t>(readRange->endAddress) + 1 >= alignedRange.startAddress
+            ) {
+                readRange->endAddress = std::max(readRange->endAddress, alignedRange.endAddress);
+                continue;
+            }
+
+            if (readRange.has_value()) {
+                commitReadRange();
+            }
+
+            readRange = alignedRange;
+        }
+
+        if (readRange.has_value()) {
+            commitReadRange();
+        }
+
+        return targetReads;
+    }
+
     void TargetControllerComponent::writeTargetMemory(
         const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
         const TargetMemorySegmentDescriptor& memorySegmentDescriptor,
@@ -776,8 +1031,13 @@ namespace TargetController
             throw Exception{"Cannot write to program memory - programming mode not enabled."};
         }
 
+        const auto writeStartTime = std::chrono::steady_clock::now();
         this->target->writeMemory(addressSpaceDescriptor, memorySegmentDescriptor, startAddress, buffer);
 
+        if (isProgramMemory) {
+            this->recordProgrammingWrite(writeStartTime, buffer.size());
+        }
+
         if (
             isProgramMemory
             && (
@@ -788,6 +1048,15 @@ namespace TargetController
             this->getProgramMemoryCache(memorySegmentDescriptor).insert(startAddress, buffer);
         }
 
+        if (this->haltedStateCacheActive()) {
+            // Memory writes can affect memory-mapped registers - see writeTargetRegisters()
+            this->haltedRegisterValuesById.clear();
+
+            if (TargetControllerComponent::haltedStateCacheable(memorySegmentDescriptor)) {
+                this->getHaltedMemoryCache(memorySegmentDescriptor).insert(startAddress, buffer);
+            }
+        }
+
         EventManager::triggerEvent(
             std::make_shared<Events::MemoryWrittenToTarget>(
                 addressSpaceDescriptor,
@@ -802,12 +1071,14 @@ namespace TargetController
         const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
         const TargetMemorySegmentDescriptor& memorySegmentDescriptor
     ) {
-        if (this->target->isProgramMemory(
+        const auto isProgramMemory = this->target->isProgramMemory(
             addressSpaceDescriptor,
             memorySegmentDescriptor,
             memorySegmentDescriptor.addressRange.startAddress,
             memorySegmentDescriptor.addressRange.size()
-        )) {
+        );
+
+        if (isProgramMemory) {
             if (!this->target->programmingModeEnabled()) {
                 throw Exception{"Cannot erase program memory - programming mode not enabled."};
             }
@@ -821,7 +1092,32 @@ namespace TargetController
             }
         }
 
+        const auto eraseStartTime = std::chrono::steady_clock::now();
         this->target->eraseMemory(addressSpaceDescriptor, memorySegmentDescriptor);
+
+        if (isProgramMemory && this->programmingSessionStats.has_value()) {
+            this->programmingSessionStats->eraseDuration += std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - eraseStartTime
+            );
+            ++(this->programmingSessionStats->eraseOperations);
+        }
+
+        this->haltedMemoryCachesBySegmentId.erase(memorySegmentDescriptor.id);
+    }
+
+    void TargetControllerComponent::recordProgrammingWrite(
+        std::chrono::steady_clock::time_point startTime,
+        std::size_t bytes
+    ) {
+        if (!this->programmingSessionStats.has_value()) {
+            return;
+        }
+
+        this->programmingSessionStats->writeDuration += std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - startTime
+        );
+        this->programmingSessionStats->writtenBytes += bytes;
+        ++(this->programmingSessionStats->writeOperations);
     }
 
     std::uint32_t TargetControllerComponent::availableHardwareBreakpoints() {
@@ -942,10 +1238,17 @@ namespace TargetController
     }
 
     void TargetControllerComponent::enableProgrammingMode() {
+        const auto startTime = std::chrono::steady_clock::now();
+        const auto startUsbTransferCount = Usb::UsbTrace::transferCount();
+
         Logger::debug("Enabling programming mode");
         this->target->enableProgrammingMode();
         Logger::warning("Programming mode enabled");
 
+        this->programmingSessionStats = ProgrammingSessionStats{};
+        this->programmingSessionStartTime = startTime;
+        this->programmingSessionStartUsbTransferCount = startUsbTransferCount;
+
         if (this->environmentConfig.targetConfig.deltaProgramming && this->deltaProgrammingInterface != nullptr) {
             this->deltaProgrammingSession = DeltaProgramming::Session{};
         }
@@ -956,6 +1259,11 @@ namespace TargetController
     }
 
     void TargetControllerComponent::disableProgrammingMode() {
+        const auto finaliseStartTime = std::chrono::steady_clock::now();
+        const auto writeDurationBeforeFinalise = this->programmingSessionStats.has_value()
+            ? this->programmingSessionStats->writeDuration
+            : std::chrono::microseconds{0};
+
         if (this->deltaProgrammingSession.has_value()) {
             const auto session = std::move(*(this->deltaProgrammingSession));
             this->deltaProgrammingSession = std::nullopt;
@@ -969,7 +1277,7 @@ namespace TargetController
         Logger::info("Restoring breakpoints");
         this->target->stop();
 
-        static const auto refreshOriginalData = [this] (TargetProgramBreakpoint& breakpoint) {
+        const auto refreshOriginalData = [this] (TargetProgramBreakpoint& breakpoint) {
             const auto originalData = this->readTargetMemory(
                 breakpoint.addressSpaceDescriptor,
                 breakpoint.memorySegmentDescriptor,
@@ -1008,6 +1316,31 @@ namespace TargetController
             }
         }
 
+        if (this->programmingSessionStats.has_value()) {
+            auto sessionStats = *(this->programmingSessionStats);
+            this->programmingSessionStats = std::nullopt;
+
+            const auto endTime = std::chrono::steady_clock::now();
+            sessionStats.totalDuration = std::chrono::duration_cast<std::chrono::microseconds>(
+                endTime - this->programmingSessionStartTime
+            );
+            sessionStats.finaliseDuration = std::chrono::duration_cast<std::chrono::microseconds>(
+                endTime - finaliseStartTime
+            ) - (sessionStats.writeDuration - writeDurationBeforeFinalise);
+            sessionStats.usbTransfers = Usb::UsbTrace::transferCount()
+                - this->programmingSessionStartUsbTransferCount;
+
+            ++(this->programmingStats.sessionCount);
+            this->programmingStats.totals += sessionStats;
+            this->programmingStats.lastSession = sessionStats;
+
+            Logger::info(
+                "Programming session complete - " + std::to_string(sessionStats.requestedBytes) + " byte(s) requested, "
+                    + std::to_string(sessionStats.writtenBytes) + " byte(s) written, in "
+                    + std::to_string(sessionStats.totalDuration.count() / 1000) + " ms"
+            );
+        }
+
         auto newState = *(this->targetState);
         newState.mode = TargetMode::DEBUGGING;
         newState.executionState = TargetExecutionState::STOPPED;
@@ -1029,6 +1362,69 @@ namespace TargetController
         return cacheIt->second;
     }
 
+    TargetMemorySize TargetControllerComponent::memoryPrefetchSize(
+        const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+        const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+    ) {
+        const auto toolMaximum = this->target->maximumMemoryReadSize(addressSpaceDescriptor, memorySegmentDescriptor);
+        const auto& configMaximum = this->environmentConfig.targetConfig.memoryPrefetchMaxSize;
+
+        return configMaximum.has_value() ? std::min(toolMaximum, *configMaximum) : toolMaximum;
+    }
+
+    bool TargetControllerComponent::haltedStateCacheActive() const {
+        return this->environmentConfig.targetConfig.haltedStateCache
+            && this->targetState->executionState == TargetExecutionState::STOPPED
+            && this->targetState->mode == TargetMode::DEBUGGING;
+    }
+
+    bool TargetControllerComponent::haltedStateCacheable(
+        const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+    ) {
+        switch (memorySegmentDescriptor.type) {
+            case TargetMemorySegmentType::RAM:
+            case TargetMemorySegmentType::EEPROM:
+            case TargetMemorySegmentType::GENERAL_PURPOSE_REGISTERS: {
+                return true;
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+
+    bool TargetControllerComponent::haltedStateCacheable(const TargetRegisterDescriptor& registerDescriptor) {
+        // CPU registers only - peripherals may continue to run whilst the CPU is stopped
+        return registerDescriptor.type == TargetRegisterType::GENERAL_PURPOSE_REGISTER
+            || registerDescriptor.peripheralKey == "cpu";
+    }
+
+    TargetMemoryCache& TargetControllerComponent::getHaltedMemoryCache(
+        const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+    ) {
+        auto cacheIt = this->haltedMemoryCachesBySegmentId.find(memorySegmentDescriptor.id);
+
+        if (cacheIt == this->haltedMemoryCachesBySegmentId.end()) {
+            cacheIt = this->haltedMemoryCachesBySegmentId.emplace(
+                memorySegmentDescriptor.id,
+                TargetMemoryCache{memorySegmentDescriptor}
+            ).first;
+        }
+
+        return cacheIt->second;
+    }
+
+    void TargetControllerComponent::invalidateHaltedStateCache() {
+        if (this->haltedMemoryCachesBySegmentId.empty() && this->haltedRegisterValuesById.empty()) {
+            return;
+        }
+
+        this->haltedMemoryCachesBySegmentId.clear();
+        this->haltedRegisterValuesById.clear();
+        this->memoryPrefetcher.clearPrefetchedRanges();
+        ++(this->haltedStateCacheStats.invalidations);
+    }
+
     void TargetControllerComponent::commitDeltaProgrammingSession(const DeltaProgramming::Session& session) {
         using Services::AlignmentService;
         using Services::StringService;
@@ -1101,7 +1497,7 @@ namespace TargetController
              * For this reason, we make a copy of the program memory cache and strip any software breakpoints from it,
              * before constructing the delta segments.
              */
-            auto cacheData = segmentCache.data;
+            auto cacheData = segmentCache.dump();
             for (const auto& breakpointsByAddress : this->softwareBreakpointRegistry | std::views::values) {
                 for (const auto& breakpoint : breakpointsByAddress | std::views::values) {
                     if (breakpoint.memorySegmentDescriptor != writeOperation.memorySegmentDescriptor) {
@@ -1157,12 +1553,14 @@ namespace TargetController
                         + " -> 0x" + StringService::toHex(deltaSegment.addressRange.endAddress) + " - "
                         + std::to_string(deltaSegment.buffer.size()) + " byte(s)"
                 );
+                const auto writeStartTime = std::chrono::steady_clock::now();
                 this->target->writeMemory(
                     operation.addressSpaceDescriptor,
                     operation.memorySegmentDescriptor,
                     deltaSegment.addressRange.startAddress,
                     deltaSegment.buffer
                 );
+                this->recordProgrammingWrite(writeStartTime, deltaSegment.buffer.size());
 
                 segmentCache.insert(deltaSegment.addressRange.startAddress, deltaSegment.buffer);
             }
@@ -1270,6 +1668,17 @@ namespace TargetController
             throw Exception{"Invalid address range"};
         }
 
+        const auto targetRunning = this->targetState->executionState != TargetExecutionState::STOPPED;
+        if (
+            targetRunning
+            && !this->target->canReadMemoryWhileRunning(
+                command.addressSpaceDescriptor,
+                command.memorySegmentDescriptor
+            )
+        ) {
+            throw Exception{"Command rejected - command requires target execution to be stopped"};
+        }
+
         return std::make_unique<TargetMemoryRead>(
             this->readTargetMemory(
                 command.addressSpaceDescriptor,
@@ -1277,7 +1686,8 @@ namespace TargetController
                 command.startAddress,
                 command.bytes,
                 command.excludedAddressRanges,
-                command.bypassCache
+                // The target may be modifying its memory as we read it, so we don't cache anything
+                command.bypassCache || targetRunning
             )
         );
     }
@@ -1299,6 +1709,18 @@ namespace TargetController
             throw Exception{"Invalid address range"};
         }
 
+        if (
+            this->programmingSessionStats.has_value()
+            && this->target->isProgramMemory(
+                command.addressSpaceDescriptor,
+                command.memorySegmentDescriptor,
+                command.startAddress,
+                static_cast<TargetMemorySize>(command.buffer.size())
+            )
+        ) {
+            this->programmingSessionStats->requestedBytes += command.buffer.size();
+        }
+
         if (
             this->targetState->mode == TargetMode::PROGRAMMING
             && this->deltaProgrammingSession.has_value()
@@ -1406,6 +1828,7 @@ namespace TargetController
 
     std::unique_ptr<Response> TargetControllerComponent::handleSetProgramCounter(SetTargetProgramCounter& command) {
         this->target->setProgramCounter(command.address);
+        this->haltedRegisterValuesById.clear();
 
         auto newState = *(this->targetState);
         newState.programCounter = this->target->getProgramCounter();
@@ -1416,6 +1839,7 @@ namespace TargetController
 
     std::unique_ptr<Response> TargetControllerComponent::handleSetStackPointer(SetTargetStackPointer& command) {
         this->target->setStackPointer(command.stackPointer);
+        this->haltedRegisterValuesById.clear();
         return std::make_unique<Response>();
     }
 
@@ -1467,6 +1891,41 @@ namespace TargetController
     std::unique_ptr<TargetPassthroughResponse> TargetControllerComponent::handleTargetPassthroughCommand(
         InvokeTargetPassthroughCommand& command
     ) {
+        // We have no idea what the passthrough command will do to the target
+        this->invalidateHaltedStateCache();
         return std::make_unique<TargetPassthroughResponse>(this->target->invokePassthroughCommand(command.command));
     }
+
+    std::unique_ptr<CommandBatchResponses> TargetControllerComponent::handleExecuteCommandBatch(
+        ExecuteCommandBatch& command
+    ) {
+        if (command.commands.empty()) {
+            throw Exception{"Empty command batch"};
+        }
+
+        auto responses = std::vector<std::unique_ptr<Response>>{};
+        responses.reserve(command.commands.size());
+
+        for (auto& batchedCommand : command.commands) {
+            if (!ExecuteCommandBatch::batchable(*batchedCommand)) {
+                throw Exception{"Command rejected - command cannot be batched"};
+            }
+
+            responses.emplace_back(this->handleCommand(*batchedCommand));
+        }
+
+        return std::make_unique<CommandBatchResponses>(std::move(responses));
+    }
+
+    std::unique_ptr<HaltedStateCacheStatsResponse> TargetControllerComponent::handleGetHaltedStateCacheStats(
+        GetHaltedStateCacheStats& command
+    ) {
+        return std::make_unique<HaltedStateCacheStatsResponse>(this->haltedStateCacheStats);
+    }
+
+    std::unique_ptr<ProgrammingStatsResponse> TargetControllerComponent::handleGetProgrammingStats(
+        GetProgrammingStats& command
+    ) {
+        return std::make_unique<ProgrammingStatsResponse>(this->programmingStats);
+    }
 }
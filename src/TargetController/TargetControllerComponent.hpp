@@ -9,14 +9,18 @@
 #include <map>
 #include <string>
 #include <functional>
+#include <future>
 #include <QJsonObject>
 #include <QJsonArray>
 
 #include "src/Helpers/Thread.hpp"
-#include "src/Helpers/Synchronised.hpp"
+#include "src/Helpers/MpscQueue.hpp"
 #include "src/Helpers/ConditionVariableNotifier.hpp"
 
 #include "TargetControllerState.hpp"
+#include "HaltedStateCacheStats.hpp"
+#include "ProgrammingStats.hpp"
+#include "MemoryPrefetcher.hpp"
 #include "AtomicSession.hpp"
 
 // Commands
@@ -47,6 +51,9 @@
 #include "Commands/DisableProgrammingMode.hpp"
 #include "Commands/GetTargetPassthroughHelpText.hpp"
 #include "Commands/InvokeTargetPassthroughCommand.hpp"
+#include "Commands/ExecuteCommandBatch.hpp"
+#include "Commands/GetHaltedStateCacheStats.hpp"
+#include "Commands/GetProgrammingStats.hpp"
 
 // Responses
 #include "Responses/Response.hpp"
@@ -61,6 +68,9 @@
 #include "Responses/ProgramBreakpoint.hpp"
 #include "Responses/TargetPassthroughHelpText.hpp"
 #include "Responses/TargetPassthroughResponse.hpp"
+#include "Responses/CommandBatchResponses.hpp"
+#include "Responses/HaltedStateCacheStatsResponse.hpp"
+#include "Responses/ProgrammingStatsResponse.hpp"
 
 #include "src/DebugToolDrivers/DebugTools.hpp"
 #include "src/Targets/BriefTargetDescriptor.hpp"
@@ -92,6 +102,9 @@ namespace TargetController
      *
      * The TargetController should be oblivious to any manufacture/device specific functionality. It should
      * only ever interface with the base Target and DebugTool classes.
+     *
+     * Each instance serves a single environment (one debug tool and target). Multiple instances can run
+     * concurrently, on their own threads - see ProjectConfig::concurrentEnvironmentNames.
      */
     class TargetControllerComponent: public Thread
     {
@@ -106,18 +119,71 @@ namespace TargetController
          */
         void run();
 
-        static void registerCommand(
+        /**
+         * Places the given command in the appropriate queue, for the TargetController to process.
+         *
+         * @param command
+         * @param atomicSessionId
+         *
+         * @return
+         *  A future for the command's response. This should be passed to TargetControllerComponent::waitForResponse().
+         */
+        std::future<std::unique_ptr<Responses::Response>> registerCommand(
             std::unique_ptr<Commands::Command> command,
             const std::optional<AtomicSessionIdType>& atomicSessionId
         );
 
+        /**
+         * Waits for the TargetController to respond to a command.
+         *
+         * Each command has its own response slot, so only the thread waiting on the given future will be woken when
+         * the response is delivered.
+         *
+         * @param responseFuture
+         *  The future returned by TargetControllerComponent::registerCommand().
+         *
+         * @param timeout
+         *
+         * @return
+         *  The response, or std::nullopt if the timeout was reached.
+         */
         static std::optional<std::unique_ptr<Responses::Response>> waitForResponse(
-            Commands::CommandIdType commandId,
+            std::future<std::unique_ptr<Responses::Response>>& responseFuture,
             std::optional<std::chrono::milliseconds> timeout = std::nullopt
         );
 
     private:
-        static inline Synchronised<std::queue<std::unique_ptr<Commands::Command>>> commandQueue;
+        /**
+         * None of the debug tools we support can notify us of a change in the target's execution state (e.g. when
+         * a breakpoint is hit). We have to poll the tool for it.
+         *
+         * Immediately after the target is resumed or stepped, we poll at EXECUTION_STATE_POLL_INTERVAL_MIN. The
+         * interval is doubled after each poll, until it reaches EXECUTION_STATE_POLL_INTERVAL_MAX. This means short
+         * runs (stepping over a function call, hitting a nearby breakpoint, etc) are reported almost immediately,
+         * whilst long runs don't flood the USB link with state queries.
+         *
+         * Whilst the target is stopped, its execution state can only change under unusual circumstances (e.g. an
+         * external reset), so we poll at a much lower rate. Commands and events will still wake the TargetController
+         * immediately, as they're delivered via the same notifier.
+         */
+        static constexpr auto EXECUTION_STATE_POLL_INTERVAL_MIN = std::chrono::milliseconds{1};
+        static constexpr auto EXECUTION_STATE_POLL_INTERVAL_MAX = std::chrono::milliseconds{60};
+        static constexpr auto EXECUTION_STATE_POLL_INTERVAL_STOPPED = std::chrono::milliseconds{500};
+
+        /**
+         * A command awaiting processing, along with the promise for its response.
+         */
+        struct QueuedCommand
+        {
+            std::unique_ptr<Commands::Command> command;
+            std::promise<std::unique_ptr<Responses::Response>> responsePromise;
+        };
+
+        /**
+         * Commands can be issued from any thread (the DebugServer, Insight workers, etc), but they're only ever
+         * consumed by the TargetController thread, so we use lock-free MPSC queues.
+         */
+        MpscQueue<QueuedCommand> commandQueue;
 
         /**
          * We have a dedicated queue for atomic sessions.
@@ -125,16 +191,11 @@ namespace TargetController
          * During an atomic session, all commands for the session are placed into this dedicated queue.
          * The TargetController will only serve commands from this dedicated queue, until the atomic session ends.
          */
-        static inline Synchronised<std::queue<std::unique_ptr<Commands::Command>>> atomicSessionCommandQueue;
+        MpscQueue<QueuedCommand> atomicSessionCommandQueue;
 
-        static inline Synchronised<
-            std::map<Commands::CommandIdType, std::unique_ptr<Responses::Response>>
-        > responsesByCommandId;
+        ConditionVariableNotifier notifier = {};
 
-        static inline ConditionVariableNotifier notifier = {};
-        static inline std::condition_variable responsesByCommandIdCv = {};
-
-        static inline std::atomic<TargetControllerState> state = TargetControllerState::INACTIVE;
+        std::atomic<TargetControllerState> state = TargetControllerState::INACTIVE;
 
         ProjectConfig projectConfig;
         EnvironmentConfig environmentConfig;
@@ -156,6 +217,16 @@ namespace TargetController
         std::unique_ptr<const Targets::TargetDescriptor> targetDescriptor = nullptr;
         std::unique_ptr<Targets::TargetState> targetState = nullptr;
 
+        /**
+         * The current execution state poll interval. See EXECUTION_STATE_POLL_INTERVAL_MIN for more.
+         */
+        std::chrono::milliseconds executionStatePollInterval = EXECUTION_STATE_POLL_INTERVAL_MIN;
+
+        /**
+         * The time at which we last polled the target's execution state.
+         */
+        std::chrono::steady_clock::time_point lastExecutionStatePoll = {};
+
         /**
          * Target register descriptors mapped by the address space key
          */
@@ -174,6 +245,34 @@ namespace TargetController
          */
         std::map<Targets::TargetMemorySegmentId, Targets::TargetMemoryCache> programMemoryCachesBySegmentId;
 
+        /**
+         * The halted state cache.
+         *
+         * Whilst the target is stopped, the contents of its RAM, EEPROM and CPU registers can only be changed by us.
+         * So, if halted state caching is enabled, we cache the data from any reads of these, until the target leaves
+         * the stopped state, is reset, or we perform an operation with unknown side effects (passthrough commands).
+         * Writes are applied to the cache as well as the target.
+         *
+         * Peripheral registers and IO memory are never cached, as peripherals can continue to run whilst the CPU is
+         * stopped, and reading them can have side effects.
+         *
+         * See TargetControllerComponent::haltedStateCacheable() for which segments and registers are cached.
+         */
+        std::map<Targets::TargetMemorySegmentId, Targets::TargetMemoryCache> haltedMemoryCachesBySegmentId;
+        std::map<Targets::TargetRegisterId, Targets::TargetMemoryBuffer> haltedRegisterValuesById;
+        HaltedStateCacheStats haltedStateCacheStats;
+
+        /**
+         * Programming throughput figures. programmingSessionStats is only populated whilst programming mode is
+         * enabled - it's folded into programmingStats when programming mode is disabled.
+         */
+        ProgrammingStats programmingStats;
+        std::optional<ProgrammingSessionStats> programmingSessionStats;
+        std::chrono::steady_clock::time_point programmingSessionStartTime;
+        std::uint64_t programmingSessionStartUsbTransferCount = 0;
+
+        MemoryPrefetcher memoryPrefetcher;
+
         /**
          * Active delta programming session
          */
@@ -254,13 +353,22 @@ namespace TargetController
         void processQueuedCommands();
 
         /**
-         * Records a response for a given command ID. Notifies the TargetControllerComponent::responsesByCommandIdCv
-         * condition variable of the new response.
+         * Checks that the given command can be serviced in the current state, and invokes the registered handler.
+         *
+         * @param command
+         *
+         * @return
+         *  The handler's response.
+         */
+        std::unique_ptr<Responses::Response> handleCommand(Commands::Command& command);
+
+        /**
+         * Delivers the response for a queued command, waking the thread waiting on it (if any).
          *
-         * @param commandId
+         * @param queuedCommand
          * @param response
          */
-        void registerCommandResponse(Commands::CommandIdType commandId, std::unique_ptr<Responses::Response> response);
+        void registerCommandResponse(QueuedCommand& queuedCommand, std::unique_ptr<Responses::Response> response);
 
         /**
          * Establishes a connection with the debug tool and target. Prepares the hardware for a debug session.
@@ -279,6 +387,15 @@ namespace TargetController
         void refreshExecutionState(bool forceUpdate = false);
         void updateTargetState(const Targets::TargetState& newState);
 
+        /**
+         * Polls the target's execution state, if the current poll interval has elapsed, and determines how long the
+         * TargetController can wait for a notification before the next poll is due.
+         *
+         * @return
+         *  The maximum duration to wait for a notification.
+         */
+        std::chrono::milliseconds pollExecutionState();
+
         void stopTarget();
         void resumeTarget();
         void stepTarget();
@@ -327,6 +444,16 @@ namespace TargetController
          */
         void disableProgrammingMode();
 
+        /**
+         * Accounts for a program memory write in the active programming session's stats, if there is one.
+         *
+         * @param startTime
+         *  The point in time at which the write began.
+         *
+         * @param bytes
+         */
+        void recordProgrammingWrite(std::chrono::steady_clock::time_point startTime, std::size_t bytes);
+
         /**
          * Fetches the program memory cache object for the given memory segment. If the segment has no associated
          * cache object, one will be created.
@@ -338,6 +465,89 @@ namespace TargetController
             const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor
         );
 
+        /**
+         * Reads any data missing from the given cache, for the given range, from the target.
+         *
+         * Only the missing sub-ranges are read. Each missing sub-range is aligned to the given boundary (e.g. the
+         * memory segment's page size), and sub-ranges that touch after alignment are combined into a single read.
+         * Excluded ranges are never read, and never populated in the cache.
+         *
+         * If memory prefetching is enabled, and the MemoryPrefetcher detects an access pattern, the range will be
+         * extended to include the prefetch range.
+         *
+         * @param cache
+         * @param addressSpaceDescriptor
+         * @param startAddress
+         * @param bytes
+         * @param excludedAddressRanges
+         * @param alignTo
+         *
+         * @return
+         *  The number of read operations performed on the target. Zero means the cache already held all the data.
+         */
+        std::size_t populateMemoryCache(
+            Targets::TargetMemoryCache& cache,
+            const Targets::TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges,
+            Targets::TargetMemorySize alignTo
+        );
+
+        /**
+         * Determines the maximum size of a prefetch from the given memory segment.
+         *
+         * @param addressSpaceDescriptor
+         * @param memorySegmentDescriptor
+         * @return
+         */
+        Targets::TargetMemorySize memoryPrefetchSize(
+            const Targets::TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+            const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        );
+
+        /**
+         * Checks if the halted state cache can be used in the current state (cache enabled, target stopped and in
+         * debug mode).
+         *
+         * @return
+         */
+        [[nodiscard]] bool haltedStateCacheActive() const;
+
+        /**
+         * Checks if the given memory segment can be held in the halted state cache.
+         *
+         * @param memorySegmentDescriptor
+         * @return
+         */
+        [[nodiscard]] static bool haltedStateCacheable(
+            const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        );
+
+        /**
+         * Checks if the given register can be held in the halted state cache.
+         *
+         * @param registerDescriptor
+         * @return
+         */
+        [[nodiscard]] static bool haltedStateCacheable(const Targets::TargetRegisterDescriptor& registerDescriptor);
+
+        /**
+         * Fetches the halted state cache object for the given memory segment. If the segment has no associated
+         * cache object, one will be created.
+         *
+         * @param memorySegmentDescriptor
+         * @return
+         */
+        Targets::TargetMemoryCache& getHaltedMemoryCache(
+            const Targets::TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        );
+
+        /**
+         * Discards everything held in the halted state cache.
+         */
+        void invalidateHaltedStateCache();
+
         void commitDeltaProgrammingSession(const Targets::DeltaProgramming::Session& session);
         void abandonDeltaProgrammingSession(const Targets::DeltaProgramming::Session& session);
 
@@ -389,5 +599,14 @@ namespace TargetController
         std::unique_ptr<Responses::TargetPassthroughResponse> handleTargetPassthroughCommand(
             Commands::InvokeTargetPassthroughCommand& command
         );
+        std::unique_ptr<Responses::CommandBatchResponses> handleExecuteCommandBatch(
+            Commands::ExecuteCommandBatch& command
+        );
+        std::unique_ptr<Responses::HaltedStateCacheStatsResponse> handleGetHaltedStateCacheStats(
+            Commands::GetHaltedStateCacheStats& command
+        );
+        std::unique_ptr<Responses::ProgrammingStatsResponse> handleGetProgrammingStats(
+            Commands::GetProgrammingStats& command
+        );
     };
 }
@@ -487,6 +487,20 @@ namespace Targets::Microchip::Avr8
         );
     }
 
+    TargetMemorySize Avr8::maximumMemoryReadSize(
+        const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+        const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+    ) {
+        return this->avr8DebugInterface->maximumMemoryReadSize(memorySegmentDescriptor);
+    }
+
+    bool Avr8::canReadMemoryWhileRunning(
+        const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+        const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+    ) {
+        return false;
+    }
+
     TargetExecutionState Avr8::getExecutionState() {
         return this->avr8DebugInterface->getExecutionState();
     }
@@ -95,6 +95,14 @@ namespace Targets::Microchip::Avr8
             const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
             const TargetMemorySegmentDescriptor& memorySegmentDescriptor
         ) override;
+        TargetMemorySize maximumMemoryReadSize(
+            const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+            const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        ) override;
+        bool canReadMemoryWhileRunning(
+            const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+            const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        ) override;
 
         TargetExecutionState getExecutionState() override;
 
@@ -1,6 +1,7 @@
 #include "Decoder.hpp"
 
 #include <iterator>
+#include <algorithm>
 
 #include "Opcodes.hpp"
 
@@ -8,206 +9,272 @@
 
 namespace Targets::Microchip::Avr8::OpcodeDecoder
 {
+    Decoder::InstructionMapping::const_iterator Decoder::InstructionMapping::find(
+        Targets::TargetMemoryAddress byteAddress
+    ) const {
+        const auto entryIt = std::lower_bound(
+            this->entries.begin(),
+            this->entries.end(),
+            byteAddress,
+            [] (const Entry& entry, Targets::TargetMemoryAddress address) {
+                return entry.first < address;
+            }
+        );
+
+        return entryIt != this->entries.end() && entryIt->first == byteAddress ? entryIt : this->entries.end();
+    }
+
     Decoder::InstructionMapping Decoder::decode(
         Targets::TargetMemoryAddress startByteAddress,
         const TargetMemoryBuffer& data,
         bool throwOnFailure
     ) {
         auto output = Decoder::InstructionMapping{};
-
-        static const auto decoders = Decoder::opcodeDecoders();
+        output.entries.reserve(data.size() / 2);
 
         auto instructionByteAddress = startByteAddress;
         auto dataIt = data.begin();
         const auto dataEndIt = data.end();
 
         while (std::distance(dataIt, dataEndIt) >= 2) {
-            auto opcodeMatched = false;
+            auto instruction = Decoder::decodeOpcode(dataIt, dataEndIt);
 
-            for (const auto& decoder : decoders) {
-                auto instruction = decoder(dataIt, dataEndIt);
+            if (instruction.has_value()) {
+                const auto instructionSize = instruction->byteSize;
+                output.entries.emplace_back(instructionByteAddress, std::move(instruction));
 
-                if (instruction.has_value()) {
-                    const auto instructionSize = instruction->byteSize;
-                    output.emplace(instructionByteAddress, std::move(*instruction));
+                dataIt += instructionSize;
+                instructionByteAddress += instructionSize;
+                continue;
+            }
 
-                    dataIt += instructionSize;
-                    instructionByteAddress += instructionSize;
-                    opcodeMatched = true;
-                    break;
-                }
+            if (throwOnFailure) {
+                throw Exceptions::DecodeFailure{
+                    instructionByteAddress,
+                    static_cast<std::uint32_t>(*(dataIt + 1) << 8) | *dataIt
+                };
             }
 
-            if (!opcodeMatched) {
-                if (throwOnFailure) {
-                    throw Exceptions::DecodeFailure{
-                        instructionByteAddress,
-                        static_cast<std::uint32_t>(*(dataIt + 1) << 8) | *dataIt
-                    };
-                }
+            output.entries.emplace_back(instructionByteAddress, std::nullopt);
+
+            dataIt += 2;
+            instructionByteAddress += 2;
+        }
+
+        return output;
+    }
+
+    std::optional<Instruction> Decoder::decodeOpcode(
+        const TargetMemoryBuffer::const_iterator& dataBegin,
+        const TargetMemoryBuffer::const_iterator& dataEnd
+    ) {
+        const auto& decoders = Decoder::opcodeDecoders();
+
+        const auto firstWord = static_cast<std::uint16_t>(*(dataBegin + 1) << 8 | *dataBegin);
+        const auto firstDecoderIndex = Decoder::dispatchTable()[firstWord];
 
-                output.emplace(instructionByteAddress, std::nullopt);
+        if (firstDecoderIndex == Decoder::NO_DECODER) {
+            return std::nullopt;
+        }
+
+        /*
+         * Typically, the first candidate will accept the opcode. If it doesn't, we fall back to trying the remaining
+         * decoders, in order.
+         */
+        for (auto decoderIndex = std::size_t{firstDecoderIndex}; decoderIndex < decoders.size(); ++decoderIndex) {
+            const auto& decoder = decoders[decoderIndex];
+            if ((firstWord & decoder.firstWordMask) != decoder.expectedFirstWord) {
+                continue;
+            }
 
-                dataIt += 2;
-                instructionByteAddress += 2;
+            auto instruction = decoder.decode(dataBegin, dataEnd);
+            if (instruction.has_value()) {
+                return instruction;
             }
         }
 
-        return output;
+        return std::nullopt;
+    }
+
+    const Decoder::DispatchTable& Decoder::dispatchTable() {
+        static const auto table = [] {
+            const auto& decoders = Decoder::opcodeDecoders();
+            static_assert(std::tuple_size_v<Decoder::OpcodeDecoders> < Decoder::NO_DECODER);
+
+            auto output = Decoder::DispatchTable{};
+            output.fill(Decoder::NO_DECODER);
+
+            for (auto word = std::uint32_t{0}; word <= 0xFFFF; ++word) {
+                for (auto decoderIndex = std::size_t{0}; decoderIndex < decoders.size(); ++decoderIndex) {
+                    const auto& decoder = decoders[decoderIndex];
+
+                    if ((word & decoder.firstWordMask) == decoder.expectedFirstWord) {
+                        output[word] = static_cast<std::uint8_t>(decoderIndex);
+                        break;
+                    }
+                }
+            }
+
+            return output;
+        }();
+
+        return table;
     }
 
-    Decoder::OpcodeDecoders Decoder::opcodeDecoders() {
+    const Decoder::OpcodeDecoders& Decoder::opcodeDecoders() {
         /*
          * The decoders will be used in the order given here.
          *
          * I've used the same order that is used in the AVR implementation of GDB.
          */
-        return Decoder::OpcodeDecoders{
-            std::bind(&Opcodes::UndefinedOrErased::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Clc::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Clh::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Cli::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Cln::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Cls::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Clt::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Clv::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Clz::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sec::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Seh::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sei::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sen::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Ses::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Set::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sev::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sez::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Bclr::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Bset::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Icall::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Ijmp::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Lpm1::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Lpm2::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Lpm3::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Elpm1::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Elpm2::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Elpm3::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Nop::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Ret::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Reti::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sleep::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Break::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Wdr::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Spm1::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Spm2::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Adc::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Add::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::And::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Cp::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Cpc::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Cpse::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Eor::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Mov::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Mul::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Or::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sbc::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sub::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Clr::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Lsl::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Rol::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Tst::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Andi::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Cbr::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Ldi::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Ser::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Ori::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sbr::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Cpi::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sbci::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Subi::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sbrc::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sbrs::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Bld::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Bst::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::In::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Out::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Adiw::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sbiw::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Cbi::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sbi::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sbic::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sbis::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brcc::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brcs::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Breq::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brge::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brhc::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brhs::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brid::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brie::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brlo::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brlt::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brmi::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brne::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brpl::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brsh::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brtc::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brts::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brvc::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brvs::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brbc::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Brbs::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Rcall::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Rjmp::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Call::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Jmp::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Asr::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Com::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Dec::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Inc::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Lsr::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Neg::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Pop::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Push::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Ror::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Swap::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Xch::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Las::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Lac::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Lat::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Movw::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Muls::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Mulsu::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Fmul::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Fmuls::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Fmulsu::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sts1::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Sts2::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Lds1::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Lds2::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::LddY::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::LddZ::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::LdX1::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::LdX2::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::LdX3::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::LdY1::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::LdY2::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::LdY3::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::LdZ1::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::LdZ2::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::LdZ3::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::StdY::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::StdZ::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::StX1::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::StX2::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::StX3::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::StY1::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::StY2::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::StY3::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::StZ1::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::StZ2::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::StZ3::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Eicall::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Eijmp::decode, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&Opcodes::Des::decode, std::placeholders::_1, std::placeholders::_2),
+        static constexpr auto decoders = Decoder::OpcodeDecoders{
+            Decoder::opcodeDecoder<Opcodes::UndefinedOrErased>(),
+            Decoder::opcodeDecoder<Opcodes::Clc>(),
+            Decoder::opcodeDecoder<Opcodes::Clh>(),
+            Decoder::opcodeDecoder<Opcodes::Cli>(),
+            Decoder::opcodeDecoder<Opcodes::Cln>(),
+            Decoder::opcodeDecoder<Opcodes::Cls>(),
+            Decoder::opcodeDecoder<Opcodes::Clt>(),
+            Decoder::opcodeDecoder<Opcodes::Clv>(),
+            Decoder::opcodeDecoder<Opcodes::Clz>(),
+            Decoder::opcodeDecoder<Opcodes::Sec>(),
+            Decoder::opcodeDecoder<Opcodes::Seh>(),
+            Decoder::opcodeDecoder<Opcodes::Sei>(),
+            Decoder::opcodeDecoder<Opcodes::Sen>(),
+            Decoder::opcodeDecoder<Opcodes::Ses>(),
+            Decoder::opcodeDecoder<Opcodes::Set>(),
+            Decoder::opcodeDecoder<Opcodes::Sev>(),
+            Decoder::opcodeDecoder<Opcodes::Sez>(),
+            Decoder::opcodeDecoder<Opcodes::Bclr>(),
+            Decoder::opcodeDecoder<Opcodes::Bset>(),
+            Decoder::opcodeDecoder<Opcodes::Icall>(),
+            Decoder::opcodeDecoder<Opcodes::Ijmp>(),
+            Decoder::opcodeDecoder<Opcodes::Lpm1>(),
+            Decoder::opcodeDecoder<Opcodes::Lpm2>(),
+            Decoder::opcodeDecoder<Opcodes::Lpm3>(),
+            Decoder::opcodeDecoder<Opcodes::Elpm1>(),
+            Decoder::opcodeDecoder<Opcodes::Elpm2>(),
+            Decoder::opcodeDecoder<Opcodes::Elpm3>(),
+            Decoder::opcodeDecoder<Opcodes::Nop>(),
+            Decoder::opcodeDecoder<Opcodes::Ret>(),
+            Decoder::opcodeDecoder<Opcodes::Reti>(),
+            Decoder::opcodeDecoder<Opcodes::Sleep>(),
+            Decoder::opcodeDecoder<Opcodes::Break>(),
+            Decoder::opcodeDecoder<Opcodes::Wdr>(),
+            Decoder::opcodeDecoder<Opcodes::Spm1>(),
+            Decoder::opcodeDecoder<Opcodes::Spm2>(),
+            Decoder::opcodeDecoder<Opcodes::Adc>(),
+            Decoder::opcodeDecoder<Opcodes::Add>(),
+            Decoder::opcodeDecoder<Opcodes::And>(),
+            Decoder::opcodeDecoder<Opcodes::Cp>(),
+            Decoder::opcodeDecoder<Opcodes::Cpc>(),
+            Decoder::opcodeDecoder<Opcodes::Cpse>(),
+            Decoder::opcodeDecoder<Opcodes::Eor>(),
+            Decoder::opcodeDecoder<Opcodes::Mov>(),
+            Decoder::opcodeDecoder<Opcodes::Mul>(),
+            Decoder::opcodeDecoder<Opcodes::Or>(),
+            Decoder::opcodeDecoder<Opcodes::Sbc>(),
+            Decoder::opcodeDecoder<Opcodes::Sub>(),
+            Decoder::opcodeDecoder<Opcodes::Clr>(),
+            Decoder::opcodeDecoder<Opcodes::Lsl>(),
+            Decoder::opcodeDecoder<Opcodes::Rol>(),
+            Decoder::opcodeDecoder<Opcodes::Tst>(),
+            Decoder::opcodeDecoder<Opcodes::Andi>(),
+            Decoder::opcodeDecoder<Opcodes::Cbr>(),
+            Decoder::opcodeDecoder<Opcodes::Ldi>(),
+            Decoder::opcodeDecoder<Opcodes::Ser>(),
+            Decoder::opcodeDecoder<Opcodes::Ori>(),
+            Decoder::opcodeDecoder<Opcodes::Sbr>(),
+            Decoder::opcodeDecoder<Opcodes::Cpi>(),
+            Decoder::opcodeDecoder<Opcodes::Sbci>(),
+            Decoder::opcodeDecoder<Opcodes::Subi>(),
+            Decoder::opcodeDecoder<Opcodes::Sbrc>(),
+            Decoder::opcodeDecoder<Opcodes::Sbrs>(),
+            Decoder::opcodeDecoder<Opcodes::Bld>(),
+            Decoder::opcodeDecoder<Opcodes::Bst>(),
+            Decoder::opcodeDecoder<Opcodes::In>(),
+            Decoder::opcodeDecoder<Opcodes::Out>(),
+            Decoder::opcodeDecoder<Opcodes::Adiw>(),
+            Decoder::opcodeDecoder<Opcodes::Sbiw>(),
+            Decoder::opcodeDecoder<Opcodes::Cbi>(),
+            Decoder::opcodeDecoder<Opcodes::Sbi>(),
+            Decoder::opcodeDecoder<Opcodes::Sbic>(),
+            Decoder::opcodeDecoder<Opcodes::Sbis>(),
+            Decoder::opcodeDecoder<Opcodes::Brcc>(),
+            Decoder::opcodeDecoder<Opcodes::Brcs>(),
+            Decoder::opcodeDecoder<Opcodes::Breq>(),
+            Decoder::opcodeDecoder<Opcodes::Brge>(),
+            Decoder::opcodeDecoder<Opcodes::Brhc>(),
+            Decoder::opcodeDecoder<Opcodes::Brhs>(),
+            Decoder::opcodeDecoder<Opcodes::Brid>(),
+            Decoder::opcodeDecoder<Opcodes::Brie>(),
+            Decoder::opcodeDecoder<Opcodes::Brlo>(),
+            Decoder::opcodeDecoder<Opcodes::Brlt>(),
+            Decoder::opcodeDecoder<Opcodes::Brmi>(),
+            Decoder::opcodeDecoder<Opcodes::Brne>(),
+            Decoder::opcodeDecoder<Opcodes::Brpl>(),
+            Decoder::opcodeDecoder<Opcodes::Brsh>(),
+            Decoder::opcodeDecoder<Opcodes::Brtc>(),
+            Decoder::opcodeDecoder<Opcodes::Brts>(),
+            Decoder::opcodeDecoder<Opcodes::Brvc>(),
+            Decoder::opcodeDecoder<Opcodes::Brvs>(),
+            Decoder::opcodeDecoder<Opcodes::Brbc>(),
+            Decoder::opcodeDecoder<Opcodes::Brbs>(),
+            Decoder::opcodeDecoder<Opcodes::Rcall>(),
+            Decoder::opcodeDecoder<Opcodes::Rjmp>(),
+            Decoder::opcodeDecoder<Opcodes::Call>(),
+            Decoder::opcodeDecoder<Opcodes::Jmp>(),
+            Decoder::opcodeDecoder<Opcodes::Asr>(),
+            Decoder::opcodeDecoder<Opcodes::Com>(),
+            Decoder::opcodeDecoder<Opcodes::Dec>(),
+            Decoder::opcodeDecoder<Opcodes::Inc>(),
+            Decoder::opcodeDecoder<Opcodes::Lsr>(),
+            Decoder::opcodeDecoder<Opcodes::Neg>(),
+            Decoder::opcodeDecoder<Opcodes::Pop>(),
+            Decoder::opcodeDecoder<Opcodes::Push>(),
+            Decoder::opcodeDecoder<Opcodes::Ror>(),
+            Decoder::opcodeDecoder<Opcodes::Swap>(),
+            Decoder::opcodeDecoder<Opcodes::Xch>(),
+            Decoder::opcodeDecoder<Opcodes::Las>(),
+            Decoder::opcodeDecoder<Opcodes::Lac>(),
+            Decoder::opcodeDecoder<Opcodes::Lat>(),
+            Decoder::opcodeDecoder<Opcodes::Movw>(),
+            Decoder::opcodeDecoder<Opcodes::Muls>(),
+            Decoder::opcodeDecoder<Opcodes::Mulsu>(),
+            Decoder::opcodeDecoder<Opcodes::Fmul>(),
+            Decoder::opcodeDecoder<Opcodes::Fmuls>(),
+            Decoder::opcodeDecoder<Opcodes::Fmulsu>(),
+            Decoder::opcodeDecoder<Opcodes::Sts1>(),
+            Decoder::opcodeDecoder<Opcodes::Sts2>(),
+            Decoder::opcodeDecoder<Opcodes::Lds1>(),
+            Decoder::opcodeDecoder<Opcodes::Lds2>(),
+            Decoder::opcodeDecoder<Opcodes::LddY>(),
+            Decoder::opcodeDecoder<Opcodes::LddZ>(),
+            Decoder::opcodeDecoder<Opcodes::LdX1>(),
+            Decoder::opcodeDecoder<Opcodes::LdX2>(),
+            Decoder::opcodeDecoder<Opcodes::LdX3>(),
+            Decoder::opcodeDecoder<Opcodes::LdY1>(),
+            Decoder::opcodeDecoder<Opcodes::LdY2>(),
+            Decoder::opcodeDecoder<Opcodes::LdY3>(),
+            Decoder::opcodeDecoder<Opcodes::LdZ1>(),
+            Decoder::opcodeDecoder<Opcodes::LdZ2>(),
+            Decoder::opcodeDecoder<Opcodes::LdZ3>(),
+            Decoder::opcodeDecoder<Opcodes::StdY>(),
+            Decoder::opcodeDecoder<Opcodes::StdZ>(),
+            Decoder::opcodeDecoder<Opcodes::StX1>(),
+            Decoder::opcodeDecoder<Opcodes::StX2>(),
+            Decoder::opcodeDecoder<Opcodes::StX3>(),
+            Decoder::opcodeDecoder<Opcodes::StY1>(),
+            Decoder::opcodeDecoder<Opcodes::StY2>(),
+            Decoder::opcodeDecoder<Opcodes::StY3>(),
+            Decoder::opcodeDecoder<Opcodes::StZ1>(),
+            Decoder::opcodeDecoder<Opcodes::StZ2>(),
+            Decoder::opcodeDecoder<Opcodes::StZ3>(),
+            Decoder::opcodeDecoder<Opcodes::Eicall>(),
+            Decoder::opcodeDecoder<Opcodes::Eijmp>(),
+            Decoder::opcodeDecoder<Opcodes::Des>(),
         };
+
+        return decoders;
     }
 }
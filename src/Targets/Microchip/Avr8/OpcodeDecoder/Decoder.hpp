@@ -1,22 +1,61 @@
 #pragma once
 
 #include <cstdint>
-#include <map>
+#include <vector>
 #include <array>
-#include <functional>
+#include <utility>
 #include <optional>
 
 #include "Instruction.hpp"
 
 #include "src/Targets/TargetMemory.hpp"
-#include "src/Services/BitsetService.hpp"
 
 namespace Targets::Microchip::Avr8::OpcodeDecoder
 {
     class Decoder
     {
     public:
-        using InstructionMapping = std::map<Targets::TargetMemoryAddress, std::optional<Instruction>>;
+        /**
+         * Decoded instructions (or std::nullopt, for decode failures), by their byte address.
+         *
+         * Entries are held contiguously, in ascending address order.
+         */
+        class InstructionMapping
+        {
+        public:
+            using Entry = std::pair<Targets::TargetMemoryAddress, std::optional<Instruction>>;
+            using const_iterator = std::vector<Entry>::const_iterator;
+
+            [[nodiscard]] const_iterator begin() const {
+                return this->entries.begin();
+            }
+
+            [[nodiscard]] const_iterator end() const {
+                return this->entries.end();
+            }
+
+            [[nodiscard]] std::size_t size() const {
+                return this->entries.size();
+            }
+
+            [[nodiscard]] bool empty() const {
+                return this->entries.empty();
+            }
+
+            /**
+             * Finds the entry for the instruction at the given byte address.
+             *
+             * @param byteAddress
+             * @return
+             *  An iterator addressing the entry, or end() if there is no instruction at the given address.
+             */
+            [[nodiscard]] const_iterator find(Targets::TargetMemoryAddress byteAddress) const;
+
+        private:
+            friend class Decoder;
+
+            std::vector<Entry> entries;
+        };
 
         /**
          * Attempts to decode AVR8 opcodes.
@@ -42,15 +81,54 @@ namespace Targets::Microchip::Avr8::OpcodeDecoder
             bool throwOnFailure = false
         );
 
-    private:
-        using OpcodeDecoderFunction = std::function<
-            std::optional<Instruction>(
-                const Targets::TargetMemoryBuffer::const_iterator&,
-                const Targets::TargetMemoryBuffer::const_iterator&
-           )
-        >;
-        using OpcodeDecoders = std::array<Decoder::OpcodeDecoderFunction, 145>;
+    protected:
+        using OpcodeDecoderFunction = std::optional<Instruction> (*)(
+            const Targets::TargetMemoryBuffer::const_iterator&,
+            const Targets::TargetMemoryBuffer::const_iterator&
+        );
+
+        struct OpcodeDecoderEntry
+        {
+            OpcodeDecoderFunction decode;
+            std::uint16_t firstWordMask;
+            std::uint16_t expectedFirstWord;
+        };
 
-        static OpcodeDecoders opcodeDecoders();
+        using OpcodeDecoders = std::array<Decoder::OpcodeDecoderEntry, 145>;
+
+        /**
+         * The dispatch table maps each possible first opcode word to the index (in opcodeDecoders()) of the first
+         * decoder whose fixed first-word bits match it. NO_DECODER is used for words that no decoder matches.
+         *
+         * Only the first opcode word is considered when building the table, so a 32-bit opcode decoder may still
+         * reject the opcode (if there isn't enough data to hold it, for example). In that case, the remaining
+         * decoders are tried in order, as they would have been without the table.
+         */
+        static constexpr auto NO_DECODER = std::uint8_t{0xFF};
+        using DispatchTable = std::array<std::uint8_t, 0x10000>;
+
+        template <typename OpcodeType>
+        static constexpr Decoder::OpcodeDecoderEntry opcodeDecoder() {
+            return Decoder::OpcodeDecoderEntry{
+                .decode = &OpcodeType::decode,
+                .firstWordMask = OpcodeType::firstWordMask(),
+                .expectedFirstWord = OpcodeType::expectedFirstWord(),
+            };
+        }
+
+        /**
+         * The opcode decoders, in the order in which they're tried. Each decoder checks its own opcode bits, so
+         * trying each of them in turn (without the dispatch table) yields the same result as decodeOpcode() - the
+         * tests rely on this, to check the dispatch table.
+         *
+         * @return
+         */
+        static const OpcodeDecoders& opcodeDecoders();
+        static const DispatchTable& dispatchTable();
+
+        static std::optional<Instruction> decodeOpcode(
+            const Targets::TargetMemoryBuffer::const_iterator& dataBegin,
+            const Targets::TargetMemoryBuffer::const_iterator& dataEnd
+        );
     };
 }
@@ -710,10 +710,25 @@ namespace Targets::Microchip::Avr8::OpcodeDecoder
             return output;
         }
 
-    private:
-        static OpcodeDataType opcodeMask() {
-            using Services::BitsetService;
+        /**
+         * The fixed (non-parameter) bits of the first opcode word - that is, the most significant word of 32-bit
+         * opcodes.
+         *
+         * These are used by the OpcodeDecoder::Decoder to build its dispatch table.
+         */
+        static constexpr std::uint16_t firstWordMask() {
+            return static_cast<std::uint16_t>(Opcode::opcodeMask() >> ((wordSize - 1) * 16));
+        }
 
+        /**
+         * The expected value of the fixed bits of the first opcode word. See firstWordMask().
+         */
+        static constexpr std::uint16_t expectedFirstWord() {
+            return static_cast<std::uint16_t>(expectedOpcode >> ((wordSize - 1) * 16));
+        }
+
+    private:
+        static constexpr OpcodeDataType opcodeMask() {
             auto opcodeMask = static_cast<OpcodeDataType>(-1LL);
 
             if constexpr (decltype(sourceRegisterParameter)::hasValue()) {
@@ -271,6 +271,25 @@ namespace Targets::RiscV
         this->riscVDebugInterface->eraseMemory(addressSpaceDescriptor, memorySegmentDescriptor);
     }
 
+    TargetMemorySize RiscV::maximumMemoryReadSize(
+        const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+        const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+    ) {
+        return std::min(
+            memorySegmentDescriptor.size(),
+            this->riscVDebugInterface->maximumMemoryReadSize(memorySegmentDescriptor)
+        );
+    }
+
+    bool RiscV::canReadMemoryWhileRunning(
+        const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+        const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+    ) {
+        // CSRs and GPRs can only be accessed via the hart, which must be halted
+        return addressSpaceDescriptor == this->sysAddressSpaceDescriptor
+            && this->riscVDebugInterface->canReadMemoryWhileRunning(memorySegmentDescriptor);
+    }
+
     TargetExecutionState RiscV::getExecutionState() {
         return this->riscVDebugInterface->getExecutionState();
     }
@@ -68,6 +68,14 @@ namespace Targets::RiscV
             const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
             const TargetMemorySegmentDescriptor& memorySegmentDescriptor
         ) override;
+        TargetMemorySize maximumMemoryReadSize(
+            const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+            const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        ) override;
+        bool canReadMemoryWhileRunning(
+            const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+            const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        ) override;
 
         TargetExecutionState getExecutionState() override;
 
@@ -143,6 +143,38 @@ namespace Targets
             const TargetMemorySegmentDescriptor& memorySegmentDescriptor
         ) = 0;
 
+        /**
+         * Should return the maximum number of bytes that can be read from the given memory segment, in a single
+         * transaction with the debug tool.
+         *
+         * The TargetController uses this to size speculative reads (see TargetController::MemoryPrefetcher).
+         *
+         * @param addressSpaceDescriptor
+         * @param memorySegmentDescriptor
+         *
+         * @return
+         */
+        virtual TargetMemorySize maximumMemoryReadSize(
+            const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+            const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        ) = 0;
+
+        /**
+         * Should determine whether the given memory segment can be read whilst the target is running.
+         *
+         * The TargetController will only service memory reads for a running target if this returns true. Such reads
+         * are never served from, or used to populate, any memory cache.
+         *
+         * @param addressSpaceDescriptor
+         * @param memorySegmentDescriptor
+         *
+         * @return
+         */
+        virtual bool canReadMemoryWhileRunning(
+            const TargetAddressSpaceDescriptor& addressSpaceDescriptor,
+            const TargetMemorySegmentDescriptor& memorySegmentDescriptor
+        ) = 0;
+
         virtual TargetExecutionState getExecutionState() = 0;
 
         virtual TargetMemoryAddress getProgramCounter() = 0;
@@ -59,5 +59,7 @@ namespace Targets::TargetDescription
 
             return segment->get();
         }
+
+        bool operator == (const AddressSpace& other) const = default;
     };
 }
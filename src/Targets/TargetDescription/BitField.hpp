@@ -27,5 +27,7 @@ namespace Targets::TargetDescription
             , mask(mask)
             , access(access)
         {}
+
+        bool operator == (const BitField& other) const = default;
     };
 }
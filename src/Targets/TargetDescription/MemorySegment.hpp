@@ -76,5 +76,7 @@ namespace Targets::TargetDescription
 
             return propertyGroup->get();
         }
+
+        bool operator == (const MemorySegment& other) const = default;
     };
 }
@@ -74,5 +74,7 @@ namespace Targets::TargetDescription
 
             return propertyGroup->get();
         }
+
+        bool operator == (const MemorySegmentSection& other) const = default;
     };
 }
@@ -55,5 +55,7 @@ namespace Targets::TargetDescription
 
             return group->get();
         }
+
+        bool operator == (const Module& other) const = default;
     };
 }
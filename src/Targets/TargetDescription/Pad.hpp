@@ -16,5 +16,7 @@ namespace Targets::TargetDescription
             : key(key)
             , name(name)
         {}
+
+        bool operator == (const Pad& other) const = default;
     };
 }
@@ -59,5 +59,7 @@ namespace Targets::TargetDescription
 
             return instance->get();
         }
+
+        bool operator == (const Peripheral& other) const = default;
     };
 }
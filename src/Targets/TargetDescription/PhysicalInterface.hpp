@@ -11,5 +11,7 @@ namespace Targets::TargetDescription
         PhysicalInterface(const std::string& value)
             : value(value)
         {}
+
+        bool operator == (const PhysicalInterface& other) const = default;
     };
 }
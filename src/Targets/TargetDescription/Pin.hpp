@@ -17,5 +17,7 @@ namespace Targets::TargetDescription
             : position(position)
             , padKey(padKey)
         {}
+
+        bool operator == (const Pin& other) const = default;
     };
 }
@@ -31,5 +31,7 @@ namespace Targets::TargetDescription
             , function(function)
             , pins(pins)
         {}
+
+        bool operator == (const Pinout& other) const = default;
     };
 }
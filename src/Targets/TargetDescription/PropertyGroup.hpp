@@ -22,6 +22,8 @@ namespace Targets::TargetDescription
             : key(key)
             , value(value)
         {}
+
+        bool operator == (const Property& other) const = default;
     };
 
     struct PropertyGroup
@@ -98,5 +100,7 @@ namespace Targets::TargetDescription
 
             return property->get();
         }
+
+        bool operator == (const PropertyGroup& other) const = default;
     };
 }
@@ -67,5 +67,7 @@ namespace Targets::TargetDescription
 
             return bitField->get();
         }
+
+        bool operator == (const Register& other) const = default;
     };
 }
@@ -97,5 +97,7 @@ namespace Targets::TargetDescription
 
             return reg->get();
         }
+
+        bool operator == (const RegisterGroup& other) const = default;
     };
 }
@@ -30,5 +30,7 @@ namespace Targets::TargetDescription
             , offset(offset)
             , description(description)
         {}
+
+        bool operator == (const RegisterGroupInstance& other) const = default;
     };
 }
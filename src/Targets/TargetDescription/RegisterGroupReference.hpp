@@ -27,5 +27,7 @@ namespace Targets::TargetDescription
             , offset(offset)
             , description(description)
         {}
+
+        bool operator == (const RegisterGroupReference& other) const = default;
     };
 }
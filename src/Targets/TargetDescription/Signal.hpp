@@ -30,5 +30,7 @@ namespace Targets::TargetDescription
             , function(function)
             , field(field)
         {}
+
+        bool operator == (const Signal& other) const = default;
     };
 }
@@ -1,6 +1,8 @@
 #include "TargetDescriptionFile.hpp"
 
 #include <QFile>
+#include <chrono>
+#include <filesystem>
 
 #include "src/Services/PathService.hpp"
 #include "src/Services/StringService.hpp"
@@ -24,10 +26,6 @@ namespace Targets::TargetDescription
         this->init(xmlFilePath);
     }
 
-    TargetDescriptionFile::TargetDescriptionFile(const QDomDocument& xml) {
-        this->init(xml);
-    }
-
     const std::string& TargetDescriptionFile::getName() const {
         return this->getDeviceAttribute("name");
     }
@@ -392,6 +390,22 @@ namespace Targets::TargetDescription
     }
 
     void TargetDescriptionFile::init(const std::string& xmlFilePath) {
+        const auto startTime = std::chrono::steady_clock::now();
+
+        const auto image = TargetDescriptionFile::tryLoadImage(xmlFilePath);
+        if (image.has_value()) {
+            this->init(*image);
+
+            Logger::debug(
+                "Loaded target description from binary image in " + std::to_string(
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - startTime
+                    ).count()
+                ) + " us"
+            );
+            return;
+        }
+
         auto file = QFile{QString::fromStdString(xmlFilePath)};
         if (!file.exists()) {
             throw InternalFatalErrorException{"Failed to load target description file - file not found"};
@@ -401,27 +415,26 @@ namespace Targets::TargetDescription
             throw InternalFatalErrorException{"Failed to open target description file \"" + xmlFilePath + "\""};
         }
 
-        auto document = QDomDocument{};
-        if (!document.setContent(file.readAll())) {
-            throw TargetDescriptionParsingFailureException{};
-        }
+        this->init(TdfImage::fromXml(file));
 
-        this->init(document);
+        Logger::debug(
+            "Loaded target description from XML in " + std::to_string(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - startTime
+                ).count()
+            ) + " us"
+        );
     }
 
-    void TargetDescriptionFile::init(const QDomDocument& document) {
-        const auto deviceElement = document.documentElement();
+    void TargetDescriptionFile::init(const TdfImage& image) {
+        const auto deviceElement = image.documentElement();
         if (deviceElement.nodeName() != "device") {
             throw TargetDescriptionParsingFailureException{"Root \"device\" element not found."};
         }
 
-        const auto deviceAttributes = deviceElement.attributes();
-        for (auto i = 0; i < deviceAttributes.length(); ++i) {
-            const auto deviceAttribute = deviceAttributes.item(i);
-            this->deviceAttributesByName.emplace(
-                deviceAttribute.nodeName().toStdString(),
-                deviceAttribute.nodeValue().toStdString()
-            );
+        for (auto i = std::uint32_t{0}; i < deviceElement.attributeCount(); ++i) {
+            const auto [name, value] = deviceElement.attributeAt(i);
+            this->deviceAttributesByName.emplace(name, value);
         }
 
         for (
@@ -530,29 +543,65 @@ namespace Targets::TargetDescription
         return output;
     }
 
+    std::optional<TdfImage> TargetDescriptionFile::tryLoadImage(const std::string& xmlFilePath) {
+        const auto imagePath = TdfImage::imagePath(xmlFilePath);
+
+        auto error = std::error_code{};
+        const auto imageModifiedTime = std::filesystem::last_write_time(imagePath, error);
+        if (error) {
+            // No image
+            return std::nullopt;
+        }
+
+        const auto xmlModifiedTime = std::filesystem::last_write_time(xmlFilePath, error);
+        const auto xmlFileSize = error ? std::uintmax_t{0} : std::filesystem::file_size(xmlFilePath, error);
+        if (error) {
+            return std::nullopt;
+        }
+
+        if (imageModifiedTime < xmlModifiedTime) {
+            Logger::debug("Ignoring binary TDF image \"" + imagePath + "\" - the TDF has been modified since");
+            return std::nullopt;
+        }
+
+        try {
+            auto image = TdfImage::fromFile(imagePath);
+
+            if (image.sourceSize() != xmlFileSize) {
+                Logger::debug("Ignoring binary TDF image \"" + imagePath + "\" - TDF size mismatch");
+                return std::nullopt;
+            }
+
+            return std::optional<TdfImage>{std::move(image)};
+
+        } catch (const TargetDescriptionParsingFailureException& exception) {
+            Logger::warning(exception.getMessage() + " - falling back to XML");
+            return std::nullopt;
+        }
+    }
+
     std::optional<std::string> TargetDescriptionFile::tryGetAttribute(
-        const QDomElement& element,
-        const QString& attributeName
+        const TdfImageElement& element,
+        std::string_view attributeName
     ) {
-        return element.hasAttribute(attributeName)
-            ? std::optional{element.attribute(attributeName).toStdString()}
-            : std::nullopt;
+        const auto attribute = element.attribute(attributeName);
+        return attribute.has_value() ? std::optional{std::string{*attribute}} : std::nullopt;
     }
 
-    std::string TargetDescriptionFile::getAttribute(const QDomElement& element, const QString& attributeName) {
+    std::string TargetDescriptionFile::getAttribute(const TdfImageElement& element, std::string_view attributeName) {
         const auto attribute = TargetDescriptionFile::tryGetAttribute(element, attributeName);
 
         if (!attribute.has_value()) {
             throw InvalidTargetDescriptionDataException{
-                "Failed to fetch attribute from TDF element \"" + element.nodeName().toStdString()
-                    + "\" - attribute \"" + attributeName.toStdString() + "\" not found"
+                "Failed to fetch attribute from TDF element \"" + std::string{element.nodeName()}
+                    + "\" - attribute \"" + std::string{attributeName} + "\" not found"
             };
         }
 
         return *attribute;
     }
 
-    PropertyGroup TargetDescriptionFile::propertyGroupFromXml(const QDomElement& xmlElement) {
+    PropertyGroup TargetDescriptionFile::propertyGroupFromXml(const TdfImageElement& xmlElement) {
         auto output = PropertyGroup{TargetDescriptionFile::getAttribute(xmlElement, "key"), {}, {}};
 
         for (
@@ -576,14 +625,14 @@ namespace Targets::TargetDescription
         return output;
     }
 
-    Property TargetDescriptionFile::propertyFromXml(const QDomElement& xmlElement) {
+    Property TargetDescriptionFile::propertyFromXml(const TdfImageElement& xmlElement) {
         return {
             TargetDescriptionFile::getAttribute(xmlElement, "key"),
             TargetDescriptionFile::getAttribute(xmlElement, "value")
         };
     }
 
-    AddressSpace TargetDescriptionFile::addressSpaceFromXml(const QDomElement& xmlElement) {
+    AddressSpace TargetDescriptionFile::addressSpaceFromXml(const TdfImageElement& xmlElement) {
         static const auto endiannessByName = BiMap<std::string, TargetMemoryEndianness>{
             {"big", TargetMemoryEndianness::BIG},
             {"little", TargetMemoryEndianness::LITTLE},
@@ -625,7 +674,7 @@ namespace Targets::TargetDescription
         return output;
     }
 
-    MemorySegment TargetDescriptionFile::memorySegmentFromXml(const QDomElement& xmlElement) {
+    MemorySegment TargetDescriptionFile::memorySegmentFromXml(const TdfImageElement& xmlElement) {
         static const auto typesByName = BiMap<std::string, TargetMemorySegmentType>{
             {"gp_registers", TargetMemorySegmentType::GENERAL_PURPOSE_REGISTERS},
             {"registers", TargetMemorySegmentType::REGISTERS},
@@ -683,7 +732,7 @@ namespace Targets::TargetDescription
         return output;
     }
 
-    MemorySegmentSection TargetDescriptionFile::memorySegmentSectionFromXml(const QDomElement& xmlElement) {
+    MemorySegmentSection TargetDescriptionFile::memorySegmentSectionFromXml(const TdfImageElement& xmlElement) {
         auto output = MemorySegmentSection{
             TargetDescriptionFile::getAttribute(xmlElement, "key"),
             TargetDescriptionFile::getAttribute(xmlElement, "name"),
@@ -704,13 +753,13 @@ namespace Targets::TargetDescription
         return output;
     }
 
-    PhysicalInterface TargetDescriptionFile::physicalInterfaceFromXml(const QDomElement& xmlElement) {
+    PhysicalInterface TargetDescriptionFile::physicalInterfaceFromXml(const TdfImageElement& xmlElement) {
         return {
             TargetDescriptionFile::getAttribute(xmlElement, "value")
         };
     }
 
-    Module TargetDescriptionFile::moduleFromXml(const QDomElement& xmlElement) {
+    Module TargetDescriptionFile::moduleFromXml(const TdfImageElement& xmlElement) {
         auto output = Module{
             TargetDescriptionFile::getAttribute(xmlElement, "key"),
             TargetDescriptionFile::getAttribute(xmlElement, "name"),
@@ -730,7 +779,7 @@ namespace Targets::TargetDescription
         return output;
     }
 
-    RegisterGroup TargetDescriptionFile::registerGroupFromXml(const QDomElement& xmlElement) {
+    RegisterGroup TargetDescriptionFile::registerGroupFromXml(const TdfImageElement& xmlElement) {
         const auto offset = TargetDescriptionFile::tryGetAttribute(xmlElement, "offset");
 
         auto output = RegisterGroup{
@@ -772,7 +821,7 @@ namespace Targets::TargetDescription
         return output;
     }
 
-    RegisterGroupReference TargetDescriptionFile::registerGroupReferenceFromXml(const QDomElement& xmlElement) {
+    RegisterGroupReference TargetDescriptionFile::registerGroupReferenceFromXml(const TdfImageElement& xmlElement) {
         return {
             TargetDescriptionFile::getAttribute(xmlElement, "key"),
             TargetDescriptionFile::getAttribute(xmlElement, "name"),
@@ -782,7 +831,7 @@ namespace Targets::TargetDescription
         };
     }
 
-    Register TargetDescriptionFile::registerFromXml(const QDomElement& xmlElement) {
+    Register TargetDescriptionFile::registerFromXml(const TdfImageElement& xmlElement) {
         const auto initialValue = TargetDescriptionFile::tryGetAttribute(xmlElement, "initial-value");
         const auto alternative = TargetDescriptionFile::tryGetAttribute(xmlElement, "alternative");
         const auto accessString = TargetDescriptionFile::tryGetAttribute(xmlElement, "access");
@@ -816,7 +865,7 @@ namespace Targets::TargetDescription
         return output;
     }
 
-    BitField TargetDescriptionFile::bitFieldFromXml(const QDomElement& xmlElement) {
+    BitField TargetDescriptionFile::bitFieldFromXml(const TdfImageElement& xmlElement) {
         return {
             TargetDescriptionFile::getAttribute(xmlElement, "key"),
             TargetDescriptionFile::getAttribute(xmlElement, "name"),
@@ -826,7 +875,7 @@ namespace Targets::TargetDescription
         };
     }
 
-    Peripheral TargetDescriptionFile::peripheralFromXml(const QDomElement& xmlElement) {
+    Peripheral TargetDescriptionFile::peripheralFromXml(const TdfImageElement& xmlElement) {
         const auto offset = TargetDescriptionFile::tryGetAttribute(xmlElement, "offset");
 
         auto output = Peripheral{
@@ -860,7 +909,7 @@ namespace Targets::TargetDescription
         return output;
     }
 
-    RegisterGroupInstance TargetDescriptionFile::registerGroupInstanceFromXml(const QDomElement& xmlElement) {
+    RegisterGroupInstance TargetDescriptionFile::registerGroupInstanceFromXml(const TdfImageElement& xmlElement) {
         return {
             TargetDescriptionFile::tryGetAttribute(xmlElement, "key"),
             TargetDescriptionFile::tryGetAttribute(xmlElement, "name"),
@@ -871,7 +920,7 @@ namespace Targets::TargetDescription
         };
     }
 
-    Signal TargetDescriptionFile::signalFromXml(const QDomElement& xmlElement) {
+    Signal TargetDescriptionFile::signalFromXml(const TdfImageElement& xmlElement) {
         const auto alternative = TargetDescriptionFile::tryGetAttribute(xmlElement, "alternative");
         const auto index = TargetDescriptionFile::tryGetAttribute(xmlElement, "index");
 
@@ -885,14 +934,14 @@ namespace Targets::TargetDescription
         };
     }
 
-    Pad TargetDescriptionFile::padFromXml(const QDomElement& xmlElement) {
+    Pad TargetDescriptionFile::padFromXml(const TdfImageElement& xmlElement) {
         return {
             TargetDescriptionFile::getAttribute(xmlElement, "key"),
             TargetDescriptionFile::getAttribute(xmlElement, "name")
         };
     }
 
-    Pinout TargetDescriptionFile::pinoutFromXml(const QDomElement& xmlElement) {
+    Pinout TargetDescriptionFile::pinoutFromXml(const TdfImageElement& xmlElement) {
         static const auto typesByName = BiMap<std::string, TargetPinoutType>{
             {"soic", TargetPinoutType::SOIC},
             {"ssop", TargetPinoutType::SSOP},
@@ -932,14 +981,14 @@ namespace Targets::TargetDescription
         return output;
     }
 
-    Pin TargetDescriptionFile::pinFromXml(const QDomElement& xmlElement) {
+    Pin TargetDescriptionFile::pinFromXml(const TdfImageElement& xmlElement) {
         return {
             TargetDescriptionFile::getAttribute(xmlElement, "position"),
             TargetDescriptionFile::tryGetAttribute(xmlElement, "pad-key")
         };
     }
 
-    Variant TargetDescriptionFile::variantFromXml(const QDomElement& xmlElement) {
+    Variant TargetDescriptionFile::variantFromXml(const TdfImageElement& xmlElement) {
         auto output = Variant{
             TargetDescriptionFile::getAttribute(xmlElement, "key"),
             TargetDescriptionFile::getAttribute(xmlElement, "name"),
@@ -1,7 +1,5 @@
 #pragma once
 
-#include <QDomDocument>
-#include <QDomElement>
 #include <string>
 #include <optional>
 #include <functional>
@@ -9,6 +7,7 @@
 #include <vector>
 #include <set>
 
+#include "TdfImage.hpp"
 #include "PropertyGroup.hpp"
 #include "AddressSpace.hpp"
 #include "MemorySegment.hpp"
@@ -50,7 +49,8 @@ namespace Targets::TargetDescription
      * For target description files, see the directory "src/Targets/TargetDescriptionFiles/".
      *
      * During the build process, all target description files are copied to the distribution directory, ready
-     * to be shipped with the Bloom binary.
+     * to be shipped with the Bloom binary. Each TDF is accompanied by a binary TDF image, which we load in place of
+     * the XML, where possible (see TdfImage).
      *
      * This class may be extended to further reflect a TDF that is specific to a particular target, target architecture
      * or target family. For example, see the Targets::Microchip::Avr8::TargetDescriptionFile class.
@@ -66,13 +66,6 @@ namespace Targets::TargetDescription
          */
         explicit TargetDescriptionFile(const std::string& xmlFilePath);
 
-        /**
-         * Will construct a TargetDescriptionFile instance from pre-loaded XML.
-         *
-         * @param xml
-         */
-        explicit TargetDescriptionFile(const QDomDocument& xml);
-
         /**
          * Returns the target name extracted from the TDF.
          *
@@ -172,8 +165,19 @@ namespace Targets::TargetDescription
         TargetDescriptionFile& operator = (const TargetDescriptionFile& other) = default;
         TargetDescriptionFile& operator = (TargetDescriptionFile&& other) = default;
 
+        /**
+         * Loads the TDF at the given path, via its binary image (see TdfImage), if one exists and is up to date.
+         * Otherwise, the XML is parsed.
+         *
+         * An image is considered to be out of date if it's older than the TDF, or if the size of the TDF differs
+         * from that recorded in the image. This allows for user-edited TDFs.
+         *
+         * XML is parsed in a single pass, with QXmlStreamReader, into an in-memory image (see TdfImage::fromXml()).
+         *
+         * @param xmlFilePath
+         */
         void init(const std::string& xmlFilePath);
-        void init(const QDomDocument& document);
+        void init(const TdfImage& image);
 
         [[nodiscard]] std::optional<std::reference_wrapper<const std::string>> tryGetDeviceAttribute(
             const std::string& attributeName
@@ -182,27 +186,32 @@ namespace Targets::TargetDescription
 
         [[nodiscard]] std::set<std::string> getGpioPeripheralSignalPadKeys() const;
 
-        static std::optional<std::string> tryGetAttribute(const QDomElement& element, const QString& attributeName);
-        static std::string getAttribute(const QDomElement& element, const QString& attributeName);
-
-        static PropertyGroup propertyGroupFromXml(const QDomElement& xmlElement);
-        static Property propertyFromXml(const QDomElement& xmlElement);
-        static AddressSpace addressSpaceFromXml(const QDomElement& xmlElement);
-        static MemorySegment memorySegmentFromXml(const QDomElement& xmlElement);
-        static MemorySegmentSection memorySegmentSectionFromXml(const QDomElement& xmlElement);
-        static PhysicalInterface physicalInterfaceFromXml(const QDomElement& xmlElement);
-        static Module moduleFromXml(const QDomElement& xmlElement);
-        static RegisterGroup registerGroupFromXml(const QDomElement& xmlElement);
-        static RegisterGroupReference registerGroupReferenceFromXml(const QDomElement& xmlElement);
-        static Register registerFromXml(const QDomElement& xmlElement);
-        static BitField bitFieldFromXml(const QDomElement& xmlElement);
-        static Peripheral peripheralFromXml(const QDomElement& xmlElement);
-        static RegisterGroupInstance registerGroupInstanceFromXml(const QDomElement& xmlElement);
-        static Signal signalFromXml(const QDomElement& xmlElement);
-        static Pad padFromXml(const QDomElement& xmlElement);
-        static Pinout pinoutFromXml(const QDomElement& xmlElement);
-        static Pin pinFromXml(const QDomElement& xmlElement);
-        static Variant variantFromXml(const QDomElement& xmlElement);
+        static std::optional<TdfImage> tryLoadImage(const std::string& xmlFilePath);
+
+        static std::optional<std::string> tryGetAttribute(
+            const TdfImageElement& element,
+            std::string_view attributeName
+        );
+        static std::string getAttribute(const TdfImageElement& element, std::string_view attributeName);
+
+        static PropertyGroup propertyGroupFromXml(const TdfImageElement& xmlElement);
+        static Property propertyFromXml(const TdfImageElement& xmlElement);
+        static AddressSpace addressSpaceFromXml(const TdfImageElement& xmlElement);
+        static MemorySegment memorySegmentFromXml(const TdfImageElement& xmlElement);
+        static MemorySegmentSection memorySegmentSectionFromXml(const TdfImageElement& xmlElement);
+        static PhysicalInterface physicalInterfaceFromXml(const TdfImageElement& xmlElement);
+        static Module moduleFromXml(const TdfImageElement& xmlElement);
+        static RegisterGroup registerGroupFromXml(const TdfImageElement& xmlElement);
+        static RegisterGroupReference registerGroupReferenceFromXml(const TdfImageElement& xmlElement);
+        static Register registerFromXml(const TdfImageElement& xmlElement);
+        static BitField bitFieldFromXml(const TdfImageElement& xmlElement);
+        static Peripheral peripheralFromXml(const TdfImageElement& xmlElement);
+        static RegisterGroupInstance registerGroupInstanceFromXml(const TdfImageElement& xmlElement);
+        static Signal signalFromXml(const TdfImageElement& xmlElement);
+        static Pad padFromXml(const TdfImageElement& xmlElement);
+        static Pinout pinoutFromXml(const TdfImageElement& xmlElement);
+        static Pin pinFromXml(const TdfImageElement& xmlElement);
+        static Variant variantFromXml(const TdfImageElement& xmlElement);
 
         static TargetAddressSpaceDescriptor targetAddressSpaceDescriptorFromAddressSpace(
             const AddressSpace& addressSpace
@@ -0,0 +1,409 @@
+#include "TdfImage.hpp"
+
+#include <array>
+#include <unordered_map>
+#include <algorithm>
+#include <filesystem>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Exceptions/TargetDescriptionParsingFailureException.hpp"
+
+namespace Targets::TargetDescription
+{
+    using Exceptions::TargetDescriptionParsingFailureException;
+
+    namespace
+    {
+        // Element record fields
+        constexpr auto ELEMENT_NAME = std::uint32_t{0};
+        constexpr auto ELEMENT_FIRST_ATTRIBUTE = std::uint32_t{1};
+        constexpr auto ELEMENT_ATTRIBUTE_COUNT = std::uint32_t{2};
+        constexpr auto ELEMENT_FIRST_CHILD = std::uint32_t{3};
+        constexpr auto ELEMENT_NEXT_SIBLING = std::uint32_t{4};
+
+        // Attribute record fields
+        constexpr auto ATTRIBUTE_NAME = std::uint32_t{0};
+        constexpr auto ATTRIBUTE_VALUE = std::uint32_t{1};
+
+        void appendUint32(std::vector<unsigned char>& output, std::uint32_t value) {
+            output.push_back(static_cast<unsigned char>(value));
+            output.push_back(static_cast<unsigned char>(value >> 8));
+            output.push_back(static_cast<unsigned char>(value >> 16));
+            output.push_back(static_cast<unsigned char>(value >> 24));
+        }
+
+        /**
+         * Builds the tables of a TdfImage from an XML stream, in a single pass. This is the C++ counterpart of the
+         * BinaryImageService build script.
+         *
+         * Elements are appended in document order, as their start tags are read. Only the chain of currently open
+         * elements is tracked, so no tree is ever held in memory, other than the image tables themselves.
+         */
+        class TdfImageBuilder
+        {
+        public:
+            std::vector<std::string> strings;
+            std::unordered_map<std::string, std::uint32_t> stringIndicesByValue;
+            std::vector<std::array<std::uint32_t, 5>> elements;
+            std::vector<std::array<std::uint32_t, 2>> attributes;
+
+            void startElement(const QXmlStreamReader& reader) {
+                const auto index = static_cast<std::uint32_t>(this->elements.size());
+                const auto xmlAttributes = reader.attributes();
+
+                this->elements.push_back({
+                    this->stringIndex(reader.qualifiedName().toString().toStdString()),
+                    static_cast<std::uint32_t>(this->attributes.size()),
+                    static_cast<std::uint32_t>(xmlAttributes.size()),
+                    0xFFFFFFFF,
+                    0xFFFFFFFF,
+                });
+
+                for (const auto& xmlAttribute : xmlAttributes) {
+                    this->attributes.push_back({
+                        this->stringIndex(xmlAttribute.qualifiedName().toString().toStdString()),
+                        this->stringIndex(xmlAttribute.value().toString().toStdString()),
+                    });
+                }
+
+                if (!this->openElements.empty()) {
+                    auto& parent = this->openElements.back();
+
+                    if (!parent.lastChildIndex.has_value()) {
+                        this->elements[parent.index][ELEMENT_FIRST_CHILD] = index;
+
+                    } else {
+                        this->elements[*(parent.lastChildIndex)][ELEMENT_NEXT_SIBLING] = index;
+                    }
+
+                    parent.lastChildIndex = index;
+                }
+
+                this->openElements.push_back(OpenElement{.index = index});
+            }
+
+            void endElement() {
+                this->openElements.pop_back();
+            }
+
+        private:
+            struct OpenElement
+            {
+                std::uint32_t index;
+                std::optional<std::uint32_t> lastChildIndex = std::nullopt;
+            };
+
+            std::vector<OpenElement> openElements;
+
+            std::uint32_t stringIndex(std::string&& value) {
+                const auto indexIt = this->stringIndicesByValue.find(value);
+                if (indexIt != this->stringIndicesByValue.end()) {
+                    return indexIt->second;
+                }
+
+                const auto index = static_cast<std::uint32_t>(this->strings.size());
+                this->stringIndicesByValue.emplace(value, index);
+                this->strings.emplace_back(std::move(value));
+                return index;
+            }
+        };
+    }
+
+    std::string_view TdfImageElement::nodeName() const {
+        return this->image->string(this->image->elementField(this->index, ELEMENT_NAME));
+    }
+
+    std::uint32_t TdfImageElement::attributeCount() const {
+        return this->image->elementField(this->index, ELEMENT_ATTRIBUTE_COUNT);
+    }
+
+    std::pair<std::string_view, std::string_view> TdfImageElement::attributeAt(std::uint32_t index) const {
+        const auto attributeIndex = this->image->elementField(this->index, ELEMENT_FIRST_ATTRIBUTE) + index;
+        return {
+            this->image->string(this->image->attributeField(attributeIndex, ATTRIBUTE_NAME)),
+            this->image->string(this->image->attributeField(attributeIndex, ATTRIBUTE_VALUE))
+        };
+    }
+
+    std::optional<std::string_view> TdfImageElement::attribute(std::string_view name) const {
+        const auto count = this->attributeCount();
+        for (auto i = std::uint32_t{0}; i < count; ++i) {
+            const auto [attributeName, attributeValue] = this->attributeAt(i);
+            if (attributeName == name) {
+                return attributeValue;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    TdfImageElement TdfImageElement::firstChildElement(std::string_view name) const {
+        if (this->isNull()) {
+            return {};
+        }
+
+        return this->findElement(this->image->elementField(this->index, ELEMENT_FIRST_CHILD), name);
+    }
+
+    TdfImageElement TdfImageElement::nextSiblingElement(std::string_view name) const {
+        if (this->isNull()) {
+            return {};
+        }
+
+        return this->findElement(this->image->elementField(this->index, ELEMENT_NEXT_SIBLING), name);
+    }
+
+    TdfImageElement TdfImageElement::findElement(std::uint32_t index, std::string_view name) const {
+        while (index != TdfImage::NONE) {
+            if (name.empty() || this->image->string(this->image->elementField(index, ELEMENT_NAME)) == name) {
+                return TdfImageElement{this->image, index};
+            }
+
+            index = this->image->elementField(index, ELEMENT_NEXT_SIBLING);
+        }
+
+        return {};
+    }
+
+    TdfImage TdfImage::fromFile(const std::string& imagePath) {
+        const auto fileDescriptor = ::open(imagePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0) {
+            throw TargetDescriptionParsingFailureException{"Failed to open binary TDF image \"" + imagePath + "\""};
+        }
+
+        struct ::stat fileStatus = {};
+        if (::fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size <= 0) {
+            ::close(fileDescriptor);
+            throw TargetDescriptionParsingFailureException{"Failed to stat binary TDF image \"" + imagePath + "\""};
+        }
+
+        const auto size = static_cast<std::size_t>(fileStatus.st_size);
+        auto* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        ::close(fileDescriptor);
+
+        if (mapping == MAP_FAILED) {
+            throw TargetDescriptionParsingFailureException{"Failed to map binary TDF image \"" + imagePath + "\""};
+        }
+
+        auto image = TdfImage{};
+        image.mapping = mapping;
+        image.mappingSize = size;
+        image.data = std::span{static_cast<const unsigned char*>(mapping), size};
+        image.loadTables();
+
+        return image;
+    }
+
+    TdfImage TdfImage::fromXml(QIODevice& device) {
+        auto builder = TdfImageBuilder{};
+        auto reader = QXmlStreamReader{&device};
+
+        while (!reader.atEnd()) {
+            const auto token = reader.readNext();
+
+            if (token == QXmlStreamReader::StartElement) {
+                builder.startElement(reader);
+
+            } else if (token == QXmlStreamReader::EndElement) {
+                builder.endElement();
+            }
+        }
+
+        if (reader.hasError()) {
+            throw TargetDescriptionParsingFailureException{
+                reader.errorString().toStdString() + " (line " + std::to_string(reader.lineNumber()) + ")"
+            };
+        }
+
+        if (builder.elements.empty()) {
+            throw TargetDescriptionParsingFailureException{"Empty XML document"};
+        }
+
+        auto stringDataSize = std::size_t{0};
+        for (const auto& string : builder.strings) {
+            stringDataSize += string.size();
+        }
+
+        auto image = TdfImage{};
+        auto& output = image.ownedData;
+        output.reserve(
+            HEADER_SIZE + (builder.strings.size() * STRING_RECORD_SIZE)
+                + (builder.elements.size() * ELEMENT_RECORD_SIZE)
+                + (builder.attributes.size() * ATTRIBUTE_RECORD_SIZE) + stringDataSize
+        );
+
+        output.insert(output.end(), TdfImage::MAGIC.begin(), TdfImage::MAGIC.end());
+        appendUint32(output, TdfImage::FORMAT_VERSION);
+        appendUint32(output, 0);
+        appendUint32(output, static_cast<std::uint32_t>(builder.strings.size()));
+        appendUint32(output, static_cast<std::uint32_t>(builder.elements.size()));
+        appendUint32(output, static_cast<std::uint32_t>(builder.attributes.size()));
+        appendUint32(output, static_cast<std::uint32_t>(stringDataSize));
+
+        auto stringOffset = std::uint32_t{0};
+        for (const auto& string : builder.strings) {
+            appendUint32(output, stringOffset);
+            appendUint32(output, static_cast<std::uint32_t>(string.size()));
+            stringOffset += static_cast<std::uint32_t>(string.size());
+        }
+
+        for (const auto& element : builder.elements) {
+            for (const auto field : element) {
+                appendUint32(output, field);
+            }
+        }
+
+        for (const auto& attribute : builder.attributes) {
+            for (const auto field : attribute) {
+                appendUint32(output, field);
+            }
+        }
+
+        for (const auto& string : builder.strings) {
+            output.insert(output.end(), string.begin(), string.end());
+        }
+
+        image.data = std::span{image.ownedData};
+        image.loadTables();
+
+        return image;
+    }
+
+    std::optional<std::size_t> TdfImage::findMismatch(const TdfImage& other) const {
+        const auto commonSize = std::min(this->data.size(), other.data.size());
+
+        for (auto offset = std::size_t{0}; offset < commonSize; ++offset) {
+            if (offset >= SOURCE_SIZE_OFFSET && offset < SOURCE_SIZE_OFFSET + sizeof(std::uint32_t)) {
+                continue;
+            }
+
+            if (this->data[offset] != other.data[offset]) {
+                return offset;
+            }
+        }
+
+        if (this->data.size() != other.data.size()) {
+            return commonSize;
+        }
+
+        return std::nullopt;
+    }
+
+    std::string TdfImage::imagePath(const std::string& xmlFilePath) {
+        return std::filesystem::path{xmlFilePath}.replace_extension(TdfImage::FILE_EXTENSION).string();
+    }
+
+    TdfImage::~TdfImage() {
+        if (this->mapping != nullptr) {
+            ::munmap(this->mapping, this->mappingSize);
+        }
+    }
+
+    TdfImage::TdfImage(TdfImage&& other) noexcept
+        : mapping(std::exchange(other.mapping, nullptr))
+        , mappingSize(std::exchange(other.mappingSize, 0))
+        , ownedData(std::move(other.ownedData))
+        , sourceFileSize(other.sourceFileSize)
+        , stringCount(other.stringCount)
+        , elementCount(other.elementCount)
+        , attributeCount(other.attributeCount)
+        , stringTableOffset(other.stringTableOffset)
+        , elementTableOffset(other.elementTableOffset)
+        , attributeTableOffset(other.attributeTableOffset)
+        , stringDataOffset(other.stringDataOffset)
+    {
+        this->data = this->mapping != nullptr
+            ? std::span{static_cast<const unsigned char*>(this->mapping), this->mappingSize}
+            : std::span<const unsigned char>{this->ownedData};
+
+        other.data = {};
+    }
+
+    void TdfImage::loadTables() {
+        if (
+            this->data.size() < HEADER_SIZE
+            || !std::equal(TdfImage::MAGIC.begin(), TdfImage::MAGIC.end(), this->data.begin())
+        ) {
+            throw TargetDescriptionParsingFailureException{"Invalid binary TDF image - magic not found"};
+        }
+
+        const auto formatVersion = this->readUint32(MAGIC.size());
+        if (formatVersion != TdfImage::FORMAT_VERSION) {
+            throw TargetDescriptionParsingFailureException{
+                "Binary TDF image format version mismatch (image: " + std::to_string(formatVersion)
+                    + ", expected: " + std::to_string(TdfImage::FORMAT_VERSION) + ")"
+            };
+        }
+
+        this->sourceFileSize = this->readUint32(SOURCE_SIZE_OFFSET);
+        this->stringCount = this->readUint32(MAGIC.size() + 8);
+        this->elementCount = this->readUint32(MAGIC.size() + 12);
+        this->attributeCount = this->readUint32(MAGIC.size() + 16);
+        const auto stringDataSize = std::size_t{this->readUint32(MAGIC.size() + 20)};
+
+        this->stringTableOffset = HEADER_SIZE;
+        this->elementTableOffset = this->stringTableOffset + (std::size_t{this->stringCount} * STRING_RECORD_SIZE);
+        this->attributeTableOffset = this->elementTableOffset
+            + (std::size_t{this->elementCount} * ELEMENT_RECORD_SIZE);
+        this->stringDataOffset = this->attributeTableOffset
+            + (std::size_t{this->attributeCount} * ATTRIBUTE_RECORD_SIZE);
+
+        if (this->elementCount == 0 || this->stringDataOffset + stringDataSize != this->data.size()) {
+            throw TargetDescriptionParsingFailureException{"Invalid binary TDF image - unexpected image size"};
+        }
+
+        for (auto i = std::uint32_t{0}; i < this->stringCount; ++i) {
+            const auto recordOffset = this->stringTableOffset + (i * STRING_RECORD_SIZE);
+            const auto offset = std::size_t{this->readUint32(recordOffset)};
+            const auto size = std::size_t{this->readUint32(recordOffset + 4)};
+
+            if (offset + size > stringDataSize) {
+                throw TargetDescriptionParsingFailureException{"Invalid binary TDF image - string out of range"};
+            }
+        }
+
+        for (auto i = std::uint32_t{0}; i < this->elementCount; ++i) {
+            const auto firstChild = this->elementField(i, ELEMENT_FIRST_CHILD);
+            const auto nextSibling = this->elementField(i, ELEMENT_NEXT_SIBLING);
+
+            /*
+             * Elements are stored in document order, so children and siblings always follow their referrers. This
+             * also rules out cycles.
+             */
+            if (
+                this->elementField(i, ELEMENT_NAME) >= this->stringCount
+                || std::size_t{this->elementField(i, ELEMENT_FIRST_ATTRIBUTE)}
+                    + this->elementField(i, ELEMENT_ATTRIBUTE_COUNT) > this->attributeCount
+                || (firstChild != NONE && (firstChild <= i || firstChild >= this->elementCount))
+                || (nextSibling != NONE && (nextSibling <= i || nextSibling >= this->elementCount))
+            ) {
+                throw TargetDescriptionParsingFailureException{
+                    "Invalid binary TDF image - element " + std::to_string(i) + " is malformed"
+                };
+            }
+        }
+
+        for (auto i = std::uint32_t{0}; i < this->attributeCount; ++i) {
+            if (
+                this->attributeField(i, ATTRIBUTE_NAME) >= this->stringCount
+                || this->attributeField(i, ATTRIBUTE_VALUE) >= this->stringCount
+            ) {
+                throw TargetDescriptionParsingFailureException{
+                    "Invalid binary TDF image - attribute " + std::to_string(i) + " is malformed"
+                };
+            }
+        }
+    }
+
+    std::string_view TdfImage::string(std::uint32_t index) const {
+        const auto recordOffset = this->stringTableOffset + (index * STRING_RECORD_SIZE);
+        return std::string_view{
+            reinterpret_cast<const char*>(this->data.data()) + this->stringDataOffset
+                + this->readUint32(recordOffset),
+            this->readUint32(recordOffset + 4)
+        };
+    }
+}
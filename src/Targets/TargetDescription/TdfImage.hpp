@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <span>
+#include <QIODevice>
+#include <QXmlStreamReader>
+
+namespace Targets::TargetDescription
+{
+    class TdfImage;
+
+    /**
+     * A view of a single element in a TdfImage.
+     *
+     * The interface resembles that of QDomElement. Views are only valid for the lifetime of the TdfImage they were
+     * obtained from.
+     */
+    class TdfImageElement
+    {
+    public:
+        TdfImageElement() = default;
+
+        [[nodiscard]] bool isNull() const {
+            return this->image == nullptr;
+        }
+
+        [[nodiscard]] std::string_view nodeName() const;
+
+        [[nodiscard]] std::uint32_t attributeCount() const;
+        [[nodiscard]] std::pair<std::string_view, std::string_view> attributeAt(std::uint32_t index) const;
+        [[nodiscard]] std::optional<std::string_view> attribute(std::string_view name) const;
+
+        /**
+         * Returns the first child element with the given name, or a null element if there is no such child.
+         *
+         * If the name is empty, the first child element will be returned, regardless of its name.
+         *
+         * @param name
+         * @return
+         */
+        [[nodiscard]] TdfImageElement firstChildElement(std::string_view name = {}) const;
+
+        /**
+         * Returns the next sibling element with the given name, or a null element if there is no such sibling.
+         *
+         * If the name is empty, the next sibling element will be returned, regardless of its name.
+         *
+         * @param name
+         * @return
+         */
+        [[nodiscard]] TdfImageElement nextSiblingElement(std::string_view name = {}) const;
+
+    private:
+        friend class TdfImage;
+
+        const TdfImage* image = nullptr;
+        std::uint32_t index = 0;
+
+        TdfImageElement(const TdfImage* image, std::uint32_t index)
+            : image(image)
+            , index(index)
+        {}
+
+        /**
+         * Follows the chain of elements from the given index (via the next sibling links), returning the first
+         * element with the given name.
+         */
+        [[nodiscard]] TdfImageElement findElement(std::uint32_t index, std::string_view name) const;
+    };
+
+    /**
+     * A binary TDF image is a compact, flattened copy of a TDF's XML element tree. Images are generated at build
+     * time, for every TDF in Bloom's codebase (see build/scripts/GenerateBriefTargetDescriptors.php), and stored
+     * alongside the TDFs, with a ".tdfi" extension.
+     *
+     * Images are memory-mapped and read in place - no XML parsing or DOM construction takes place. The
+     * TargetDescriptionFile class uses an image, if one is available and up to date, and falls back to the XML
+     * otherwise (see TargetDescriptionFile::init()).
+     *
+     * Image format (all integers are 32-bit little-endian):
+     *  - 8 byte magic ("BLTDFIMG")
+     *  - Format version (see TdfImage::FORMAT_VERSION)
+     *  - Size of the source XML file, in bytes
+     *  - String count, element count, attribute count and string data size
+     *  - String table - offset and size of each string, in the string data
+     *  - Element table, in document order (the root element is at index 0) - name string index, first attribute
+     *    index, attribute count, first child element index and next sibling element index. Absent children and
+     *    siblings are denoted by TdfImage::NONE.
+     *  - Attribute table - name and value string indices
+     *  - String data (UTF-8, not null-terminated)
+     *
+     * The build script (build/scripts/Targets/TargetDescriptionFiles/Services/BinaryImageService.php) must be kept
+     * in sync with this class. Any change to the format must be accompanied by an increment of FORMAT_VERSION.
+     */
+    class TdfImage
+    {
+    public:
+        static constexpr auto FORMAT_VERSION = std::uint32_t{1};
+        static constexpr auto FILE_EXTENSION = std::string_view{".tdfi"};
+
+        /**
+         * Memory-maps the binary TDF image at the given path.
+         *
+         * @param imagePath
+         *
+         * @throws TargetDescriptionParsingFailureException
+         *  If the image cannot be mapped, or it is invalid or of a different format version.
+         */
+        static TdfImage fromFile(const std::string& imagePath);
+
+        /**
+         * Builds an image, in memory, from the TDF XML read from the given device. The XML is parsed in a single
+         * pass, straight into the image tables - no DOM tree is constructed.
+         *
+         * @param device
+         *  An open device, positioned at the start of the XML.
+         *
+         * @throws TargetDescriptionParsingFailureException
+         *  If the XML is malformed.
+         */
+        static TdfImage fromXml(QIODevice& device);
+
+        /**
+         * Returns the path of the binary TDF image for the given TDF XML file path.
+         *
+         * @param xmlFilePath
+         * @return
+         */
+        static std::string imagePath(const std::string& xmlFilePath);
+
+        ~TdfImage();
+
+        TdfImage(const TdfImage& other) = delete;
+        TdfImage& operator = (const TdfImage& other) = delete;
+
+        TdfImage(TdfImage&& other) noexcept;
+        TdfImage& operator = (TdfImage&& other) = delete;
+
+        [[nodiscard]] TdfImageElement documentElement() const {
+            return TdfImageElement{this, 0};
+        }
+
+        /**
+         * The size of the XML file from which the image was generated. Zero for images built in memory.
+         *
+         * @return
+         */
+        [[nodiscard]] std::uint32_t sourceSize() const {
+            return this->sourceFileSize;
+        }
+
+        /**
+         * Compares the contents of this image with those of another, byte for byte. The source size is excluded
+         * from the comparison, as it's zero for images built in memory.
+         *
+         * The TargetDescriptionFile test uses this to check that images built via TdfImage::fromXml() are identical to
+         * those generated by the build script (see tests/TargetDescriptionFile).
+         *
+         * @param other
+         * @return
+         *  The offset of the first byte that differs, or std::nullopt if the images are identical.
+         */
+        [[nodiscard]] std::optional<std::size_t> findMismatch(const TdfImage& other) const;
+
+    private:
+        friend class TdfImageElement;
+
+        static constexpr auto MAGIC = std::string_view{"BLTDFIMG"};
+        static constexpr auto NONE = std::uint32_t{0xFFFFFFFF};
+
+        static constexpr auto HEADER_SIZE = MAGIC.size() + (6 * sizeof(std::uint32_t));
+        static constexpr auto SOURCE_SIZE_OFFSET = MAGIC.size() + sizeof(std::uint32_t);
+        static constexpr auto STRING_RECORD_SIZE = 2 * sizeof(std::uint32_t);
+        static constexpr auto ELEMENT_RECORD_SIZE = 5 * sizeof(std::uint32_t);
+        static constexpr auto ATTRIBUTE_RECORD_SIZE = 2 * sizeof(std::uint32_t);
+
+        /**
+         * Mapped images are unmapped upon destruction. In-memory images own their data via ownedData.
+         */
+        void* mapping = nullptr;
+        std::size_t mappingSize = 0;
+        std::vector<unsigned char> ownedData;
+
+        std::span<const unsigned char> data;
+
+        std::uint32_t sourceFileSize = 0;
+        std::uint32_t stringCount = 0;
+        std::uint32_t elementCount = 0;
+        std::uint32_t attributeCount = 0;
+
+        std::size_t stringTableOffset = 0;
+        std::size_t elementTableOffset = 0;
+        std::size_t attributeTableOffset = 0;
+        std::size_t stringDataOffset = 0;
+
+        TdfImage() = default;
+
+        /**
+         * Reads and validates the header and tables. Every index and string range in the image is checked, so that
+         * element views never need to perform bounds checks.
+         */
+        void loadTables();
+
+        [[nodiscard]] std::uint32_t readUint32(std::size_t offset) const {
+            return static_cast<std::uint32_t>(this->data[offset])
+                | (static_cast<std::uint32_t>(this->data[offset + 1]) << 8)
+                | (static_cast<std::uint32_t>(this->data[offset + 2]) << 16)
+                | (static_cast<std::uint32_t>(this->data[offset + 3]) << 24);
+        }
+
+        [[nodiscard]] std::string_view string(std::uint32_t index) const;
+
+        [[nodiscard]] std::uint32_t elementField(std::uint32_t elementIndex, std::uint32_t field) const {
+            return this->readUint32(
+                this->elementTableOffset + (elementIndex * ELEMENT_RECORD_SIZE) + (field * sizeof(std::uint32_t))
+            );
+        }
+
+        [[nodiscard]] std::uint32_t attributeField(std::uint32_t attributeIndex, std::uint32_t field) const {
+            return this->readUint32(
+                this->attributeTableOffset + (attributeIndex * ATTRIBUTE_RECORD_SIZE)
+                    + (field * sizeof(std::uint32_t))
+            );
+        }
+    };
+}
@@ -79,5 +79,7 @@ namespace Targets::TargetDescription
 
             return property->get();
         }
+
+        bool operator == (const Variant& other) const = default;
     };
 }
@@ -1,6 +1,7 @@
 #include "TargetDescriptor.hpp"
 
 #include <utility>
+#include <ranges>
 
 #include "src/Exceptions/InternalFatalErrorException.hpp"
 
@@ -205,4 +206,61 @@ namespace Targets
 
         return descriptor->get();
     }
+
+    void TargetDescriptor::buildRegisterGroupIndex() {
+        this->registerGroupDescriptorsByAbsoluteKey.clear();
+
+        for (const auto& peripheralDescriptor : this->peripheralDescriptorsByKey | std::views::values) {
+            for (const auto& groupDescriptor : peripheralDescriptor.registerGroupDescriptorsByKey | std::views::values) {
+                this->indexRegisterGroup(groupDescriptor);
+            }
+        }
+
+        this->registerGroupIndexBuilt = true;
+    }
+
+    std::optional<
+        std::reference_wrapper<const TargetRegisterGroupDescriptor>
+    > TargetDescriptor::tryGetRegisterGroupDescriptor(
+        std::string_view peripheralKey,
+        std::string_view absoluteGroupKey
+    ) const {
+        if (!this->registerGroupIndexBuilt) {
+            throw Exceptions::InternalFatalErrorException{
+                "Register group lookup on target descriptor \"" + this->name + "\" - index has not been built"
+            };
+        }
+
+        const auto descriptorIt = this->registerGroupDescriptorsByAbsoluteKey.find(
+            TargetDescriptor::registerGroupIndexKey(peripheralKey, absoluteGroupKey)
+        );
+        if (descriptorIt == this->registerGroupDescriptorsByAbsoluteKey.end()) {
+            return std::nullopt;
+        }
+
+        return std::cref(*(descriptorIt->second));
+    }
+
+    void TargetDescriptor::indexRegisterGroup(const TargetRegisterGroupDescriptor& groupDescriptor) {
+        this->registerGroupDescriptorsByAbsoluteKey.emplace(
+            TargetDescriptor::registerGroupIndexKey(groupDescriptor.peripheralKey, groupDescriptor.absoluteKey),
+            &groupDescriptor
+        );
+
+        for (const auto& subgroupDescriptor : groupDescriptor.subgroupDescriptorsByKey | std::views::values) {
+            this->indexRegisterGroup(subgroupDescriptor);
+        }
+    }
+
+    std::string TargetDescriptor::registerGroupIndexKey(
+        std::string_view peripheralKey,
+        std::string_view absoluteGroupKey
+    ) {
+        auto output = std::string{};
+        output.reserve(peripheralKey.size() + absoluteGroupKey.size() + 1);
+        output.append(peripheralKey);
+        output.push_back(':');
+        output.append(absoluteGroupKey);
+        return output;
+    }
 }
@@ -4,6 +4,9 @@
 #include <cstdint>
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <optional>
+#include <string_view>
 #include <functional>
 #include <algorithm>
 #include <QMetaType>
@@ -106,5 +109,35 @@ namespace Targets
         ) const;
 
         const TargetVariantDescriptor& getVariantDescriptor(const std::string& key) const;
+
+        /**
+         * Builds the register group index, which maps absolute register group keys to the register group descriptors
+         * in the peripheral descriptor tree. The index allows for constant-time lookups, avoiding the traversal of
+         * the tree (and the splitting of dotted group keys) on every lookup.
+         *
+         * The index holds pointers into the tree, so it must be rebuilt after any modification to the peripheral
+         * descriptors. The TargetController builds it once, after obtaining the descriptor from the target.
+         */
+        void buildRegisterGroupIndex();
+
+        /**
+         * Looks up a register group descriptor by its peripheral key and absolute key (e.g. "port.pin0ctrl"), via the
+         * register group index.
+         *
+         * @param peripheralKey
+         * @param absoluteGroupKey
+         * @return
+         */
+        [[nodiscard]] std::optional<
+            std::reference_wrapper<const TargetRegisterGroupDescriptor>
+        > tryGetRegisterGroupDescriptor(std::string_view peripheralKey, std::string_view absoluteGroupKey) const;
+
+    private:
+        bool registerGroupIndexBuilt = false;
+        std::unordered_map<std::string, const TargetRegisterGroupDescriptor*> registerGroupDescriptorsByAbsoluteKey;
+
+        void indexRegisterGroup(const TargetRegisterGroupDescriptor& groupDescriptor);
+
+        static std::string registerGroupIndexKey(std::string_view peripheralKey, std::string_view absoluteGroupKey);
     };
 }
@@ -33,5 +33,11 @@ namespace Targets
             : readable(readable)
             , writeable(writeable)
         {}
+
+        bool operator == (const TargetMemoryAccess& other) const {
+            return this->readable == other.readable
+                && this->writeable == other.writeable
+            ;
+        }
     };
 }
@@ -1,6 +1,7 @@
 #include "TargetMemoryCache.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <cassert>
 
 #include "src/Exceptions/Exception.hpp"
@@ -9,132 +10,273 @@ namespace Targets
 {
     TargetMemoryCache::TargetMemoryCache(const TargetMemorySegmentDescriptor& memorySegmentDescriptor)
         : memorySegmentDescriptor(memorySegmentDescriptor)
-        , data(TargetMemoryBuffer(memorySegmentDescriptor.size(), 0x00))
     {}
 
-    TargetMemoryBufferSpan TargetMemoryCache::fetch(TargetMemoryAddress startAddress, TargetMemorySize bytes) const {
-        const auto startIndex = startAddress - this->memorySegmentDescriptor.addressRange.startAddress;
+    TargetMemoryBuffer TargetMemoryCache::fetch(
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges
+    ) const {
+        this->validateAccess(startAddress, bytes);
 
-        if (
-            startAddress < this->memorySegmentDescriptor.addressRange.startAddress
-            || (startIndex + bytes) > this->data.size()
-        ) {
-            throw Exceptions::Exception{"Invalid cache access"};
+        if (!this->missingRanges(startAddress, bytes, excludedAddressRanges).empty()) {
+            throw Exceptions::Exception{"Invalid cache access - data not in cache"};
+        }
+
+        auto output = TargetMemoryBuffer(bytes, 0x00);
+        const auto segmentStartAddress = this->memorySegmentDescriptor.addressRange.startAddress;
+
+        auto offset = std::size_t{0};
+        while (offset < bytes) {
+            const auto segmentOffset = static_cast<std::size_t>(startAddress - segmentStartAddress) + offset;
+            const auto pageOffset = segmentOffset % TargetMemoryCache::PAGE_SIZE;
+            const auto chunkSize = std::min(
+                static_cast<std::size_t>(TargetMemoryCache::PAGE_SIZE) - pageOffset,
+                bytes - offset
+            );
+
+            const auto pageIt = this->pagesByIndex.find(segmentOffset / TargetMemoryCache::PAGE_SIZE);
+            if (pageIt != this->pagesByIndex.end()) {
+                /*
+                 * Unpopulated bytes in an allocated page will be 0x00, so we can copy the whole chunk without
+                 * checking excluded ranges.
+                 */
+                const auto pageBegin = pageIt->second.begin() + static_cast<long>(pageOffset);
+                std::copy(
+                    pageBegin,
+                    pageBegin + static_cast<long>(chunkSize),
+                    output.begin() + static_cast<long>(offset)
+                );
+            }
+
+            offset += chunkSize;
         }
 
-        return TargetMemoryBufferSpan{this->data.begin() + startIndex, this->data.begin() + startIndex + bytes};
+        return output;
     }
 
     bool TargetMemoryCache::contains(TargetMemoryAddress startAddress, TargetMemorySize bytes) const {
-        const auto intersectingSegmentIt = this->intersectingSegment(startAddress);
+        if (bytes == 0) {
+            return true;
+        }
 
-        return
-            intersectingSegmentIt != this->populatedSegments.end()
-            && intersectingSegmentIt->first <= startAddress
-            && intersectingSegmentIt->second >= (startAddress + bytes - 1);
-    }
+        const auto endAddress = static_cast<TargetMemoryAddress>(startAddress + bytes - 1);
 
-    void TargetMemoryCache::insert(TargetMemoryAddress startAddress, TargetMemoryBufferSpan data) {
-        std::copy(
-            data.begin(),
-            data.end(),
-            this->data.begin() + (startAddress - this->memorySegmentDescriptor.addressRange.startAddress)
-        );
+        // Find the last range starting at or before startAddress
+        auto rangeIt = this->populatedRanges.upper_bound(startAddress);
+        if (rangeIt == this->populatedRanges.begin()) {
+            return false;
+        }
 
-        this->trackSegment(startAddress, static_cast<TargetMemoryAddress>(startAddress + data.size() - 1));
+        --rangeIt;
+        return rangeIt->second >= endAddress;
     }
 
-    void TargetMemoryCache::fill(TargetMemoryAddress startAddress, TargetMemorySize size, unsigned char value) {
-        assert(this->data.size() >= (startAddress - this->memorySegmentDescriptor.addressRange.startAddress) + size);
+    std::vector<TargetMemoryAddressRange> TargetMemoryCache::missingRanges(
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges
+    ) const {
+        auto output = std::vector<TargetMemoryAddressRange>{};
 
-        for (auto i = std::size_t{0}; i < size; ++i) {
-            this->data[i + (startAddress - this->memorySegmentDescriptor.addressRange.startAddress)] = value;
+        if (bytes == 0) {
+            return output;
         }
 
-        this->trackSegment(startAddress, static_cast<TargetMemoryAddress>(startAddress + size - 1));
-    }
+        const auto endAddress = static_cast<std::uint64_t>(startAddress) + bytes - 1;
 
-    void TargetMemoryCache::clear() {
-        this->populatedSegments.clear();
-    }
+        /*
+         * We use 64-bit arithmetic here, as the "cursor" can move beyond the end of the 32-bit address space.
+         */
+        const auto addGap = [&output, &excludedAddressRanges] (std::uint64_t gapStart, std::uint64_t gapEnd) {
+            auto cursor = gapStart;
 
-    void TargetMemoryCache::trackSegment(TargetMemoryAddress startAddress, TargetMemoryAddress endAddress) {
-        const auto intersectingStartSegmentIt = this->intersectingSegment(startAddress);
-        const auto intersectingEndSegmentIt = this->intersectingSegment(endAddress);
+            for (const auto& excludedRange : excludedAddressRanges) {
+                if (excludedRange.endAddress < cursor) {
+                    continue;
+                }
 
-        if (
-            intersectingStartSegmentIt == this->populatedSegments.end()
-            && intersectingEndSegmentIt == this->populatedSegments.end()
-        ) {
-            this->populatedSegments.emplace(startAddress, endAddress);
-            return;
-        }
+                if (excludedRange.startAddress > gapEnd) {
+                    break;
+                }
 
-        if (intersectingStartSegmentIt == intersectingEndSegmentIt) {
-            // We already have a populated segment containing this address range. Nothing to do here.
-            return;
+                if (excludedRange.startAddress > cursor) {
+                    output.emplace_back(
+                        static_cast<TargetMemoryAddress>(cursor),
+                        static_cast<TargetMemoryAddress>(excludedRange.startAddress - 1)
+                    );
+                }
+
+                cursor = static_cast<std::uint64_t>(excludedRange.endAddress) + 1;
+            }
+
+            if (cursor <= gapEnd) {
+                output.emplace_back(static_cast<TargetMemoryAddress>(cursor), static_cast<TargetMemoryAddress>(gapEnd));
+            }
+        };
+
+        auto cursor = static_cast<std::uint64_t>(startAddress);
+        auto rangeIt = this->populatedRanges.upper_bound(startAddress);
+
+        if (rangeIt != this->populatedRanges.begin()) {
+            const auto previousRangeIt = std::prev(rangeIt);
+            if (previousRangeIt->second >= startAddress) {
+                cursor = static_cast<std::uint64_t>(previousRangeIt->second) + 1;
+            }
         }
 
-        auto newStartSegment = std::optional<decltype(this->populatedSegments)::value_type>{};
-        auto newEndSegment = std::optional<decltype(this->populatedSegments)::value_type>{};
+        for (; rangeIt != this->populatedRanges.end() && rangeIt->first <= endAddress; ++rangeIt) {
+            if (rangeIt->first > cursor) {
+                addGap(cursor, rangeIt->first - 1);
+            }
 
-        if (intersectingStartSegmentIt != this->populatedSegments.end()) {
-            newStartSegment.emplace(intersectingStartSegmentIt->first, endAddress);
-            this->populatedSegments.erase(intersectingStartSegmentIt);
+            cursor = static_cast<std::uint64_t>(rangeIt->second) + 1;
         }
 
-        if (intersectingEndSegmentIt != this->populatedSegments.end()) {
-            newEndSegment.emplace(startAddress, intersectingEndSegmentIt->second);
-            this->populatedSegments.erase(intersectingEndSegmentIt);
+        if (cursor <= endAddress) {
+            addGap(cursor, endAddress);
         }
 
-        if (newStartSegment.has_value() && newEndSegment.has_value()) {
-            // The two new segments overlap. Merge them into one and remove any segments between them
-            newStartSegment.emplace(newStartSegment->first, newEndSegment->second);
-            newEndSegment.reset();
+        return output;
+    }
 
-            for (
-                auto segmentIt = this->populatedSegments.upper_bound(newStartSegment->first);
-                segmentIt != this->populatedSegments.end();
-            ) {
-                if (segmentIt->second > newStartSegment->second) {
-                    break;
-                }
+    void TargetMemoryCache::insert(
+        TargetMemoryAddress startAddress,
+        TargetMemoryBufferSpan data,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges
+    ) {
+        if (data.empty()) {
+            return;
+        }
+
+        this->validateAccess(startAddress, static_cast<TargetMemorySize>(data.size()));
+
+        const auto endAddress = static_cast<TargetMemoryAddress>(startAddress + data.size() - 1);
+        auto cursor = static_cast<std::uint64_t>(startAddress);
+
+        const auto insertRange = [this, &data, startAddress] (std::uint64_t rangeStart, std::uint64_t rangeEnd) {
+            this->store(
+                static_cast<TargetMemoryAddress>(rangeStart),
+                data.subspan(
+                    static_cast<std::size_t>(rangeStart - startAddress),
+                    static_cast<std::size_t>(rangeEnd - rangeStart + 1)
+                )
+            );
+            this->trackRange(static_cast<TargetMemoryAddress>(rangeStart), static_cast<TargetMemoryAddress>(rangeEnd));
+        };
+
+        for (const auto& excludedRange : excludedAddressRanges) {
+            if (excludedRange.endAddress < cursor) {
+                continue;
+            }
+
+            if (excludedRange.startAddress > endAddress) {
+                break;
+            }
 
-                this->populatedSegments.erase(segmentIt++);
+            if (excludedRange.startAddress > cursor) {
+                insertRange(cursor, excludedRange.startAddress - 1);
             }
+
+            cursor = static_cast<std::uint64_t>(excludedRange.endAddress) + 1;
         }
 
-        if (newStartSegment.has_value()) {
-            this->populatedSegments.insert(*newStartSegment);
+        if (cursor <= endAddress) {
+            insertRange(cursor, endAddress);
         }
+    }
+
+    void TargetMemoryCache::fill(TargetMemoryAddress startAddress, TargetMemorySize size, unsigned char value) {
+        const auto data = TargetMemoryBuffer(size, value);
+        this->insert(startAddress, data);
+    }
+
+    void TargetMemoryCache::clear() {
+        this->populatedRanges.clear();
+        this->pagesByIndex.clear();
+    }
+
+    TargetMemoryBuffer TargetMemoryCache::dump(unsigned char unpopulatedValue) const {
+        const auto segmentStartAddress = this->memorySegmentDescriptor.addressRange.startAddress;
+        auto output = TargetMemoryBuffer(this->memorySegmentDescriptor.size(), unpopulatedValue);
 
-        if (newEndSegment.has_value()) {
-            this->populatedSegments.insert(*newEndSegment);
+        for (const auto& [rangeStartAddress, rangeEndAddress] : this->populatedRanges) {
+            const auto data = this->fetch(rangeStartAddress, rangeEndAddress - rangeStartAddress + 1);
+            std::copy(data.begin(), data.end(), output.begin() + (rangeStartAddress - segmentStartAddress));
         }
+
+        return output;
     }
 
-    TargetMemoryCache::SegmentIt TargetMemoryCache::intersectingSegment(TargetMemoryAddress address) const {
-        if (this->populatedSegments.empty()) {
-            return this->populatedSegments.end();
+    void TargetMemoryCache::store(TargetMemoryAddress startAddress, TargetMemoryBufferSpan data) {
+        const auto segmentStartAddress = this->memorySegmentDescriptor.addressRange.startAddress;
+
+        auto offset = std::size_t{0};
+        while (offset < data.size()) {
+            const auto segmentOffset = static_cast<std::size_t>(startAddress - segmentStartAddress) + offset;
+            const auto pageOffset = segmentOffset % TargetMemoryCache::PAGE_SIZE;
+            const auto chunkSize = std::min(
+                static_cast<std::size_t>(TargetMemoryCache::PAGE_SIZE) - pageOffset,
+                data.size() - offset
+            );
+
+            auto pageIt = this->pagesByIndex.find(segmentOffset / TargetMemoryCache::PAGE_SIZE);
+            if (pageIt == this->pagesByIndex.end()) {
+                pageIt = this->pagesByIndex.emplace(
+                    segmentOffset / TargetMemoryCache::PAGE_SIZE,
+                    TargetMemoryBuffer(TargetMemoryCache::PAGE_SIZE, 0x00)
+                ).first;
+            }
+
+            const auto chunkBegin = data.begin() + static_cast<long>(offset);
+            std::copy(
+                chunkBegin,
+                chunkBegin + static_cast<long>(chunkSize),
+                pageIt->second.begin() + static_cast<long>(pageOffset)
+            );
+
+            offset += chunkSize;
         }
+    }
+
+    void TargetMemoryCache::trackRange(TargetMemoryAddress startAddress, TargetMemoryAddress endAddress) {
+        assert(startAddress <= endAddress);
+
+        auto newStartAddress = startAddress;
+        auto newEndAddress = endAddress;
 
-        auto lowerBoundSegmentIt = this->populatedSegments.lower_bound(address);
+        // Merge with the preceding range, if it overlaps or is adjacent
+        auto rangeIt = this->populatedRanges.upper_bound(startAddress);
+        if (rangeIt != this->populatedRanges.begin()) {
+            const auto previousRangeIt = std::prev(rangeIt);
 
-        if (lowerBoundSegmentIt != this->populatedSegments.end()) {
-            if (lowerBoundSegmentIt->first != address && lowerBoundSegmentIt != this->populatedSegments.begin()) {
-                --lowerBoundSegmentIt;
+            if (static_cast<std::uint64_t>(previousRangeIt->second) + 1 >= startAddress) {
+                newStartAddress = previousRangeIt->first;
+                newEndAddress = std::max(newEndAddress, previousRangeIt->second);
+                this->populatedRanges.erase(previousRangeIt);
             }
+        }
 
-            return lowerBoundSegmentIt->first <= address && lowerBoundSegmentIt->second >= address
-                ? lowerBoundSegmentIt
-                : this->populatedSegments.end();
+        // Merge with any succeeding ranges that overlap or are adjacent
+        while (
+            rangeIt != this->populatedRanges.end()
+            && rangeIt->first <= static_cast<std::uint64_t>(newEndAddress) + 1
+        ) {
+            newEndAddress = std::max(newEndAddress, rangeIt->second);
+            rangeIt = this->populatedRanges.erase(rangeIt);
         }
 
-        // All the segments precede the given address. If the last segment doesn't intersect, none of them will.
-        const auto lastSegment = std::prev(this->populatedSegments.end());
-        return lastSegment->first <= address && lastSegment->second >= address
-            ? lastSegment
-            : this->populatedSegments.end();
+        this->populatedRanges.emplace_hint(rangeIt, newStartAddress, newEndAddress);
+    }
+
+    void TargetMemoryCache::validateAccess(TargetMemoryAddress startAddress, TargetMemorySize bytes) const {
+        const auto& segmentRange = this->memorySegmentDescriptor.addressRange;
+
+        if (
+            startAddress < segmentRange.startAddress
+            || (static_cast<std::uint64_t>(startAddress) + bytes - 1) > segmentRange.endAddress
+        ) {
+            throw Exceptions::Exception{"Invalid cache access"};
+        }
     }
 }
@@ -2,55 +2,144 @@
 
 #include <cstdint>
 #include <map>
+#include <set>
+#include <vector>
 
 #include "TargetMemorySegmentDescriptor.hpp"
+#include "TargetMemoryAddressRange.hpp"
 #include "TargetMemory.hpp"
 
 namespace Targets
 {
+    /**
+     * A sparse cache for a single memory segment.
+     *
+     * Cached data is held in fixed-size pages, which are only allocated when data is inserted into them. So caching a
+     * small region of a large memory segment will only allocate the pages spanning that region.
+     *
+     * Populated address ranges are tracked separately, at byte granularity, in an interval index. Inserting data
+     * within a page does not mark the rest of the page as populated.
+     */
     class TargetMemoryCache
     {
     public:
+        /**
+         * The size of each page of storage. This is unrelated to the page size of the memory segment.
+         */
+        static constexpr TargetMemorySize PAGE_SIZE = 256;
+
         const TargetMemorySegmentDescriptor& memorySegmentDescriptor;
-        TargetMemoryBuffer data;
 
         explicit TargetMemoryCache(const TargetMemorySegmentDescriptor& memorySegmentDescriptor);
 
-        [[nodiscard]] TargetMemoryBufferSpan fetch(TargetMemoryAddress startAddress, TargetMemorySize bytes) const;
+        /**
+         * Fetches data from the cache.
+         *
+         * All addresses in the given range, except those in excludedAddressRanges, must be populated. Excluded
+         * addresses that are not populated will be filled with 0x00.
+         *
+         * @param startAddress
+         * @param bytes
+         * @param excludedAddressRanges
+         *
+         * @return
+         */
+        [[nodiscard]] TargetMemoryBuffer fetch(
+            TargetMemoryAddress startAddress,
+            TargetMemorySize bytes,
+            const std::set<TargetMemoryAddressRange>& excludedAddressRanges = {}
+        ) const;
+
+        /**
+         * Checks if the cache holds data for the entire given range.
+         *
+         * @param startAddress
+         * @param bytes
+         *
+         * @return
+         */
         [[nodiscard]] bool contains(TargetMemoryAddress startAddress, TargetMemorySize bytes) const;
 
-        void insert(TargetMemoryAddress startAddress, TargetMemoryBufferSpan data);
+        /**
+         * Identifies the address ranges within the given range, for which the cache holds no data.
+         *
+         * @param startAddress
+         * @param bytes
+         * @param excludedAddressRanges
+         *  Ranges to omit from the output, even if they're not populated.
+         *
+         * @return
+         *  The missing ranges, in ascending order. Empty if the cache holds everything we need.
+         */
+        [[nodiscard]] std::vector<TargetMemoryAddressRange> missingRanges(
+            TargetMemoryAddress startAddress,
+            TargetMemorySize bytes,
+            const std::set<TargetMemoryAddressRange>& excludedAddressRanges = {}
+        ) const;
+
+        /**
+         * Inserts data into the cache.
+         *
+         * @param startAddress
+         * @param data
+         * @param excludedAddressRanges
+         *  Ranges within the data that should not be inserted (because they were excluded from the read that
+         *  obtained the data).
+         */
+        void insert(
+            TargetMemoryAddress startAddress,
+            TargetMemoryBufferSpan data,
+            const std::set<TargetMemoryAddressRange>& excludedAddressRanges = {}
+        );
+
         void fill(TargetMemoryAddress startAddress, TargetMemorySize size, unsigned char value);
 
         void clear();
 
+        /**
+         * Produces a dense copy of the entire memory segment, from the cache.
+         *
+         * @param unpopulatedValue
+         *  The value to use for any addresses that are not populated.
+         *
+         * @return
+         *  A buffer the size of the memory segment.
+         */
+        [[nodiscard]] TargetMemoryBuffer dump(unsigned char unpopulatedValue = 0x00) const;
+
     private:
         /**
-         * A populated segment is just an address range in the cache that we know we've populated.
+         * Allocated pages, mapped by page index (relative to the start of the memory segment).
+         */
+        std::map<std::size_t, TargetMemoryBuffer> pagesByIndex;
+
+        /**
+         * The interval index of populated address ranges.
+         *
+         * populatedRanges::value_type::first = The start address (inclusive) of the populated range
+         * populatedRanges::value_type::second = The end address (inclusive) of the populated range
          *
-         * populatedSegments::value_type::first = The start address (inclusive) of the populated range
-         * populatedSegments::value_type::second = The end address (inclusive) of the populated range
+         * Ranges never overlap and are never adjacent - overlapping and adjacent ranges are merged on insertion.
          */
-        std::map<TargetMemoryAddress, TargetMemoryAddress> populatedSegments = {};
+        std::map<TargetMemoryAddress, TargetMemoryAddress> populatedRanges;
 
         /**
-         * Tracks a newly populated segment.
+         * Copies the given data into the page storage, allocating pages as necessary. This does not update the
+         * interval index.
          *
          * @param startAddress
-         * @param endAddress
+         * @param data
          */
-        void trackSegment(TargetMemoryAddress startAddress, TargetMemoryAddress endAddress);
+        void store(TargetMemoryAddress startAddress, TargetMemoryBufferSpan data);
 
         /**
-         * Finds the segment that intersects with the given address. Segments cannot overlap, so only one segment can
-         * intersect with the given address, at any given time.
+         * Records a newly populated range in the interval index.
          *
-         * @param address
-         *
-         * @return
-         *  An iterator to the intersecting segment, or populatedSegments::end() if none is found.
+         * @param startAddress
+         * @param endAddress
          */
-        using SegmentIt = decltype(TargetMemoryCache::populatedSegments)::const_iterator;
-        [[nodiscard]] SegmentIt intersectingSegment(TargetMemoryAddress address) const;
+        void trackRange(TargetMemoryAddress startAddress, TargetMemoryAddress endAddress);
+
+        void validateAccess(TargetMemoryAddress startAddress, TargetMemorySize bytes) const;
     };
 }
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <iterator>
+#include <optional>
+
+#include "src/Targets/Microchip/Avr8/OpcodeDecoder/Decoder.hpp"
+#include "src/Targets/Microchip/Avr8/OpcodeDecoder/Instruction.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Tests
+{
+    /**
+     * The AVR8 opcode decoder, as it was before the dispatch table - each opcode decoder is tried in turn, until one
+     * accepts the opcode.
+     *
+     * Serves as the reference for the dispatch table decoder (Decoder::decode()).
+     */
+    class LinearDecoder: public Targets::Microchip::Avr8::OpcodeDecoder::Decoder
+    {
+    public:
+        using Instruction = Targets::Microchip::Avr8::OpcodeDecoder::Instruction;
+
+        static std::vector<InstructionMapping::Entry> decode(
+            Targets::TargetMemoryAddress startByteAddress,
+            const Targets::TargetMemoryBuffer& data
+        ) {
+            auto output = std::vector<InstructionMapping::Entry>{};
+
+            auto instructionByteAddress = startByteAddress;
+            auto dataIt = data.begin();
+
+            while (std::distance(dataIt, data.end()) >= 2) {
+                auto instruction = LinearDecoder::decodeOpcode(dataIt, data.end());
+                const auto instructionSize = instruction.has_value() ? instruction->byteSize : std::uint8_t{2};
+
+                output.emplace_back(instructionByteAddress, std::move(instruction));
+
+                dataIt += instructionSize;
+                instructionByteAddress += instructionSize;
+            }
+
+            return output;
+        }
+
+        static std::optional<Instruction> decodeOpcode(
+            const Targets::TargetMemoryBuffer::const_iterator& dataBegin,
+            const Targets::TargetMemoryBuffer::const_iterator& dataEnd
+        ) {
+            for (const auto& decoder : Decoder::opcodeDecoders()) {
+                auto instruction = decoder.decode(dataBegin, dataEnd);
+                if (instruction.has_value()) {
+                    return instruction;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        /**
+         * Decodes a single opcode via the dispatch table.
+         */
+        static std::optional<Instruction> dispatchDecodeOpcode(
+            const Targets::TargetMemoryBuffer::const_iterator& dataBegin,
+            const Targets::TargetMemoryBuffer::const_iterator& dataEnd
+        ) {
+            return Decoder::decodeOpcode(dataBegin, dataEnd);
+        }
+    };
+}
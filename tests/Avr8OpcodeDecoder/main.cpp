@@ -0,0 +1,148 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <optional>
+#include <random>
+#include <iostream>
+
+#include "src/Targets/Microchip/Avr8/OpcodeDecoder/Decoder.hpp"
+#include "src/Targets/Microchip/Avr8/OpcodeDecoder/Instruction.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+#include "src/Services/StringService.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+#include "tests/Helpers/Expect.hpp"
+#include "LinearDecoder.hpp"
+
+/*
+ * Checks that the AVR8 opcode decoder's dispatch table yields the same results as trying each opcode decoder in turn
+ * (LinearDecoder), for every possible first opcode word - alone, and followed by a second word - and for random
+ * program memory.
+ *
+ * Usage: Avr8OpcodeDecoderTest
+ */
+
+using Targets::Microchip::Avr8::OpcodeDecoder::Decoder;
+using Targets::Microchip::Avr8::OpcodeDecoder::Instruction;
+using Targets::TargetMemoryAddress;
+using Targets::TargetMemoryBuffer;
+
+using Services::StringService;
+
+using Tests::expect;
+using Tests::LinearDecoder;
+
+namespace
+{
+    constexpr auto RANDOM_DATA_SIZE = std::size_t{256 * 1024};
+
+    bool equal(const std::optional<Instruction>& lhs, const std::optional<Instruction>& rhs) {
+        if (!lhs.has_value() || !rhs.has_value()) {
+            return lhs.has_value() == rhs.has_value();
+        }
+
+        return lhs->name == rhs->name
+            && lhs->opcode == rhs->opcode
+            && lhs->byteSize == rhs->byteSize
+            && lhs->mnemonic == rhs->mnemonic
+            && lhs->canChangeProgramFlow == rhs->canChangeProgramFlow
+            && lhs->data == rhs->data
+            && lhs->sourceRegister == rhs->sourceRegister
+            && lhs->destinationRegister == rhs->destinationRegister
+            && lhs->programWordAddress == rhs->programWordAddress
+            && lhs->programWordAddressOffset == rhs->programWordAddressOffset
+            && lhs->canSkipNextInstruction == rhs->canSkipNextInstruction
+            && lhs->registerBitPosition == rhs->registerBitPosition
+            && lhs->statusRegisterBitPosition == rhs->statusRegisterBitPosition
+            && lhs->ioSpaceAddress == rhs->ioSpaceAddress
+            && lhs->dataSpaceAddress == rhs->dataSpaceAddress
+            && lhs->displacement == rhs->displacement;
+    }
+
+    std::string describe(const std::optional<Instruction>& instruction) {
+        return instruction.has_value()
+            ? instruction->name + " (0x" + StringService::toHex(instruction->opcode) + ")"
+            : "decode failure";
+    }
+
+    void expectEquivalent(const TargetMemoryBuffer& data, const std::string& description) {
+        const auto expected = LinearDecoder::decodeOpcode(data.begin(), data.end());
+        const auto actual = LinearDecoder::dispatchDecodeOpcode(data.begin(), data.end());
+
+        expect(
+            equal(actual, expected),
+            description + " - dispatch table yielded " + describe(actual) + ", expected " + describe(expected)
+        );
+    }
+
+    void testAllFirstWords() {
+        for (auto word = std::uint32_t{0}; word <= 0xFFFF; ++word) {
+            const auto lsb = static_cast<unsigned char>(word);
+            const auto msb = static_cast<unsigned char>(word >> 8);
+            const auto wordDescription = "opcode word 0x" + StringService::toHex(static_cast<std::uint16_t>(word));
+
+            // Alone, so that 32-bit opcodes are truncated
+            expectEquivalent({lsb, msb}, wordDescription);
+
+            // Followed by second words with all bits clear, all bits set, and a mix
+            expectEquivalent({lsb, msb, 0x00, 0x00}, wordDescription + " + 0x0000");
+            expectEquivalent({lsb, msb, 0xFF, 0xFF}, wordDescription + " + 0xFFFF");
+            expectEquivalent({lsb, msb, 0x5A, 0xC3}, wordDescription + " + 0xC35A");
+        }
+    }
+
+    void testRandomData() {
+        auto randomEngine = std::mt19937{0xB100A};
+        auto distribution = std::uniform_int_distribution<unsigned int>{0x00, 0xFF};
+
+        auto data = TargetMemoryBuffer(RANDOM_DATA_SIZE);
+        for (auto& byte : data) {
+            byte = static_cast<unsigned char>(distribution(randomEngine));
+        }
+
+        // An odd start address, and an odd data size, to check the handling of the trailing byte
+        data.push_back(0x94);
+        constexpr auto startAddress = TargetMemoryAddress{0x1001};
+
+        const auto expected = LinearDecoder::decode(startAddress, data);
+        const auto actual = Decoder::decode(startAddress, data);
+
+        expect(actual.size() == expected.size(), "Random data - instruction count");
+
+        auto expectedIt = expected.begin();
+        for (const auto& [address, instruction] : actual) {
+            expect(
+                address == expectedIt->first,
+                "Random data - instruction address 0x" + StringService::toHex(address)
+            );
+            expect(
+                equal(instruction, expectedIt->second),
+                "Random data - at 0x" + StringService::toHex(address) + ", dispatch table yielded "
+                    + describe(instruction) + ", expected " + describe(expectedIt->second)
+            );
+
+            expect(
+                actual.find(address)->first == address,
+                "Random data - find(0x" + StringService::toHex(address) + ")"
+            );
+            ++expectedIt;
+        }
+
+        expect(actual.find(startAddress + 1) == actual.end(), "Random data - find() misaligned address");
+        expect(actual.find(startAddress - 2) == actual.end(), "Random data - find() preceding address");
+    }
+}
+
+int main() {
+    try {
+        testAllFirstWords();
+        testRandomData();
+
+    } catch (const Exceptions::Exception& exception) {
+        std::cerr << "Failed: " << exception.getMessage() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
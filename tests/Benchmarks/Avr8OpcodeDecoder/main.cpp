@@ -0,0 +1,104 @@
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <functional>
+#include <iostream>
+
+#include "src/Targets/Microchip/Avr8/OpcodeDecoder/Decoder.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+#include "tests/Avr8OpcodeDecoder/LinearDecoder.hpp"
+
+/*
+ * Measures the time taken to decode random program memory, via the dispatch table and via the linear decoder.
+ *
+ * Each decoder is run for the given number of iterations (default: 5), over a fresh 256 KiB buffer each time. The
+ * dispatch table is built before measuring, so its one-off construction cost is reported separately.
+ *
+ * Usage: Avr8OpcodeDecoderBenchmark [iterations]
+ */
+
+using Targets::Microchip::Avr8::OpcodeDecoder::Decoder;
+using Targets::TargetMemoryBuffer;
+
+using Tests::LinearDecoder;
+
+namespace
+{
+    constexpr auto DATA_SIZE = std::size_t{256 * 1024};
+
+    std::vector<TargetMemoryBuffer> generateData(std::size_t count) {
+        auto randomEngine = std::mt19937{0xB100A};
+        auto distribution = std::uniform_int_distribution<unsigned int>{0x00, 0xFF};
+
+        auto output = std::vector<TargetMemoryBuffer>(count, TargetMemoryBuffer(DATA_SIZE));
+        for (auto& data : output) {
+            for (auto& byte : data) {
+                byte = static_cast<unsigned char>(distribution(randomEngine));
+            }
+        }
+
+        return output;
+    }
+
+    /**
+     * Runs the given function once for each buffer, and reports the total time taken.
+     *
+     * @return
+     *  The number of instructions decoded, so that the decoding can't be optimised away.
+     */
+    std::size_t measure(
+        const std::string& name,
+        const std::vector<TargetMemoryBuffer>& buffers,
+        const std::function<std::size_t(const TargetMemoryBuffer&)>& decode
+    ) {
+        auto instructionCount = std::size_t{0};
+
+        const auto startTime = std::chrono::steady_clock::now();
+        for (const auto& data : buffers) {
+            instructionCount += decode(data);
+        }
+
+        const auto duration = std::chrono::duration<double, std::milli>{std::chrono::steady_clock::now() - startTime};
+        const auto mebibytes = static_cast<double>(buffers.size() * DATA_SIZE) / (1024 * 1024);
+
+        std::cout << name << ": " << duration.count() << " ms (" << mebibytes / (duration.count() / 1000)
+            << " MiB/s, " << instructionCount << " instructions)\n";
+
+        return instructionCount;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const auto iterations = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 5;
+    if (iterations == 0) {
+        std::cerr << "Usage: " << argv[0] << " [iterations]\n";
+        return 2;
+    }
+
+    const auto buffers = generateData(iterations);
+
+    const auto warmUpStartTime = std::chrono::steady_clock::now();
+    static_cast<void>(Decoder::decode(0, TargetMemoryBuffer{0x00, 0x00}));
+    std::cout << "Dispatch table construction: " << std::chrono::duration<double, std::milli>{
+        std::chrono::steady_clock::now() - warmUpStartTime
+    }.count() << " ms\n";
+
+    const auto dispatchCount = measure("Dispatch table", buffers, [] (const TargetMemoryBuffer& data) {
+        return Decoder::decode(0, data).size();
+    });
+
+    const auto linearCount = measure("Linear", buffers, [] (const TargetMemoryBuffer& data) {
+        return LinearDecoder::decode(0, data).size();
+    });
+
+    if (dispatchCount != linearCount) {
+        std::cerr << "Instruction count mismatch - see Avr8OpcodeDecoderTest\n";
+        return 1;
+    }
+
+    return 0;
+}
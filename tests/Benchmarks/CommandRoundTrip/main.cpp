@@ -0,0 +1,291 @@
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <queue>
+#include <map>
+#include <memory>
+#include <future>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+
+#include "src/Helpers/MpscQueue.hpp"
+#include "src/Helpers/Synchronised.hpp"
+#include "src/Helpers/ConditionVariableNotifier.hpp"
+#include "src/Helpers/AdaptivePoller.hpp"
+
+/*
+ * Measures the round-trip latency of commands issued by a single GDB client thread, whilst a number of Insight worker
+ * threads issue commands concurrently.
+ *
+ * A simulated TargetController thread services the commands, spending a fixed amount of time on each one (to stand
+ * in for the debug tool round trip). The benchmark is run against two command channels:
+ *
+ *  - SharedResponseMapChannel: the mechanism the TargetController used to use. Commands are queued in a
+ *    Synchronised<std::queue>, and responses are placed in a Synchronised<std::map>, keyed by command ID. Every
+ *    response wakes every waiting client thread (via a single condition variable), each of which checks the map for
+ *    its response.
+ *
+ *  - QueueAndFutureChannel: the mechanism the TargetController uses now (see
+ *    TargetControllerComponent::registerCommand()). Commands are pushed onto an MpscQueue, alongside a promise for
+ *    their response. Only the issuing thread is woken when the response is delivered.
+ *
+ * Usage: CommandRoundTripBenchmark [GDB command count] [Insight thread count] [service time, in microseconds]
+ */
+
+namespace
+{
+    using CommandId = std::uint64_t;
+
+    struct Command
+    {
+        CommandId id;
+    };
+
+    struct Response
+    {
+        CommandId commandId;
+    };
+
+    class SharedResponseMapChannel
+    {
+    public:
+        static constexpr auto NAME = "Shared response map and condition variable";
+
+        explicit SharedResponseMapChannel(ConditionVariableNotifier& notifier)
+            : notifier(notifier)
+        {}
+
+        std::unique_ptr<Response> sendAndWait(CommandId commandId) {
+            this->commandQueue.accessor()->push(std::make_unique<Command>(Command{.id = commandId}));
+            this->notifier.notify();
+
+            auto response = std::unique_ptr<Response>{};
+            auto lock = this->responsesByCommandId.lock();
+
+            this->responsesByCommandIdCv.wait(lock, [this, commandId, &response] {
+                auto& responsesByCommandId = this->responsesByCommandId.unsafeReference();
+                const auto responseIt = responsesByCommandId.find(commandId);
+
+                if (responseIt == responsesByCommandId.end()) {
+                    ++(this->wakeUps);
+                    return false;
+                }
+
+                response.swap(responseIt->second);
+                responsesByCommandId.erase(responseIt);
+                return true;
+            });
+
+            return response;
+        }
+
+        /**
+         * Services all queued commands. Must only be called from the TargetController thread.
+         */
+        template <typename ServiceFunction>
+        void process(ServiceFunction&& service) {
+            auto commands = std::queue<std::unique_ptr<Command>>{};
+            commands.swap(*(this->commandQueue.accessor()));
+
+            while (!commands.empty()) {
+                service();
+
+                const auto commandId = commands.front()->id;
+                this->responsesByCommandId.accessor()->emplace(
+                    commandId,
+                    std::make_unique<Response>(Response{.commandId = commandId})
+                );
+                this->responsesByCommandIdCv.notify_all();
+
+                commands.pop();
+            }
+        }
+
+        /**
+         * The number of times a client thread was woken for a response that wasn't its own (including the initial
+         * check, before waiting).
+         */
+        [[nodiscard]] std::uint64_t redundantWakeUps() const {
+            return this->wakeUps;
+        }
+
+    private:
+        ConditionVariableNotifier& notifier;
+
+        Synchronised<std::queue<std::unique_ptr<Command>>> commandQueue;
+        Synchronised<std::map<CommandId, std::unique_ptr<Response>>> responsesByCommandId;
+        std::condition_variable responsesByCommandIdCv;
+
+        /**
+         * Only modified whilst holding the responsesByCommandId lock.
+         */
+        std::uint64_t wakeUps = 0;
+    };
+
+    class QueueAndFutureChannel
+    {
+    public:
+        static constexpr auto NAME = "MPSC queue and per-command futures";
+
+        explicit QueueAndFutureChannel(ConditionVariableNotifier& notifier)
+            : notifier(notifier)
+        {}
+
+        std::unique_ptr<Response> sendAndWait(CommandId commandId) {
+            auto queuedCommand = QueuedCommand{
+                .command = std::make_unique<Command>(Command{.id = commandId}),
+                .responsePromise = {},
+            };
+            auto responseFuture = queuedCommand.responsePromise.get_future();
+
+            this->commandQueue.push(std::move(queuedCommand));
+            this->notifier.notify();
+
+            return responseFuture.get();
+        }
+
+        template <typename ServiceFunction>
+        void process(ServiceFunction&& service) {
+            while (auto queuedCommand = this->commandQueue.tryPop()) {
+                service();
+
+                const auto commandId = queuedCommand->command->id;
+                queuedCommand->responsePromise.set_value(std::make_unique<Response>(Response{.commandId = commandId}));
+            }
+        }
+
+        [[nodiscard]] std::uint64_t redundantWakeUps() const {
+            return 0;
+        }
+
+    private:
+        struct QueuedCommand
+        {
+            std::unique_ptr<Command> command;
+            std::promise<std::unique_ptr<Response>> responsePromise;
+        };
+
+        ConditionVariableNotifier& notifier;
+        MpscQueue<QueuedCommand> commandQueue;
+    };
+
+    struct BenchmarkConfig
+    {
+        std::size_t gdbCommandCount = 2000;
+        std::size_t insightThreadCount = 4;
+        std::chrono::microseconds serviceTime = std::chrono::microseconds{20};
+    };
+
+    /**
+     * Spins for the given duration. Sleeping would hand the measurement over to the scheduler's timer slack.
+     */
+    void busyWait(std::chrono::microseconds duration) {
+        const auto endTime = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < endTime) {}
+    }
+
+    template <typename ChannelType>
+    void run(const BenchmarkConfig& config) {
+        auto notifier = ConditionVariableNotifier{};
+        auto channel = ChannelType{notifier};
+
+        auto nextCommandId = std::atomic<CommandId>{1};
+        auto stopClients = std::atomic<bool>{false};
+        auto stopTargetController = std::atomic<bool>{false};
+
+        auto targetControllerThread = std::thread{[&] {
+            while (!stopTargetController.load()) {
+                notifier.waitForNotification(std::chrono::milliseconds{10});
+                channel.process([&config] {
+                    busyWait(config.serviceTime);
+                });
+            }
+        }};
+
+        auto insightCommandCount = std::atomic<std::uint64_t>{0};
+        auto insightThreads = std::vector<std::thread>{};
+        for (auto i = std::size_t{0}; i < config.insightThreadCount; ++i) {
+            insightThreads.emplace_back([&] {
+                while (!stopClients.load()) {
+                    const auto commandId = nextCommandId++;
+                    if (channel.sendAndWait(commandId)->commandId != commandId) {
+                        std::abort();
+                    }
+
+                    ++insightCommandCount;
+                }
+            });
+        }
+
+        auto gdbLatencies = LatencyHistogram{};
+        const auto startTime = std::chrono::steady_clock::now();
+
+        for (auto i = std::size_t{0}; i < config.gdbCommandCount; ++i) {
+            const auto commandId = nextCommandId++;
+            const auto sendTime = std::chrono::steady_clock::now();
+
+            if (channel.sendAndWait(commandId)->commandId != commandId) {
+                std::abort();
+            }
+
+            gdbLatencies.record(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - sendTime)
+            );
+        }
+
+        const auto duration = std::chrono::duration<double, std::milli>{std::chrono::steady_clock::now() - startTime};
+
+        /*
+         * The Insight threads may be waiting on a response, so the TargetController thread must keep servicing
+         * commands until they've all stopped.
+         */
+        stopClients = true;
+        for (auto& thread : insightThreads) {
+            thread.join();
+        }
+
+        stopTargetController = true;
+        notifier.notify();
+        targetControllerThread.join();
+
+        std::cout << ChannelType::NAME << ":\n"
+            << "  GDB round trip - " << gdbLatencies.toString() << "\n"
+            << "  Insight commands serviced concurrently: " << insightCommandCount.load() << "\n"
+            << "  Redundant client wake-ups: " << channel.redundantWakeUps() << "\n"
+            << "  Duration: " << duration.count() << " ms\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    auto config = BenchmarkConfig{};
+
+    if (argc > 1) {
+        config.gdbCommandCount = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+
+    if (argc > 2) {
+        config.insightThreadCount = static_cast<std::size_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+
+    if (argc > 3) {
+        config.serviceTime = std::chrono::microseconds{std::strtol(argv[3], nullptr, 10)};
+    }
+
+    if (config.gdbCommandCount == 0) {
+        std::cerr << "Usage: " << argv[0]
+            << " [GDB command count] [Insight thread count] [service time, in microseconds]\n";
+        return 2;
+    }
+
+    std::cout << "GDB commands: " << config.gdbCommandCount << ", Insight threads: " << config.insightThreadCount
+        << ", service time: " << config.serviceTime.count() << "us\n\n";
+
+    run<SharedResponseMapChannel>(config);
+    run<QueueAndFutureChannel>(config);
+
+    return 0;
+}
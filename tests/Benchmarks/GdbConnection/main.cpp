@@ -0,0 +1,345 @@
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <array>
+#include <random>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+
+#include "src/DebugServer/Gdb/Connection.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/Helpers/EventFdNotifier.hpp"
+#include "src/Helpers/AdaptivePoller.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+/*
+ * Replays a GDB RSP session through a socketpair, with a DebugServer::Gdb::Connection on the server end and a
+ * simulated GDB client on the other, and reports the packet round-trip latency and throughput.
+ *
+ * The session follows what avr-gdb sends when connecting to Bloom, loading a 32 KiB program, and then stepping
+ * through it whilst inspecting registers and memory:
+ *
+ *  - Feature negotiation (with packet acknowledgement, until QStartNoAckMode)
+ *  - 32 binary memory writes (X packets) of 1 KiB each, with random data, so that escaping is exercised
+ *  - Steps (vCont;s), each followed by a register read (g) and a memory read (m) of the stack
+ *  - Large memory reads (2 KiB of RAM, in hex)
+ *  - Detach
+ *
+ * The server checks that each packet it reads matches the one the client sent, after unescaping.
+ *
+ * Usage: GdbConnectionBenchmark [iterations]
+ */
+
+using DebugServer::Gdb::Connection;
+using DebugServer::Gdb::ResponsePackets::ResponsePacket;
+
+namespace
+{
+    constexpr auto PROGRAM_SIZE = std::size_t{32 * 1024};
+    constexpr auto WRITE_SIZE = std::size_t{1024};
+    constexpr auto STEP_COUNT = std::size_t{500};
+    constexpr auto LARGE_READ_COUNT = std::size_t{20};
+
+    struct Exchange
+    {
+        /**
+         * The packet data sent by the client, before escaping.
+         */
+        std::vector<unsigned char> command;
+        std::string response;
+        bool acknowledged = false;
+    };
+
+    std::vector<unsigned char> toBytes(const std::string& string) {
+        return {string.begin(), string.end()};
+    }
+
+    std::string hex(std::size_t byteCount, unsigned char seed) {
+        static constexpr auto HEX_DIGITS = std::array<char, 16>{
+            '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+        };
+
+        auto output = std::string{};
+        output.reserve(byteCount * 2);
+
+        for (auto i = std::size_t{0}; i < byteCount; ++i) {
+            const auto byte = static_cast<unsigned char>(i * 31 + seed);
+            output.push_back(HEX_DIGITS[byte >> 4]);
+            output.push_back(HEX_DIGITS[byte & 0x0F]);
+        }
+
+        return output;
+    }
+
+    std::vector<Exchange> session() {
+        auto output = std::vector<Exchange>{};
+
+        output.push_back(Exchange{
+            .command = toBytes(
+                "qSupported:multiprocess+;swbreak+;hwbreak+;qRelocInsn+;fork-events+;vfork-events+;exec-events+;"
+                    "vContSupported+;QThreadEvents+;no-resumed+;memory-tagging+"
+            ),
+            .response = "PacketSize=1fffff;qXfer:memory-map:read+;swbreak+;hwbreak+;QStartNoAckMode+",
+            .acknowledged = true,
+        });
+        output.push_back(Exchange{.command = toBytes("QStartNoAckMode"), .response = "OK", .acknowledged = true});
+        output.push_back(Exchange{.command = toBytes("Hg0"), .response = ""});
+        output.push_back(Exchange{
+            .command = toBytes("qXfer:memory-map:read::0,1fb"),
+            .response = "l<memory-map><memory type=\"ram\" start=\"0x800000\" length=\"0x900\"/><memory type=\"flash\" "
+                "start=\"0\" length=\"0x8000\"><property name=\"blocksize\">0x80</property></memory></memory-map>",
+        });
+        output.push_back(Exchange{.command = toBytes("?"), .response = "S05"});
+        output.push_back(Exchange{.command = toBytes("g"), .response = hex(39, 0x00)});
+
+        auto randomEngine = std::mt19937{0xB100A};
+        auto distribution = std::uniform_int_distribution<unsigned int>{0x00, 0xFF};
+
+        for (auto address = std::size_t{0}; address < PROGRAM_SIZE; address += WRITE_SIZE) {
+            auto command = toBytes("X" + std::to_string(address) + "," + std::to_string(WRITE_SIZE) + ":");
+            for (auto i = std::size_t{0}; i < WRITE_SIZE; ++i) {
+                command.push_back(static_cast<unsigned char>(distribution(randomEngine)));
+            }
+
+            output.push_back(Exchange{.command = std::move(command), .response = "OK"});
+        }
+
+        for (auto step = std::size_t{0}; step < STEP_COUNT; ++step) {
+            const auto seed = static_cast<unsigned char>(step);
+            output.push_back(Exchange{
+                .command = toBytes("vCont;s:1"),
+                .response = "T0520:" + hex(1, seed) + ";21:" + hex(2, seed) + ";22:" + hex(4, seed) + ";thread:1;",
+            });
+            output.push_back(Exchange{.command = toBytes("g"), .response = hex(39, seed)});
+            output.push_back(Exchange{.command = toBytes("m8008e0,20"), .response = hex(32, seed)});
+        }
+
+        for (auto read = std::size_t{0}; read < LARGE_READ_COUNT; ++read) {
+            output.push_back(Exchange{
+                .command = toBytes("m800100,800"),
+                .response = hex(2048, static_cast<unsigned char>(read)),
+            });
+        }
+
+        output.push_back(Exchange{.command = toBytes("D"), .response = "OK"});
+
+        return output;
+    }
+
+    std::vector<unsigned char> frame(const std::vector<unsigned char>& data) {
+        static constexpr auto HEX_DIGITS = std::array<unsigned char, 16>{
+            '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+        };
+
+        auto output = std::vector<unsigned char>{'$'};
+        auto checksum = std::uint8_t{0};
+
+        for (const auto byte : data) {
+            if (byte == '$' || byte == '#' || byte == '}' || byte == '*') {
+                const auto escapedByte = static_cast<unsigned char>(byte ^ 0x20);
+                output.push_back('}');
+                output.push_back(escapedByte);
+                checksum = static_cast<std::uint8_t>(checksum + '}' + escapedByte);
+                continue;
+            }
+
+            output.push_back(byte);
+            checksum += byte;
+        }
+
+        output.push_back('#');
+        output.push_back(HEX_DIGITS[checksum >> 4]);
+        output.push_back(HEX_DIGITS[checksum & 0x0F]);
+        return output;
+    }
+
+    void writeAll(int fileDescriptor, const unsigned char* data, std::size_t size) {
+        while (size > 0) {
+            const auto bytesWritten = ::write(fileDescriptor, data, size);
+            if (bytesWritten <= 0) {
+                std::cerr << "Client write failed\n";
+                std::abort();
+            }
+
+            data += bytesWritten;
+            size -= static_cast<std::size_t>(bytesWritten);
+        }
+    }
+
+    /**
+     * Plays the part of GDB - sends each command and waits for the response (and the acknowledgement of the command,
+     * where acknowledgement is enabled).
+     *
+     * @return
+     *  The round-trip latencies.
+     */
+    LatencyHistogram runClient(int socketFileDescriptor, const std::vector<Exchange>& exchanges) {
+        auto latencies = LatencyHistogram{};
+        auto buffer = std::vector<unsigned char>(Connection::ABSOLUTE_MAXIMUM_PACKET_READ_SIZE);
+        auto bufferedBytes = std::size_t{0};
+
+        for (const auto& exchange : exchanges) {
+            const auto framedCommand = frame(exchange.command);
+            const auto sendTime = std::chrono::steady_clock::now();
+
+            writeAll(socketFileDescriptor, framedCommand.data(), framedCommand.size());
+
+            // Wait for the complete response frame ('$' ... '#' + two checksum digits)
+            auto frameEnd = std::optional<std::size_t>{};
+            while (!frameEnd.has_value()) {
+                const auto terminatorIt = std::find(
+                    buffer.begin(),
+                    buffer.begin() + static_cast<long>(bufferedBytes),
+                    '#'
+                );
+                const auto terminatorIndex = static_cast<std::size_t>(terminatorIt - buffer.begin());
+
+                if (terminatorIndex + 2 < bufferedBytes) {
+                    frameEnd = terminatorIndex + 3;
+                    break;
+                }
+
+                const auto bytesRead = ::read(
+                    socketFileDescriptor,
+                    buffer.data() + bufferedBytes,
+                    buffer.size() - bufferedBytes
+                );
+                if (bytesRead <= 0) {
+                    std::cerr << "Client read failed\n";
+                    std::abort();
+                }
+
+                bufferedBytes += static_cast<std::size_t>(bytesRead);
+            }
+
+            latencies.record(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - sendTime)
+            );
+
+            const auto expectedAckCount = exchange.acknowledged ? std::size_t{1} : std::size_t{0};
+            const auto responseStart = static_cast<std::size_t>(
+                std::find(buffer.begin(), buffer.begin() + static_cast<long>(*frameEnd), '$') - buffer.begin()
+            );
+            if (responseStart != expectedAckCount) {
+                std::cerr << "Unexpected data before response frame\n";
+                std::abort();
+            }
+
+            if (exchange.acknowledged) {
+                writeAll(socketFileDescriptor, reinterpret_cast<const unsigned char*>("+"), 1);
+            }
+
+            std::copy(
+                buffer.begin() + static_cast<long>(*frameEnd),
+                buffer.begin() + static_cast<long>(bufferedBytes),
+                buffer.begin()
+            );
+            bufferedBytes -= *frameEnd;
+        }
+
+        ::close(socketFileDescriptor);
+        return latencies;
+    }
+
+    /**
+     * Plays the part of the GDB server - reads each command via the Connection and writes the recorded response.
+     */
+    void runServer(Connection& connection, const std::vector<Exchange>& exchanges) {
+        auto exchangeIt = exchanges.begin();
+        connection.packetAcknowledgement = true;
+
+        while (exchangeIt != exchanges.end()) {
+            for (const auto& rawPacket : connection.readRawPackets()) {
+                const auto& exchange = *exchangeIt;
+                const auto packetData = rawPacket.subspan(1, rawPacket.size() - 4);
+
+                if (
+                    !std::equal(packetData.begin(), packetData.end(), exchange.command.begin(), exchange.command.end())
+                ) {
+                    throw Exceptions::Exception{"Packet mismatch - server read different data to that sent"};
+                }
+
+                connection.writePacket(ResponsePacket{exchange.response});
+
+                if (exchange.command == toBytes("QStartNoAckMode")) {
+                    connection.packetAcknowledgement = false;
+                }
+
+                ++exchangeIt;
+            }
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const auto iterations = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 5;
+    if (iterations == 0) {
+        std::cerr << "Usage: " << argv[0] << " [iterations]\n";
+        return 2;
+    }
+
+    Logger::silence();
+
+    const auto exchanges = session();
+
+    auto commandBytes = std::size_t{0};
+    auto responseBytes = std::size_t{0};
+    for (const auto& exchange : exchanges) {
+        commandBytes += frame(exchange.command).size();
+        responseBytes += frame(toBytes(exchange.response)).size();
+    }
+
+    std::cout << "Session: " << exchanges.size() << " packets, " << commandBytes << " bytes sent by client, "
+        << responseBytes << " bytes sent by server\n";
+
+    try {
+        auto totalDuration = std::chrono::duration<double, std::milli>{0};
+
+        for (auto iteration = std::size_t{0}; iteration < iterations; ++iteration) {
+            auto socketFileDescriptors = std::array<int, 2>{};
+            if (::socketpair(AF_UNIX, SOCK_STREAM, 0, socketFileDescriptors.data()) != 0) {
+                throw Exceptions::Exception{"Failed to create socketpair"};
+            }
+
+            auto interruptEventNotifier = EventFdNotifier{};
+            auto connection = Connection::fromConnectedSocket(socketFileDescriptors[0], interruptEventNotifier);
+
+            const auto startTime = std::chrono::steady_clock::now();
+
+            auto clientLatencies = LatencyHistogram{};
+            auto clientThread = std::thread{[&] {
+                clientLatencies = runClient(socketFileDescriptors[1], exchanges);
+            }};
+
+            runServer(connection, exchanges);
+            clientThread.join();
+
+            const auto duration = std::chrono::duration<double, std::milli>{
+                std::chrono::steady_clock::now() - startTime
+            };
+            totalDuration += duration;
+
+            std::cout << "Iteration " << iteration + 1 << ": " << duration.count() << " ms - "
+                << clientLatencies.toString() << "\n";
+        }
+
+        const auto averageDuration = totalDuration.count() / static_cast<double>(iterations);
+        std::cout << "Average: " << averageDuration << " ms per session, "
+            << static_cast<double>(exchanges.size()) / (averageDuration / 1000) << " packets/s, "
+            << static_cast<double>(commandBytes + responseBytes) / (1024 * 1024) / (averageDuration / 1000)
+            << " MiB/s\n";
+
+    } catch (const Exceptions::Exception& exception) {
+        std::cerr << "Failed: " << exception.getMessage() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
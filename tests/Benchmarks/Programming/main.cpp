@@ -0,0 +1,270 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <iostream>
+#include <QString>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugTranslator.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugTranslatorConfig.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/Simulator/SimulatedDebugModule.hpp"
+
+#include "src/Targets/RiscV/TargetDescriptionFile.hpp"
+#include "src/Targets/RiscV/RiscVTargetConfig.hpp"
+#include "src/Targets/TargetMemoryAddressRange.hpp"
+#include "src/Targets/TargetState.hpp"
+
+#include "src/TargetController/ProgrammingStats.hpp"
+
+#include "src/ProjectConfig.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+/*
+ * Writes synthetic program images, of varying size and sparsity, to the simulated RISC-V debug module, via the
+ * DebugTranslator, once for each memory access strategy. Each image is written and then verified (read back and
+ * compared), in the way the TargetController services a GDB "load" followed by "compare-sections".
+ *
+ * The results are printed as JSON, with a ProgrammingSessionStats object for each run - the same form as the
+ * "monitor programming machine" GDB command - so they can be tracked across releases.
+ *
+ * The simulated debug module doesn't model the vendor-specific flash programming mechanisms (e.g. the WCH-Link's
+ * flash commands) - the simulated program memory is writable over the system bus. So these figures cover the DMI
+ * path that all RISC-V memory access goes through, and no erase operations take place. The "usbTransfers" figure is
+ * what the DMI operations would cost over a WCH-Link, where each DMI operation is one bulk command and one bulk
+ * response. Verification time is reported separately ("verifyDurationUs"), as ProgrammingSessionStats has no field
+ * for it.
+ *
+ * Usage: ProgrammingBenchmark <path to RISC-V TDF>
+ */
+
+using DebugToolDrivers::Protocols::RiscVDebug::DebugTranslator;
+using DebugToolDrivers::Protocols::RiscVDebug::DebugTranslatorConfig;
+using DebugToolDrivers::Protocols::RiscVDebug::DebugModule::MemoryAccessStrategy;
+using DebugToolDrivers::Protocols::RiscVDebug::Simulator::SimulatedDebugModule;
+using DebugToolDrivers::Protocols::RiscVDebug::Simulator::SimulatedDebugModuleConfig;
+using DebugToolDrivers::Protocols::RiscVDebug::Simulator::SimulatedMemoryRegionConfig;
+
+using Targets::TargetMemoryAddress;
+using Targets::TargetMemorySize;
+using Targets::TargetMemoryBuffer;
+using Targets::TargetMemoryAddressRange;
+using Targets::TargetExecutionState;
+
+using TargetController::ProgrammingSessionStats;
+
+namespace
+{
+    constexpr auto PROGRAM_MEMORY_START_ADDRESS = TargetMemoryAddress{0x00000000};
+    constexpr auto PROGRAM_MEMORY_SIZE = TargetMemorySize{0x4000};
+
+    /**
+     * A synthetic program image - a set of populated regions within program memory.
+     */
+    struct Image
+    {
+        std::string name;
+        TargetMemorySize size;
+
+        /**
+         * The size of each populated region, and the distance between the start of one region and the next.
+         * Dense images consist of a single region.
+         */
+        TargetMemorySize regionSize;
+        TargetMemorySize regionStride;
+
+        [[nodiscard]] std::vector<TargetMemoryAddressRange> regions() const {
+            auto output = std::vector<TargetMemoryAddressRange>{};
+
+            for (auto offset = TargetMemorySize{0}; offset < this->size; offset += this->regionStride) {
+                const auto startAddress = PROGRAM_MEMORY_START_ADDRESS + offset;
+                output.emplace_back(startAddress, startAddress + std::min(this->regionSize, this->size - offset) - 1);
+            }
+
+            return output;
+        }
+    };
+
+    std::vector<Image> images() {
+        auto output = std::vector<Image>{};
+
+        for (const auto size : {TargetMemorySize{1024}, TargetMemorySize{4096}, PROGRAM_MEMORY_SIZE}) {
+            const auto sizeName = std::to_string(size / 1024) + "KiB";
+            output.push_back(Image{sizeName + " dense", size, size, size});
+            output.push_back(Image{sizeName + " sparse", size, 256, 512});
+            output.push_back(Image{sizeName + " fragmented", size, 16, 64});
+        }
+
+        return output;
+    }
+
+    std::string strategyName(MemoryAccessStrategy strategy) {
+        switch (strategy) {
+            case MemoryAccessStrategy::ABSTRACT_COMMAND: {
+                return "ABSTRACT_COMMAND";
+            }
+            case MemoryAccessStrategy::PROGRAM_BUFFER: {
+                return "PROGRAM_BUFFER";
+            }
+            case MemoryAccessStrategy::SYSTEM_BUS: {
+                return "SYSTEM_BUS";
+            }
+        }
+
+        return "UNKNOWN";
+    }
+
+    std::chrono::microseconds toMicroseconds(std::chrono::steady_clock::duration duration) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration);
+    }
+
+    QJsonObject run(
+        const Targets::RiscV::TargetDescriptionFile& targetDescriptionFile,
+        MemoryAccessStrategy memoryAccessStrategy,
+        const Image& image
+    ) {
+        auto debugModuleConfig = SimulatedDebugModuleConfig{};
+        debugModuleConfig.memoryRegions = {
+            SimulatedMemoryRegionConfig{
+                .name = "program memory",
+                .startAddress = PROGRAM_MEMORY_START_ADDRESS,
+                .size = PROGRAM_MEMORY_SIZE,
+                .writable = true,
+            },
+            SimulatedMemoryRegionConfig{.name = "ram", .startAddress = 0x20000000, .size = 0x0800, .writable = true},
+        };
+
+        auto debugModule = SimulatedDebugModule{debugModuleConfig};
+
+        auto translatorConfig = DebugTranslatorConfig{};
+        translatorConfig.preferredMemoryAccessStrategy = memoryAccessStrategy;
+
+        auto translator = DebugTranslator{
+            debugModule,
+            translatorConfig,
+            targetDescriptionFile,
+            Targets::RiscV::RiscVTargetConfig{TargetConfig{}}
+        };
+
+        translator.activate();
+        if (translator.getExecutionState() != TargetExecutionState::STOPPED) {
+            throw Exceptions::Exception{"Hart not halted upon activation"};
+        }
+
+        const auto sysAddressSpaceDescriptor = targetDescriptionFile.getSystemAddressSpaceDescriptor();
+        const auto& programSegmentDescriptor = sysAddressSpaceDescriptor.getMemorySegmentDescriptor(
+            "mapped_program_memory"
+        );
+
+        auto randomEngine = std::mt19937{0xB100A};
+        auto distribution = std::uniform_int_distribution<unsigned int>{0x00, 0xFF};
+
+        const auto regions = image.regions();
+        auto regionData = std::vector<TargetMemoryBuffer>{};
+        for (const auto& region : regions) {
+            auto& data = regionData.emplace_back(region.size());
+            for (auto& byte : data) {
+                byte = static_cast<unsigned char>(distribution(randomEngine));
+            }
+        }
+
+        debugModule.resetStatistics();
+        auto stats = ProgrammingSessionStats{};
+        auto writeDuration = std::chrono::steady_clock::duration{};
+        const auto sessionStartTime = std::chrono::steady_clock::now();
+
+        for (auto i = std::size_t{0}; i < regions.size(); ++i) {
+            const auto writeStartTime = std::chrono::steady_clock::now();
+            translator.writeMemory(
+                sysAddressSpaceDescriptor,
+                programSegmentDescriptor,
+                regions[i].startAddress,
+                regionData[i]
+            );
+
+            writeDuration += std::chrono::steady_clock::now() - writeStartTime;
+            stats.requestedBytes += regionData[i].size();
+            stats.writtenBytes += regionData[i].size();
+            ++(stats.writeOperations);
+        }
+
+        // Accumulated at full resolution, as the write of a small region can take less than a microsecond
+        stats.writeDuration = toMicroseconds(writeDuration);
+        stats.totalDuration = toMicroseconds(std::chrono::steady_clock::now() - sessionStartTime);
+        stats.usbTransfers = debugModule.getStatistics().transactions() * 2;
+
+        const auto verifyStartTime = std::chrono::steady_clock::now();
+        for (auto i = std::size_t{0}; i < regions.size(); ++i) {
+            const auto data = translator.readMemory(
+                sysAddressSpaceDescriptor,
+                programSegmentDescriptor,
+                regions[i].startAddress,
+                regions[i].size(),
+                {}
+            );
+
+            if (data != regionData[i]) {
+                throw Exceptions::Exception{
+                    "Verification failed for " + image.name + " image (" + strategyName(memoryAccessStrategy) + ")"
+                };
+            }
+        }
+
+        const auto verifyDuration = toMicroseconds(std::chrono::steady_clock::now() - verifyStartTime);
+
+        translator.deactivate();
+
+        return QJsonObject{
+            {"image", QString::fromStdString(image.name)},
+            {"imageSize", static_cast<qint64>(image.size)},
+            {"regionCount", static_cast<qint64>(regions.size())},
+            {"memoryAccessStrategy", QString::fromStdString(strategyName(memoryAccessStrategy))},
+            {"session", stats.toJson()},
+            {"verifyDurationUs", static_cast<qint64>(verifyDuration.count())},
+        };
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <path to RISC-V TDF>\n";
+        return 2;
+    }
+
+    Logger::silence();
+
+    try {
+        const auto targetDescriptionFile = Targets::RiscV::TargetDescriptionFile{argv[1]};
+
+        auto results = QJsonArray{};
+        for (
+            const auto strategy : {
+                MemoryAccessStrategy::ABSTRACT_COMMAND,
+                MemoryAccessStrategy::PROGRAM_BUFFER,
+                MemoryAccessStrategy::SYSTEM_BUS,
+            }
+        ) {
+            for (const auto& image : images()) {
+                results.append(run(targetDescriptionFile, strategy, image));
+            }
+        }
+
+        const auto output = QJsonObject{
+            {"version", QString{BLOOM_VERSION}},
+            {"results", results},
+        };
+
+        std::cout << QJsonDocument{output}.toJson().toStdString();
+
+    } catch (const Exceptions::Exception& exception) {
+        std::cerr << "Failed: " << exception.getMessage() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Tests
+{
+    /**
+     * Throws an Exceptions::Exception, with the given description, if the condition doesn't hold.
+     *
+     * Bloom's tests are plain executables - each one catches the exception in main(), reports the failed check and
+     * exits with a non-zero status, which CTest treats as a failure.
+     *
+     * @param condition
+     * @param description
+     */
+    inline void expect(bool condition, const std::string& description) {
+        if (!condition) {
+            throw Exceptions::Exception{"Check failed: " + description};
+        }
+    }
+}
@@ -0,0 +1,533 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <set>
+#include <iostream>
+#include <optional>
+
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugTranslator.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DebugTranslatorConfig.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/Simulator/SimulatedDebugModule.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/DmiBatch.hpp"
+#include "src/DebugToolDrivers/Protocols/RiscVDebug/Exceptions/DmiBatchInterrupted.hpp"
+
+#include "src/Targets/RiscV/TargetDescriptionFile.hpp"
+#include "src/Targets/RiscV/RiscVTargetConfig.hpp"
+#include "src/Targets/TargetRegisterDescriptor.hpp"
+#include "src/Targets/TargetState.hpp"
+
+#include "src/ProjectConfig.hpp"
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+#include "tests/Helpers/Expect.hpp"
+
+/*
+ * Drives the RISC-V DebugTranslator against the simulated debug module, once for each memory access strategy,
+ * checking the results of each operation against the state of the simulated hart and memory.
+ *
+ * The number of DMI round trips and transactions required for each operation is checked against a budget, so that
+ * any change to the DebugTranslator that increases the number of round trips fails the test. The budgets are the
+ * counts at the time they were last updated - if a change reduces the counts, the budgets should be lowered to
+ * match (the counts are printed upon success).
+ *
+ * Each strategy is then exercised via a DTM that interrupts DMI batches part way through (see
+ * InterruptingDebugModule), to check that the DebugTranslator recovers without the interruption being noticed.
+ *
+ * Usage: RiscVDebugTranslatorTest <path to RISC-V TDF>
+ */
+
+using DebugToolDrivers::Protocols::RiscVDebug::DebugTranslator;
+using DebugToolDrivers::Protocols::RiscVDebug::DmiBatch;
+using DebugToolDrivers::Protocols::RiscVDebug::DebugModule::DmiOperation;
+using DebugToolDrivers::Protocols::RiscVDebug::DebugModule::RegisterValue;
+using DebugToolDrivers::Protocols::RiscVDebug::DebugTranslatorConfig;
+using DebugToolDrivers::Protocols::RiscVDebug::DebugModule::MemoryAccessStrategy;
+using DebugToolDrivers::Protocols::RiscVDebug::Simulator::SimulatedDebugModule;
+using DebugToolDrivers::Protocols::RiscVDebug::Simulator::SimulatedDebugModuleConfig;
+
+using Targets::TargetMemoryAddress;
+using Targets::TargetMemoryBuffer;
+using Targets::TargetRegisterDescriptor;
+using Targets::TargetRegisterDescriptors;
+using Targets::TargetRegisterDescriptorAndValuePairs;
+using Targets::TargetExecutionState;
+
+using Tests::expect;
+
+namespace
+{
+    /*
+     * loop:
+     *   addi x10, x10, 1
+     *   jal x0, loop
+     */
+    const auto PROGRAM = TargetMemoryBuffer{0x13, 0x05, 0x15, 0x00, 0x6F, 0xF0, 0xDF, 0xFF};
+
+    TargetMemoryBuffer toBuffer(std::uint32_t value) {
+        return {
+            static_cast<unsigned char>(value >> 24),
+            static_cast<unsigned char>(value >> 16),
+            static_cast<unsigned char>(value >> 8),
+            static_cast<unsigned char>(value),
+        };
+    }
+
+    std::uint32_t fromBuffer(const TargetMemoryBuffer& buffer) {
+        return static_cast<std::uint32_t>(buffer[0] << 24) | static_cast<std::uint32_t>(buffer[1] << 16)
+            | static_cast<std::uint32_t>(buffer[2] << 8) | static_cast<std::uint32_t>(buffer[3]);
+    }
+
+    TargetRegisterDescriptor registerDescriptor(
+        const std::string& key,
+        const std::string& addressSpaceKey,
+        TargetMemoryAddress registerNumber,
+        Targets::TargetRegisterType type
+    ) {
+        return TargetRegisterDescriptor{
+            key,
+            key,
+            "cpu",
+            "cpu",
+            addressSpaceKey,
+            registerNumber,
+            4,
+            type,
+            Targets::TargetRegisterAccess{true, true},
+            std::nullopt,
+            {}
+        };
+    }
+
+    std::string strategyName(MemoryAccessStrategy strategy) {
+        switch (strategy) {
+            case MemoryAccessStrategy::ABSTRACT_COMMAND: {
+                return "ABSTRACT_COMMAND";
+            }
+            case MemoryAccessStrategy::PROGRAM_BUFFER: {
+                return "PROGRAM_BUFFER";
+            }
+            case MemoryAccessStrategy::SYSTEM_BUS: {
+                return "SYSTEM_BUS";
+            }
+        }
+
+        return "UNKNOWN";
+    }
+
+    /**
+     * A simulated debug module behind a DTM that reports a busy DMI operation part way through every Nth batch, as
+     * the WCH-Link does when pipelining (see WchLinkInterface::executeDmiBatch()).
+     *
+     * The operation at the midpoint of the interrupted batch is dropped, the others are performed, and a
+     * DmiBatchInterrupted exception is thrown. The DebugTranslator disables pipelining upon the first interruption,
+     * so only one batch is interrupted per session.
+     */
+    class InterruptingDebugModule: public SimulatedDebugModule
+    {
+    public:
+        InterruptingDebugModule(const SimulatedDebugModuleConfig& config, std::uint32_t interruptInterval)
+            : SimulatedDebugModule(config)
+            , interruptInterval(interruptInterval)
+        {}
+
+        std::vector<RegisterValue> executeDmiBatch(const DmiBatch& batch) override {
+            if (++(this->batchCount) % this->interruptInterval != 0 || batch.size() < 2) {
+                return SimulatedDebugModule::executeDmiBatch(batch);
+            }
+
+            ++(this->interruptCount);
+
+            const auto& operations = batch.operations();
+            auto performedOperations = DmiBatch{};
+
+            for (auto i = std::size_t{0}; i < operations.size(); ++i) {
+                if (i == operations.size() / 2) {
+                    continue;
+                }
+
+                if (operations[i].operation == DmiOperation::READ) {
+                    performedOperations.read(operations[i].address);
+                    continue;
+                }
+
+                performedOperations.write(operations[i].address, operations[i].value);
+            }
+
+            SimulatedDebugModule::executeDmiBatch(performedOperations);
+            throw Exceptions::DmiBatchInterrupted{"Simulated busy DMI operation"};
+        }
+
+        [[nodiscard]] std::uint32_t getInterruptCount() const {
+            return this->interruptCount;
+        }
+
+    private:
+        std::uint32_t interruptInterval;
+        std::uint32_t batchCount = 0;
+        std::uint32_t interruptCount = 0;
+    };
+
+    /**
+     * The maximum number of DMI round trips and transactions (see SimulatedDebugModule::Statistics) for an operation.
+     */
+    struct DmiBudget
+    {
+        std::uint64_t roundTrips;
+        std::uint64_t transactions;
+    };
+
+    /**
+     * Operations without a budget (std::nullopt) are not checked.
+     */
+    struct RunBudgets
+    {
+        std::optional<DmiBudget> writeRegisters;
+        std::optional<DmiBudget> readRegisters;
+        std::optional<DmiBudget> writeRam;
+        std::optional<DmiBudget> readRam;
+        std::optional<DmiBudget> readProgramMemory;
+        std::optional<DmiBudget> runToBreakpoint;
+        std::optional<DmiBudget> step;
+    };
+
+    /**
+     * Performs the given operation and checks the number of DMI round trips and transactions it required against
+     * the budget, if there is one.
+     */
+    template <typename OperationType>
+    void measure(
+        SimulatedDebugModule& debugModule,
+        const std::string& runName,
+        const std::string& operationName,
+        const std::optional<DmiBudget>& budget,
+        OperationType&& operation
+    ) {
+        debugModule.resetStatistics();
+        operation();
+
+        if (!budget.has_value()) {
+            return;
+        }
+
+        const auto& statistics = debugModule.getStatistics();
+        std::cout << runName << " - " << operationName << ": " << statistics.roundTrips() << " round trip(s), "
+            << statistics.transactions() << " transaction(s)\n";
+
+        expect(
+            statistics.roundTrips() <= budget->roundTrips,
+            operationName + " round trips (" + std::to_string(statistics.roundTrips()) + ") within budget ("
+                + std::to_string(budget->roundTrips) + ")"
+        );
+        expect(
+            statistics.transactions() <= budget->transactions,
+            operationName + " transactions (" + std::to_string(statistics.transactions()) + ") within budget ("
+                + std::to_string(budget->transactions) + ")"
+        );
+    }
+
+    void run(
+        const Targets::RiscV::TargetDescriptionFile& targetDescriptionFile,
+        SimulatedDebugModule& debugModule,
+        MemoryAccessStrategy memoryAccessStrategy,
+        const std::string& runName,
+        const RunBudgets& budgets
+    ) {
+        debugModule.getMemory().load(0x00000000, PROGRAM);
+
+        auto translatorConfig = DebugTranslatorConfig{};
+        translatorConfig.preferredMemoryAccessStrategy = memoryAccessStrategy;
+
+        auto translator = DebugTranslator{
+            debugModule,
+            translatorConfig,
+            targetDescriptionFile,
+            Targets::RiscV::RiscVTargetConfig{TargetConfig{}}
+        };
+
+        translator.activate();
+        expect(translator.getExecutionState() == TargetExecutionState::STOPPED, "hart halted upon activation");
+
+        const auto sysAddressSpaceDescriptor = targetDescriptionFile.getSystemAddressSpaceDescriptor();
+        const auto& ramSegmentDescriptor = sysAddressSpaceDescriptor.getMemorySegmentDescriptor("internal_ram");
+        const auto& programSegmentDescriptor = sysAddressSpaceDescriptor.getMemorySegmentDescriptor(
+            "mapped_program_memory"
+        );
+
+        // GPRs x1 - x15, followed by the DPC
+        auto registerDescriptorList = std::vector<TargetRegisterDescriptor>{};
+        for (auto i = std::uint8_t{1}; i <= 15; ++i) {
+            registerDescriptorList.emplace_back(
+                registerDescriptor(
+                    "x" + std::to_string(i),
+                    "gpr",
+                    0x1000 + i,
+                    Targets::TargetRegisterType::GENERAL_PURPOSE_REGISTER
+                )
+            );
+        }
+
+        registerDescriptorList.emplace_back(
+            registerDescriptor("dpc", "csr", 0x7B1, Targets::TargetRegisterType::OTHER)
+        );
+
+        const auto& x10Descriptor = registerDescriptorList[9];
+        const auto& dpcDescriptor = registerDescriptorList.back();
+
+        auto registerDescriptors = TargetRegisterDescriptors{};
+        auto registerValues = TargetRegisterDescriptorAndValuePairs{};
+        for (auto i = std::size_t{0}; i < registerDescriptorList.size() - 1; ++i) {
+            registerDescriptors.push_back(&registerDescriptorList[i]);
+            registerValues.emplace_back(
+                registerDescriptorList[i],
+                toBuffer(0xA5000000 | static_cast<std::uint32_t>(i * 0x01010101))
+            );
+        }
+
+        registerValues.emplace_back(dpcDescriptor, toBuffer(0x00000000));
+        registerDescriptors.push_back(&dpcDescriptor);
+
+        measure(debugModule, runName, "register write", budgets.writeRegisters, [&] {
+            translator.writeCpuRegisters(registerValues);
+        });
+
+        auto readRegisters = TargetRegisterDescriptorAndValuePairs{};
+        measure(debugModule, runName, "register read", budgets.readRegisters, [&] {
+            readRegisters = translator.readCpuRegisters(registerDescriptors);
+        });
+
+        expect(readRegisters.size() == registerValues.size(), "register read count");
+
+        for (auto i = std::size_t{0}; i < readRegisters.size(); ++i) {
+            expect(
+                readRegisters[i].second == registerValues[i].second,
+                "register value for " + readRegisters[i].first.key
+            );
+            expect(
+                debugModule.getHart().readRegister(
+                    static_cast<DebugToolDrivers::Protocols::RiscVDebug::RegisterNumber>(
+                        readRegisters[i].first.startAddress
+                    )
+                ) == fromBuffer(registerValues[i].second),
+                "simulated hart register value for " + readRegisters[i].first.key
+            );
+        }
+
+        // Unaligned RAM write and read, spanning several words
+        const auto ramStartAddress = ramSegmentDescriptor.addressRange.startAddress + 3;
+        auto ramData = TargetMemoryBuffer(61);
+        for (auto i = std::size_t{0}; i < ramData.size(); ++i) {
+            ramData[i] = static_cast<unsigned char>(0x30 + i);
+        }
+
+        measure(debugModule, runName, "RAM write", budgets.writeRam, [&] {
+            translator.writeMemory(sysAddressSpaceDescriptor, ramSegmentDescriptor, ramStartAddress, ramData);
+        });
+
+        expect(
+            debugModule.getMemory().dump(ramStartAddress, static_cast<Targets::TargetMemorySize>(ramData.size()))
+                == ramData,
+            "simulated RAM contents after write"
+        );
+
+        auto readRamData = TargetMemoryBuffer{};
+        measure(debugModule, runName, "RAM read", budgets.readRam, [&] {
+            readRamData = translator.readMemory(
+                sysAddressSpaceDescriptor,
+                ramSegmentDescriptor,
+                ramStartAddress,
+                static_cast<Targets::TargetMemorySize>(ramData.size()),
+                {}
+            );
+        });
+
+        expect(readRamData == ramData, "RAM read");
+
+        auto readProgramData = TargetMemoryBuffer{};
+        measure(debugModule, runName, "program memory read", budgets.readProgramMemory, [&] {
+            readProgramData = translator.readMemory(
+                sysAddressSpaceDescriptor,
+                programSegmentDescriptor,
+                programSegmentDescriptor.addressRange.startAddress,
+                static_cast<Targets::TargetMemorySize>(PROGRAM.size()),
+                {}
+            );
+        });
+
+        expect(readProgramData == PROGRAM, "program memory read");
+
+        // Run to a trigger breakpoint on the jal instruction
+        auto executionState = TargetExecutionState::RUNNING;
+        measure(debugModule, runName, "run to breakpoint", budgets.runToBreakpoint, [&] {
+            translator.insertTriggerBreakpoint(0x00000004);
+            translator.run();
+
+            for (auto attempt = 0; attempt < 100 && executionState != TargetExecutionState::STOPPED; ++attempt) {
+                executionState = translator.getExecutionState();
+            }
+        });
+
+        expect(executionState == TargetExecutionState::STOPPED, "hart halted at trigger breakpoint");
+
+        const auto stoppedRegisters = translator.readCpuRegisters({&x10Descriptor, &dpcDescriptor});
+        expect(fromBuffer(stoppedRegisters[1].second) == 0x00000004, "DPC at trigger breakpoint");
+        expect(
+            fromBuffer(stoppedRegisters[0].second) == fromBuffer(registerValues[9].second) + 1,
+            "x10 incremented before trigger breakpoint"
+        );
+
+        // Step over the jal
+        translator.clearTriggerBreakpoint(0x00000004);
+
+        measure(debugModule, runName, "step", budgets.step, [&] {
+            translator.step();
+        });
+
+        expect(translator.getExecutionState() == TargetExecutionState::STOPPED, "hart halted after step");
+        expect(fromBuffer(translator.readCpuRegisters({&dpcDescriptor})[0].second) == 0x00000000, "DPC after step");
+
+        // Only system bus access allows for reading memory whilst the hart is running
+        expect(
+            translator.canReadMemoryWhileRunning() == (memoryAccessStrategy == MemoryAccessStrategy::SYSTEM_BUS),
+            "memory readable whilst running, via system bus only"
+        );
+
+        if (translator.canReadMemoryWhileRunning()) {
+            translator.run();
+            expect(translator.getExecutionState() == TargetExecutionState::RUNNING, "hart running");
+
+            const auto runningProgramData = translator.readMemory(
+                sysAddressSpaceDescriptor,
+                programSegmentDescriptor,
+                programSegmentDescriptor.addressRange.startAddress,
+                static_cast<Targets::TargetMemorySize>(PROGRAM.size()),
+                {}
+            );
+
+            expect(runningProgramData == PROGRAM, "program memory read whilst running");
+            expect(translator.getExecutionState() == TargetExecutionState::RUNNING, "hart still running");
+
+            translator.stop();
+        }
+
+        translator.deactivate();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <path to RISC-V TDF>\n";
+        return 2;
+    }
+
+    Logger::silence();
+
+    try {
+        const auto targetDescriptionFile = Targets::RiscV::TargetDescriptionFile{argv[1]};
+
+        auto abstractCommandDebugModule = SimulatedDebugModule{SimulatedDebugModuleConfig{}};
+        run(
+            targetDescriptionFile,
+            abstractCommandDebugModule,
+            MemoryAccessStrategy::ABSTRACT_COMMAND,
+            strategyName(MemoryAccessStrategy::ABSTRACT_COMMAND),
+            RunBudgets{
+                .writeRegisters = DmiBudget{48, 16},
+                .readRegisters = DmiBudget{23, 4},
+                .writeRam = DmiBudget{26, 4},
+                .readRam = DmiBudget{22, 2},
+                .readProgramMemory = DmiBudget{8, 2},
+                .runToBreakpoint = DmiBudget{13, 7},
+                .step = DmiBudget{11, 6},
+            }
+        );
+
+        auto programBufferDebugModule = SimulatedDebugModule{SimulatedDebugModuleConfig{}};
+        run(
+            targetDescriptionFile,
+            programBufferDebugModule,
+            MemoryAccessStrategy::PROGRAM_BUFFER,
+            strategyName(MemoryAccessStrategy::PROGRAM_BUFFER),
+            RunBudgets{
+                .writeRegisters = DmiBudget{48, 16},
+                .readRegisters = DmiBudget{23, 4},
+                .writeRam = DmiBudget{60, 20},
+                .readRam = DmiBudget{42, 13},
+                .readProgramMemory = DmiBudget{26, 13},
+                .runToBreakpoint = DmiBudget{13, 7},
+                .step = DmiBudget{11, 6},
+            }
+        );
+
+        auto systemBusDebugModule = SimulatedDebugModule{SimulatedDebugModuleConfig{}};
+        run(
+            targetDescriptionFile,
+            systemBusDebugModule,
+            MemoryAccessStrategy::SYSTEM_BUS,
+            strategyName(MemoryAccessStrategy::SYSTEM_BUS),
+            RunBudgets{
+                .writeRegisters = DmiBudget{48, 16},
+                .readRegisters = DmiBudget{23, 4},
+                .writeRam = DmiBudget{25, 25},
+                .readRam = DmiBudget{21, 21},
+                .readProgramMemory = DmiBudget{7, 7},
+                .runToBreakpoint = DmiBudget{13, 7},
+                .step = DmiBudget{11, 6},
+            }
+        );
+
+        // Abstract commands that take a few abstractcs reads to complete, to exercise the DebugTranslator's polling
+        auto busyDebugModule = SimulatedDebugModule{SimulatedDebugModuleConfig{.abstractCommandBusyReads = 2}};
+        run(
+            targetDescriptionFile,
+            busyDebugModule,
+            MemoryAccessStrategy::ABSTRACT_COMMAND,
+            strategyName(MemoryAccessStrategy::ABSTRACT_COMMAND) + " (busy)",
+            RunBudgets{
+                .writeRegisters = DmiBudget{80, 48},
+                .readRegisters = DmiBudget{106, 72},
+                .writeRam = DmiBudget{115, 77},
+                .readRam = DmiBudget{81, 65},
+                .readProgramMemory = DmiBudget{11, 9},
+                .runToBreakpoint = DmiBudget{19, 13},
+                .step = DmiBudget{17, 12},
+            }
+        );
+
+        /*
+         * Interrupted runs have no DMI budgets - we only check that the DebugTranslator recovers and that the results
+         * are unaffected. The interrupt interval is varied, so that the interruption lands on different batches.
+         */
+        for (
+            const auto strategy : {
+                MemoryAccessStrategy::ABSTRACT_COMMAND,
+                MemoryAccessStrategy::PROGRAM_BUFFER,
+                MemoryAccessStrategy::SYSTEM_BUS,
+            }
+        ) {
+            for (auto interruptInterval = std::uint32_t{1}; interruptInterval <= 16; ++interruptInterval) {
+                auto interruptingDebugModule = InterruptingDebugModule{SimulatedDebugModuleConfig{}, interruptInterval};
+                run(
+                    targetDescriptionFile,
+                    interruptingDebugModule,
+                    strategy,
+                    strategyName(strategy) + " (interrupted every " + std::to_string(interruptInterval)
+                        + " batches)",
+                    RunBudgets{}
+                );
+
+                expect(
+                    interruptingDebugModule.getInterruptCount() > 0,
+                    strategyName(strategy) + " run was interrupted (interval: " + std::to_string(interruptInterval)
+                        + ")"
+                );
+            }
+        }
+
+    } catch (const Exceptions::Exception& exception) {
+        std::cerr << "Failed: " << exception.getMessage() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
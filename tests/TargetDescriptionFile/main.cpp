@@ -0,0 +1,311 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <array>
+#include <map>
+#include <unordered_map>
+#include <optional>
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <iostream>
+#include <QFile>
+#include <QDomDocument>
+#include <QDomElement>
+
+#include "src/Targets/TargetDescription/TargetDescriptionFile.hpp"
+#include "src/Targets/TargetDescription/TdfImage.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+#include "tests/Helpers/Expect.hpp"
+
+/*
+ * Parses every TDF in the given directory twice - once via QDomDocument and once via the streaming parser
+ * (TdfImage::fromXml()) - and checks that the resulting TargetDescriptionFile structures are identical.
+ *
+ * Bloom no longer parses TDFs via QDomDocument, so the DOM is converted to a binary TDF image here (see TdfImage for
+ * the format), which is then loaded in the same way as the images generated at build time.
+ *
+ * If a TDF is accompanied by a binary image generated by the build script (see GenerateBriefTargetDescriptors.php),
+ * the image built by the streaming parser is also checked against it, byte for byte, along with the structures
+ * loaded from it.
+ *
+ * Usage: TargetDescriptionFileTest <path to directory containing TDFs>
+ */
+
+using Targets::TargetDescription::TargetDescriptionFile;
+using Targets::TargetDescription::TdfImage;
+
+using Tests::expect;
+
+namespace
+{
+    class ParsedTargetDescriptionFile: public TargetDescriptionFile
+    {
+    public:
+        explicit ParsedTargetDescriptionFile(const TdfImage& image) {
+            this->init(image);
+        }
+
+        /**
+         * Returns the name of the first part of the target description that differs from the other, or
+         * std::nullopt if the two are identical.
+         */
+        [[nodiscard]] std::optional<std::string> findDifference(const ParsedTargetDescriptionFile& other) const {
+            if (this->deviceAttributesByName != other.deviceAttributesByName) {
+                return "device attributes";
+            }
+
+            if (this->propertyGroupsByKey != other.propertyGroupsByKey) {
+                return "property groups";
+            }
+
+            if (this->addressSpacesByKey != other.addressSpacesByKey) {
+                return "address spaces";
+            }
+
+            if (this->physicalInterfaces != other.physicalInterfaces) {
+                return "physical interfaces";
+            }
+
+            if (this->modulesByKey != other.modulesByKey) {
+                return "modules";
+            }
+
+            if (this->peripheralsByKey != other.peripheralsByKey) {
+                return "peripherals";
+            }
+
+            if (this->padsByKey != other.padsByKey) {
+                return "pads";
+            }
+
+            if (this->pinoutsByKey != other.pinoutsByKey) {
+                return "pinouts";
+            }
+
+            if (this->variantsByKey != other.variantsByKey) {
+                return "variants";
+            }
+
+            return std::nullopt;
+        }
+    };
+
+    /**
+     * Writes a binary TDF image from a QDomDocument, in the format described in TdfImage.
+     */
+    class DomImageWriter
+    {
+    public:
+        explicit DomImageWriter(const QDomDocument& document) {
+            this->addElement(document.documentElement());
+        }
+
+        void write(const std::filesystem::path& imagePath) const {
+            auto stringDataSize = std::uint32_t{0};
+            for (const auto& string : this->strings) {
+                stringDataSize += static_cast<std::uint32_t>(string.size());
+            }
+
+            auto output = std::vector<unsigned char>{'B', 'L', 'T', 'D', 'F', 'I', 'M', 'G'};
+            const auto append = [&output] (std::uint32_t value) {
+                output.push_back(static_cast<unsigned char>(value));
+                output.push_back(static_cast<unsigned char>(value >> 8));
+                output.push_back(static_cast<unsigned char>(value >> 16));
+                output.push_back(static_cast<unsigned char>(value >> 24));
+            };
+
+            append(TdfImage::FORMAT_VERSION);
+            append(0);
+            append(static_cast<std::uint32_t>(this->strings.size()));
+            append(static_cast<std::uint32_t>(this->elements.size()));
+            append(static_cast<std::uint32_t>(this->attributes.size()));
+            append(stringDataSize);
+
+            auto stringOffset = std::uint32_t{0};
+            for (const auto& string : this->strings) {
+                append(stringOffset);
+                append(static_cast<std::uint32_t>(string.size()));
+                stringOffset += static_cast<std::uint32_t>(string.size());
+            }
+
+            for (const auto& element : this->elements) {
+                std::for_each(element.begin(), element.end(), append);
+            }
+
+            for (const auto& attribute : this->attributes) {
+                std::for_each(attribute.begin(), attribute.end(), append);
+            }
+
+            for (const auto& string : this->strings) {
+                output.insert(output.end(), string.begin(), string.end());
+            }
+
+            auto file = std::ofstream{imagePath, std::ios::binary | std::ios::trunc};
+            file.write(reinterpret_cast<const char*>(output.data()), static_cast<std::streamsize>(output.size()));
+            expect(file.good(), "write DOM image to " + imagePath.string());
+        }
+
+    private:
+        static constexpr auto NONE = std::uint32_t{0xFFFFFFFF};
+
+        // Element record fields
+        static constexpr auto ELEMENT_FIRST_CHILD = std::size_t{3};
+        static constexpr auto ELEMENT_NEXT_SIBLING = std::size_t{4};
+
+        std::vector<std::string> strings;
+        std::unordered_map<std::string, std::uint32_t> stringIndicesByValue;
+        std::vector<std::array<std::uint32_t, 5>> elements;
+        std::vector<std::array<std::uint32_t, 2>> attributes;
+
+        std::uint32_t addElement(const QDomElement& element) {
+            const auto index = static_cast<std::uint32_t>(this->elements.size());
+            const auto domAttributes = element.attributes();
+
+            this->elements.push_back({
+                this->stringIndex(element.nodeName().toStdString()),
+                static_cast<std::uint32_t>(this->attributes.size()),
+                static_cast<std::uint32_t>(domAttributes.length()),
+                DomImageWriter::NONE,
+                DomImageWriter::NONE,
+            });
+
+            for (auto i = 0; i < domAttributes.length(); ++i) {
+                const auto domAttribute = domAttributes.item(i);
+                this->attributes.push_back({
+                    this->stringIndex(domAttribute.nodeName().toStdString()),
+                    this->stringIndex(domAttribute.nodeValue().toStdString()),
+                });
+            }
+
+            auto previousChildIndex = std::optional<std::uint32_t>{};
+            for (
+                auto childElement = element.firstChildElement();
+                !childElement.isNull();
+                childElement = childElement.nextSiblingElement()
+            ) {
+                const auto childIndex = this->addElement(childElement);
+
+                if (!previousChildIndex.has_value()) {
+                    this->elements[index][DomImageWriter::ELEMENT_FIRST_CHILD] = childIndex;
+
+                } else {
+                    this->elements[*previousChildIndex][DomImageWriter::ELEMENT_NEXT_SIBLING] = childIndex;
+                }
+
+                previousChildIndex = childIndex;
+            }
+
+            return index;
+        }
+
+        std::uint32_t stringIndex(std::string&& value) {
+            const auto indexIt = this->stringIndicesByValue.find(value);
+            if (indexIt != this->stringIndicesByValue.end()) {
+                return indexIt->second;
+            }
+
+            const auto index = static_cast<std::uint32_t>(this->strings.size());
+            this->stringIndicesByValue.emplace(value, index);
+            this->strings.emplace_back(std::move(value));
+            return index;
+        }
+    };
+
+    void check(const std::filesystem::path& xmlFilePath, const std::filesystem::path& domImagePath) {
+        auto xmlFile = QFile{QString::fromStdString(xmlFilePath.string())};
+        expect(xmlFile.open(QIODevice::ReadOnly), "open " + xmlFilePath.string());
+
+        auto document = QDomDocument{};
+        expect(static_cast<bool>(document.setContent(xmlFile.readAll())), "DOM parse of " + xmlFilePath.string());
+
+        DomImageWriter{document}.write(domImagePath);
+        const auto domTdf = ParsedTargetDescriptionFile{TdfImage::fromFile(domImagePath.string())};
+
+        xmlFile.seek(0);
+        const auto streamedImage = TdfImage::fromXml(xmlFile);
+        const auto streamedTdf = ParsedTargetDescriptionFile{streamedImage};
+
+        const auto domDifference = streamedTdf.findDifference(domTdf);
+        expect(
+            !domDifference.has_value(),
+            "streamed and DOM " + domDifference.value_or("") + " match, for " + xmlFilePath.string()
+        );
+
+        const auto generatedImagePath = TdfImage::imagePath(xmlFilePath.string());
+        if (!std::filesystem::exists(generatedImagePath)) {
+            return;
+        }
+
+        const auto generatedImage = TdfImage::fromFile(generatedImagePath);
+        expect(
+            generatedImage.sourceSize() == std::filesystem::file_size(xmlFilePath),
+            "source size recorded in " + generatedImagePath + " matches " + xmlFilePath.string()
+        );
+
+        const auto mismatchOffset = streamedImage.findMismatch(generatedImage);
+        expect(
+            !mismatchOffset.has_value(),
+            "streamed image matches " + generatedImagePath + " (first mismatch at byte offset "
+                + std::to_string(mismatchOffset.value_or(0)) + ")"
+        );
+
+        const auto generatedDifference = streamedTdf.findDifference(
+            ParsedTargetDescriptionFile{generatedImage}
+        );
+        expect(
+            !generatedDifference.has_value(),
+            "streamed and generated image " + generatedDifference.value_or("") + " match, for "
+                + xmlFilePath.string()
+        );
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <path to TDF directory>\n";
+        return 2;
+    }
+
+    Logger::silence();
+
+    auto xmlFilePaths = std::vector<std::filesystem::path>{};
+    for (const auto& entry : std::filesystem::recursive_directory_iterator{argv[1]}) {
+        if (entry.is_regular_file() && entry.path().extension() == ".xml") {
+            xmlFilePaths.push_back(entry.path());
+        }
+    }
+
+    if (xmlFilePaths.empty()) {
+        std::cerr << "No TDFs found in " << argv[1] << "\n";
+        return 1;
+    }
+
+    std::sort(xmlFilePaths.begin(), xmlFilePaths.end());
+
+    const auto domImagePath = std::filesystem::temp_directory_path() / "TargetDescriptionFileTest.tdfi";
+    auto failureCount = std::size_t{0};
+
+    for (const auto& xmlFilePath : xmlFilePaths) {
+        try {
+            check(xmlFilePath, domImagePath);
+
+        } catch (const Exceptions::Exception& exception) {
+            std::cerr << "Failed: " << exception.getMessage() << "\n";
+            ++failureCount;
+        }
+    }
+
+    std::filesystem::remove(domImagePath);
+
+    if (failureCount > 0) {
+        std::cerr << failureCount << " of " << xmlFilePaths.size() << " TDFs failed the check\n";
+        return 1;
+    }
+
+    std::cout << xmlFilePaths.size() << " TDFs checked\n";
+    return 0;
+}
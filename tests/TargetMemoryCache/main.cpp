@@ -0,0 +1,331 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <set>
+#include <iostream>
+#include <algorithm>
+
+#include "src/Targets/TargetMemoryCache.hpp"
+#include "src/Targets/TargetMemorySegmentDescriptor.hpp"
+#include "src/Targets/TargetMemoryAddressRange.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+#include "tests/Helpers/Expect.hpp"
+
+/*
+ * Exercises the TargetMemoryCache against a synthetic memory segment, checking the populated/missing ranges and the
+ * fetched data after each operation.
+ *
+ * The segment starts at a non-zero address and spans several cache pages, so that page and segment offsets are
+ * exercised independently.
+ *
+ * Usage: TargetMemoryCacheTest
+ */
+
+using Targets::TargetMemoryCache;
+using Targets::TargetMemorySegmentDescriptor;
+using Targets::TargetMemorySegmentType;
+using Targets::TargetMemoryAddressRange;
+using Targets::TargetMemoryAccess;
+using Targets::TargetMemoryAddress;
+using Targets::TargetMemorySize;
+using Targets::TargetMemoryBuffer;
+
+using Tests::expect;
+
+namespace
+{
+    constexpr auto SEGMENT_START_ADDRESS = TargetMemoryAddress{0x08000000};
+    constexpr auto SEGMENT_SIZE = TargetMemorySize{TargetMemoryCache::PAGE_SIZE * 4};
+
+    TargetMemorySegmentDescriptor segmentDescriptor() {
+        return {
+            "prog",
+            "internal_program_memory",
+            "Internal program memory",
+            TargetMemorySegmentType::FLASH,
+            TargetMemoryAddressRange{SEGMENT_START_ADDRESS, SEGMENT_START_ADDRESS + SEGMENT_SIZE - 1},
+            1,
+            true,
+            TargetMemoryAccess{true, false},
+            TargetMemoryAccess{true, true},
+            false,
+            std::nullopt
+        };
+    }
+
+    /**
+     * Generates a buffer with contents derived from the address of each byte, so that data fetched from the wrong
+     * offset is detected.
+     */
+    TargetMemoryBuffer pattern(TargetMemoryAddress startAddress, TargetMemorySize bytes, unsigned char salt = 0x00) {
+        auto output = TargetMemoryBuffer{};
+        output.reserve(bytes);
+
+        for (auto address = startAddress; address < startAddress + bytes; ++address) {
+            output.push_back(static_cast<unsigned char>((address ^ (address >> 8)) + salt));
+        }
+
+        return output;
+    }
+
+    TargetMemoryAddress address(TargetMemoryAddress offset) {
+        return SEGMENT_START_ADDRESS + offset;
+    }
+
+    TargetMemoryAddressRange range(TargetMemoryAddress startOffset, TargetMemoryAddress endOffset) {
+        return {SEGMENT_START_ADDRESS + startOffset, SEGMENT_START_ADDRESS + endOffset};
+    }
+
+    std::string describe(const std::vector<TargetMemoryAddressRange>& ranges) {
+        auto output = std::string{};
+
+        for (const auto& range : ranges) {
+            output += (output.empty() ? "" : ", ") + std::to_string(range.startAddress - SEGMENT_START_ADDRESS)
+                + "-" + std::to_string(range.endAddress - SEGMENT_START_ADDRESS);
+        }
+
+        return "[" + output + "]";
+    }
+
+    void expectMissing(
+        const TargetMemoryCache& cache,
+        TargetMemoryAddress startOffset,
+        TargetMemorySize bytes,
+        const std::vector<TargetMemoryAddressRange>& expected,
+        const std::string& description,
+        const std::set<TargetMemoryAddressRange>& excludedAddressRanges = {}
+    ) {
+        const auto missingRanges = cache.missingRanges(
+            SEGMENT_START_ADDRESS + startOffset,
+            bytes,
+            excludedAddressRanges
+        );
+        expect(
+            missingRanges == expected,
+            description + " - missing ranges " + describe(missingRanges) + ", expected " + describe(expected)
+        );
+    }
+
+    void testPartialFill() {
+        const auto descriptor = segmentDescriptor();
+        auto cache = TargetMemoryCache{descriptor};
+
+        expectMissing(cache, 0, SEGMENT_SIZE, {range(0, SEGMENT_SIZE - 1)}, "Empty cache");
+        expect(!cache.contains(SEGMENT_START_ADDRESS, 1), "Empty cache holds nothing");
+        expect(cache.contains(SEGMENT_START_ADDRESS, 0), "Empty cache holds an empty range");
+
+        // Fill part of the second page, not starting on a page boundary
+        const auto startAddress = SEGMENT_START_ADDRESS + TargetMemoryCache::PAGE_SIZE + 16;
+        const auto data = pattern(startAddress, 32);
+        cache.insert(startAddress, data);
+
+        expect(cache.contains(startAddress, 32), "Inserted range is cached");
+        expect(cache.contains(startAddress + 8, 8), "Sub-range of inserted range is cached");
+        expect(!cache.contains(startAddress - 1, 2), "Byte before inserted range is not cached");
+        expect(!cache.contains(startAddress + 31, 2), "Byte after inserted range is not cached");
+        expect(
+            !cache.contains(SEGMENT_START_ADDRESS + TargetMemoryCache::PAGE_SIZE, TargetMemoryCache::PAGE_SIZE),
+            "Rest of the page is not cached"
+        );
+
+        expectMissing(
+            cache,
+            TargetMemoryCache::PAGE_SIZE,
+            TargetMemoryCache::PAGE_SIZE,
+            {
+                range(TargetMemoryCache::PAGE_SIZE, TargetMemoryCache::PAGE_SIZE + 15),
+                range(TargetMemoryCache::PAGE_SIZE + 48, TargetMemoryCache::PAGE_SIZE * 2 - 1),
+            },
+            "Partially filled page"
+        );
+
+        expect(cache.fetch(startAddress, 32) == data, "Fetched data matches inserted data");
+        expect(
+            cache.fetch(startAddress + 4, 4) == pattern(startAddress + 4, 4),
+            "Fetched sub-range matches inserted data"
+        );
+
+        auto threw = false;
+        try {
+            static_cast<void>(cache.fetch(startAddress, 33));
+
+        } catch (const Exceptions::Exception&) {
+            threw = true;
+        }
+
+        expect(threw, "Fetching beyond the populated range is rejected");
+
+        // Excluded ranges must not be marked as populated, and must not be required upon fetch
+        cache.insert(
+            SEGMENT_START_ADDRESS,
+            pattern(SEGMENT_START_ADDRESS, 64),
+            {range(8, 15), range(40, 47)}
+        );
+
+        expectMissing(cache, 0, 64, {range(8, 15), range(40, 47)}, "Insertion with excluded ranges");
+        expectMissing(cache, 0, 64, {}, "Excluded ranges omitted from missing ranges", {range(8, 15), range(40, 47)});
+
+        const auto fetched = cache.fetch(SEGMENT_START_ADDRESS, 64, {range(8, 15), range(40, 47)});
+        auto expected = pattern(SEGMENT_START_ADDRESS, 64);
+        std::fill(expected.begin() + 8, expected.begin() + 16, 0x00);
+        std::fill(expected.begin() + 40, expected.begin() + 48, 0x00);
+        expect(fetched == expected, "Unpopulated excluded bytes are fetched as 0x00");
+    }
+
+    void testRangeMerging() {
+        const auto descriptor = segmentDescriptor();
+        auto cache = TargetMemoryCache{descriptor};
+
+        // Two disjoint ranges, either side of a page boundary
+        cache.insert(address(240), pattern(address(240), 8));
+        cache.insert(address(264), pattern(address(264), 8));
+        expectMissing(cache, 240, 32, {range(248, 263)}, "Disjoint ranges");
+        expect(!cache.contains(address(240), 32), "Disjoint ranges don't satisfy a spanning read");
+
+        // Adjacent on both sides - should merge into a single range
+        cache.insert(address(248), pattern(address(248), 16));
+        expectMissing(cache, 240, 32, {}, "Adjacent ranges");
+        expect(cache.contains(address(240), 32), "Adjacent ranges merged across page boundary");
+        expect(
+            cache.fetch(address(240), 32) == pattern(address(240), 32),
+            "Merged range data"
+        );
+
+        // Overlapping the end of the merged range, and a later disjoint range
+        cache.insert(address(300), pattern(address(300), 4));
+        cache.insert(address(268), pattern(address(268), 40));
+        expect(cache.contains(address(240), 68), "Overlapping range merged with preceding range");
+        expectMissing(cache, 230, 80, {range(230, 239), range(308, 309)}, "Overlapping ranges");
+
+        // A range enclosing several populated ranges
+        cache.insert(address(400), pattern(address(400), 2));
+        cache.insert(address(410), pattern(address(410), 2));
+        cache.insert(address(396), pattern(address(396), 20));
+        expectMissing(cache, 390, 30, {range(390, 395), range(416, 419)}, "Enclosing range");
+
+        // Merging with the first and last bytes of the segment
+        cache.insert(SEGMENT_START_ADDRESS, pattern(SEGMENT_START_ADDRESS, 1));
+        cache.insert(address(SEGMENT_SIZE - 1), pattern(address(SEGMENT_SIZE - 1), 1));
+        cache.insert(address(1), pattern(address(1), 239));
+        cache.insert(address(420), pattern(address(420), SEGMENT_SIZE - 421));
+        expectMissing(cache, 0, SEGMENT_SIZE, {range(308, 395), range(416, 419)}, "Segment boundaries");
+        expect(cache.dump(0xFF).size() == SEGMENT_SIZE, "Dump spans the segment");
+    }
+
+    void testWrites() {
+        const auto descriptor = segmentDescriptor();
+        auto cache = TargetMemoryCache{descriptor};
+
+        cache.insert(SEGMENT_START_ADDRESS, pattern(SEGMENT_START_ADDRESS, 128));
+
+        // A write is inserted over the cached data, replacing it
+        const auto writeAddress = address(100);
+        const auto writeData = pattern(writeAddress, 16, 0x5A);
+        cache.insert(writeAddress, writeData);
+
+        auto expected = pattern(SEGMENT_START_ADDRESS, 128);
+        std::copy(writeData.begin(), writeData.end(), expected.begin() + 100);
+        expect(cache.fetch(SEGMENT_START_ADDRESS, 128) == expected, "Write replaces cached data");
+        expect(cache.fetch(writeAddress, 16) == writeData, "Written data fetched");
+        expectMissing(cache, 0, 128, {}, "Write within populated range");
+
+        // A write extending beyond the populated range
+        const auto extendedWriteData = pattern(address(120), 16, 0xA5);
+        cache.insert(address(120), extendedWriteData);
+        expect(cache.contains(SEGMENT_START_ADDRESS, 136), "Write extends populated range");
+        expect(cache.fetch(address(120), 16) == extendedWriteData, "Extended write data fetched");
+
+        // Fills (as used for erased memory) replace cached data in the same way
+        cache.fill(address(64), 32, 0xFF);
+        expect(
+            cache.fetch(address(64), 32) == TargetMemoryBuffer(32, 0xFF),
+            "Fill replaces cached data"
+        );
+        expect(
+            cache.fetch(address(60), 4) == pattern(address(60), 4),
+            "Fill leaves preceding data intact"
+        );
+
+        // Invalidation
+        cache.clear();
+        expect(!cache.contains(SEGMENT_START_ADDRESS, 1), "Cleared cache holds nothing");
+        expectMissing(cache, 0, SEGMENT_SIZE, {range(0, SEGMENT_SIZE - 1)}, "Cleared cache");
+        expect(cache.dump(0xFF) == TargetMemoryBuffer(SEGMENT_SIZE, 0xFF), "Cleared cache dump");
+
+        // Data inserted after invalidation must not include stale bytes from the cleared pages
+        cache.insert(address(8), pattern(address(8), 4, 0x11));
+        auto dumpExpected = TargetMemoryBuffer(SEGMENT_SIZE, 0xFF);
+        const auto newData = pattern(address(8), 4, 0x11);
+        std::copy(newData.begin(), newData.end(), dumpExpected.begin() + 8);
+        expect(cache.dump(0xFF) == dumpExpected, "Dump after re-population");
+    }
+
+    void testSpanningReads() {
+        const auto descriptor = segmentDescriptor();
+        auto cache = TargetMemoryCache{descriptor};
+
+        cache.insert(address(32), pattern(address(32), 32));
+        cache.insert(address(300), pattern(address(300), 100));
+
+        // A read starting in a cached region and ending in an uncached one
+        expectMissing(cache, 48, 32, {range(64, 79)}, "Read from cached into uncached");
+        // Starting in an uncached region and ending in a cached one
+        expectMissing(cache, 16, 32, {range(16, 31)}, "Read from uncached into cached");
+        // Spanning several cached and uncached regions, across pages
+        expectMissing(
+            cache,
+            0,
+            512,
+            {range(0, 31), range(64, 299), range(400, 511)},
+            "Read spanning several regions"
+        );
+        // With an excluded range splitting a gap, and another covering a gap entirely
+        expectMissing(
+            cache,
+            0,
+            512,
+            {range(0, 15), range(24, 31), range(64, 299)},
+            "Read spanning several regions, with excluded ranges",
+            {range(16, 23), range(400, 511)}
+        );
+
+        // Populating the missing ranges, as the TargetController does, should satisfy the read
+        for (const auto& missingRange : cache.missingRanges(SEGMENT_START_ADDRESS, 512)) {
+            cache.insert(missingRange.startAddress, pattern(missingRange.startAddress, missingRange.size()));
+        }
+
+        expect(cache.contains(SEGMENT_START_ADDRESS, 512), "Populated spanning read");
+        expect(
+            cache.fetch(SEGMENT_START_ADDRESS, 512) == pattern(SEGMENT_START_ADDRESS, 512),
+            "Spanning read data"
+        );
+
+        auto threw = false;
+        try {
+            cache.insert(address(SEGMENT_SIZE - 4), TargetMemoryBuffer(8, 0x00));
+
+        } catch (const Exceptions::Exception&) {
+            threw = true;
+        }
+
+        expect(threw, "Insertion beyond the end of the segment is rejected");
+    }
+}
+
+int main() {
+    try {
+        testPartialFill();
+        testRangeMerging();
+        testWrites();
+        testSpanningReads();
+
+    } catch (const Exceptions::Exception& exception) {
+        std::cerr << "Failed: " << exception.getMessage() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,261 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <chrono>
+#include <thread>
+#include <yaml-cpp/yaml.h>
+
+#include "src/DebugToolDrivers/Usb/UsbTrace.hpp"
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+#include "src/TargetController/Exceptions/DeviceCommunicationFailure.hpp"
+
+#include "tests/Helpers/Expect.hpp"
+
+/*
+ * Records a scripted USB session via UsbTrace, then replays the trace and checks that the replayed reads match the
+ * recorded ones, without any I/O functions being invoked.
+ *
+ * Corrupt traces (truncated records, oversized payloads) and diverging replays must be rejected with a
+ * DeviceCommunicationFailure.
+ *
+ * Usage: UsbTraceTest
+ */
+
+using Usb::UsbTrace;
+using Usb::UsbTraceConfig;
+using Usb::UsbTraceRecordType;
+
+using Tests::expect;
+
+namespace
+{
+    constexpr auto HID_INTERFACE = std::uint8_t{0};
+    constexpr auto BULK_OUT_ENDPOINT = std::uint8_t{0x01};
+    constexpr auto BULK_IN_ENDPOINT = std::uint8_t{0x81};
+
+    /**
+     * The delay between the last write and the last read of the session, used to check ORIGINAL replay timing.
+     */
+    constexpr auto RESPONSE_DELAY = std::chrono::milliseconds{50};
+
+    const auto TRACE_PATH = std::filesystem::temp_directory_path() / "UsbTraceTest.trace";
+
+    UsbTraceConfig traceConfig(const std::string& mode, const std::string& replayTiming = "fast") {
+        auto node = YAML::Node{};
+        node["mode"] = mode;
+        node["path"] = TRACE_PATH.string();
+        node["replay_timing"] = replayTiming;
+        return UsbTraceConfig{node};
+    }
+
+    /**
+     * The I/O performed by a hypothetical debug tool driver. When recording, the I/O functions play the part of the
+     * device. When replaying, they must never be invoked.
+     */
+    struct Session
+    {
+        bool replaying = false;
+        std::size_t deviceOperations = 0;
+
+        std::uint32_t deviceCount = 0;
+        std::vector<unsigned char> hidResponse;
+        std::vector<unsigned char> bulkResponse;
+        std::vector<unsigned char> emptyResponse;
+
+        void run(const std::vector<unsigned char>& lastCommand = {0x30, 0x31}) {
+            const auto device = [this] {
+                expect(!this->replaying, "No device I/O during replay");
+                ++(this->deviceOperations);
+            };
+
+            this->deviceCount = UsbTrace::value(UsbTraceRecordType::DEVICE_COUNT, 0, [&device] {
+                device();
+                return std::uint32_t{3};
+            });
+
+            UsbTrace::write(UsbTraceRecordType::HID_WRITE, HID_INTERFACE, std::vector<unsigned char>{0x80}, device);
+            this->hidResponse = UsbTrace::read(UsbTraceRecordType::HID_READ, HID_INTERFACE, [&device] {
+                device();
+                return std::vector<unsigned char>{0x80, 0x01, 0x02, 0x03};
+            });
+
+            UsbTrace::write(
+                UsbTraceRecordType::BULK_WRITE,
+                BULK_OUT_ENDPOINT,
+                std::vector<unsigned char>(512, 0xA5),
+                device
+            );
+            this->emptyResponse = UsbTrace::read(UsbTraceRecordType::BULK_READ, BULK_IN_ENDPOINT, [&device] {
+                device();
+                return std::vector<unsigned char>{};
+            });
+
+            UsbTrace::write(UsbTraceRecordType::BULK_WRITE, BULK_OUT_ENDPOINT, lastCommand, device);
+            this->bulkResponse = UsbTrace::read(UsbTraceRecordType::BULK_READ, BULK_IN_ENDPOINT, [&device] {
+                device();
+                std::this_thread::sleep_for(RESPONSE_DELAY);
+
+                auto response = std::vector<unsigned char>(1024);
+                for (auto i = std::size_t{0}; i < response.size(); ++i) {
+                    response[i] = static_cast<unsigned char>(i * 7);
+                }
+
+                return response;
+            });
+        }
+    };
+
+    Session record() {
+        auto session = Session{};
+
+        UsbTrace::start(traceConfig("record"));
+        session.run();
+        UsbTrace::stop();
+
+        expect(session.deviceOperations == 7, "All recorded operations reached the device");
+        return session;
+    }
+
+    /**
+     * Replays the trace, expecting a DeviceCommunicationFailure.
+     */
+    void expectReplayFailure(
+        const std::string& description,
+        const std::vector<unsigned char>& lastCommand = {0x30, 0x31}
+    ) {
+        auto session = Session{.replaying = true};
+        auto failed = false;
+
+        try {
+            UsbTrace::start(traceConfig("replay"));
+            session.run(lastCommand);
+
+        } catch (const Exceptions::DeviceCommunicationFailure&) {
+            failed = true;
+        }
+
+        UsbTrace::stop();
+        expect(failed, description);
+    }
+
+    std::vector<char> readTrace() {
+        auto file = std::ifstream{TRACE_PATH, std::ios::binary};
+        return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    }
+
+    void writeTrace(const std::vector<char>& data) {
+        auto file = std::ofstream{TRACE_PATH, std::ios::binary | std::ios::trunc};
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+
+    void testRoundTrip() {
+        const auto recordedSession = record();
+        const auto transferCount = UsbTrace::transferCount();
+
+        for (const auto& replayTiming : {"fast", "original"}) {
+            auto session = Session{.replaying = true};
+
+            const auto startTime = std::chrono::steady_clock::now();
+            UsbTrace::start(traceConfig("replay", replayTiming));
+            session.run();
+            UsbTrace::stop();
+            const auto replayDuration = std::chrono::steady_clock::now() - startTime;
+
+            const auto timing = std::string{replayTiming};
+            expect(session.deviceCount == recordedSession.deviceCount, timing + " replay: device count");
+            expect(session.hidResponse == recordedSession.hidResponse, timing + " replay: HID read");
+            expect(session.emptyResponse.empty(), timing + " replay: empty bulk read");
+            expect(session.bulkResponse == recordedSession.bulkResponse, timing + " replay: bulk read");
+
+            if (timing == "original") {
+                expect(replayDuration >= RESPONSE_DELAY, "Original replay timing honours recorded timestamps");
+            }
+        }
+
+        expect(
+            UsbTrace::transferCount() - transferCount == 2 * 6,
+            "Replayed transfers are counted"
+        );
+    }
+
+    void testDivergence() {
+        record();
+        expectReplayFailure("Replay with different written data is rejected", {0x30, 0x32});
+        expectReplayFailure("Replay with differently sized written data is rejected", {0x30});
+    }
+
+    void testCorruptTraces() {
+        record();
+        const auto trace = readTrace();
+
+        // The final record is the 1024 byte bulk read - truncate it at every point within its header and payload
+        constexpr auto RECORD_HEADER_SIZE = std::size_t{1 + 1 + 8 + 4};
+        const auto finalRecordOffset = trace.size() - 1024 - RECORD_HEADER_SIZE;
+
+        for (
+            const auto truncatedSize : {
+                finalRecordOffset,
+                finalRecordOffset + 1,
+                finalRecordOffset + 10,
+                finalRecordOffset + RECORD_HEADER_SIZE - 1,
+                finalRecordOffset + RECORD_HEADER_SIZE,
+                finalRecordOffset + RECORD_HEADER_SIZE + 512,
+                trace.size() - 1,
+            }
+        ) {
+            writeTrace(std::vector<char>{trace.begin(), trace.begin() + static_cast<long>(truncatedSize)});
+            expectReplayFailure("Trace truncated to " + std::to_string(truncatedSize) + " bytes is rejected");
+        }
+
+        // Inflate the payload size of the final record beyond the maximum
+        auto oversizedTrace = trace;
+        const auto oversizedPayloadSize = UsbTrace::MAX_PAYLOAD_SIZE + 1;
+        for (auto i = std::size_t{0}; i < 4; ++i) {
+            oversizedTrace[finalRecordOffset + 10 + i] = static_cast<char>((oversizedPayloadSize >> (i * 8)) & 0xFF);
+        }
+
+        writeTrace(oversizedTrace);
+        expectReplayFailure("Record with oversized payload is rejected");
+
+        // A huge payload size must be rejected before any allocation is attempted
+        for (auto i = std::size_t{0}; i < 4; ++i) {
+            oversizedTrace[finalRecordOffset + 10 + i] = static_cast<char>(0xFF);
+        }
+
+        writeTrace(oversizedTrace);
+        expectReplayFailure("Record with 4 GiB payload is rejected");
+
+        // The unmodified trace must still replay
+        writeTrace(trace);
+        auto session = Session{.replaying = true};
+        UsbTrace::start(traceConfig("replay"));
+        session.run();
+        UsbTrace::stop();
+    }
+}
+
+int main() {
+    Logger::silence();
+
+    auto exitCode = 0;
+
+    try {
+        testRoundTrip();
+        testDivergence();
+        testCorruptTraces();
+
+    } catch (const Exceptions::Exception& exception) {
+        std::cerr << "Failed: " << exception.getMessage() << "\n";
+        exitCode = 1;
+    }
+
+    UsbTrace::stop();
+    std::filesystem::remove(TRACE_PATH);
+
+    return exitCode;
+}